@@ -0,0 +1,101 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QKeyEvent>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct BenchTag
+    {};
+
+    // A chain of wired nodes, every node selected.
+    struct SelectedChain
+    {
+        std::unique_ptr<GraphScene> scene;
+        std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    };
+
+    SelectedChain
+    makeSelectedChain(int count)
+    {
+        SelectedChain chain{std::make_unique<GraphScene>(), {}};
+        GraphScene* scene = chain.scene.get();
+        auto factory = scene->getNodeFactory();
+        factory->setLazyParameterWidgets(true);
+        scene->getGraphRegistry()->reserve(count, count);
+
+        auto& nodes = chain.nodes;
+        nodes.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            auto node = factory->createNode(scene, QStringLiteral("N%1").arg(i), Qt::darkCyan, QPointF((i % 100) * 220.0, (i / 100) * 120.0));
+            factory->addInput(*node, "in");
+            factory->addOutput(*node, "out");
+            factory->addInputTag<BenchTag>(*node, "in");
+            factory->addOutputTag<BenchTag>(*node, "out");
+            if (!nodes.empty())
+                factory->createConnection(*scene,
+                                          *factory->getOutputPortByName(*nodes.back(), "out"),
+                                          *factory->getInputPortByName(*node, "in"),
+                                          false);
+            node->item->setSelected(true);
+            nodes.push_back(std::move(node));
+        }
+        return chain;
+    }
+} // namespace
+
+// Delete key on a selection of N chained nodes and their N-1 wires.
+static void
+BM_DeleteSelection(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        SelectedChain chain = makeSelectedChain(count);
+        state.ResumeTiming();
+
+        QKeyEvent deleteKey(QEvent::KeyPress, Qt::Key_Delete, Qt::NoModifier);
+        QCoreApplication::sendEvent(chain.scene.get(), &deleteKey);
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        state.PauseTiming();
+        chain.nodes.clear();
+        chain.scene.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DeleteSelection)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,123 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/ConnectionItem.hpp"
+
+#include <QGraphicsScene>
+#include <QPainterPath>
+#include <QPainterPathStroker>
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace
+{
+    constexpr int columns = 250;
+    constexpr qreal spacingX = 200.0;
+    constexpr qreal spacingY = 80.0;
+
+    // A scene of @p count wires laid out on a grid, each one a curve spanning two rows.
+    std::unique_ptr<QGraphicsScene>
+    makeWires(int count)
+    {
+        auto scene = std::make_unique<QGraphicsScene>();
+        for (int i = 0; i < count; ++i)
+        {
+            const QPointF origin((i % columns) * spacingX, (i / columns) * spacingY);
+            const ConnectionPort output{origin + QPointF(10, 10), QRectF(0, 0, 20, 10), "out", "A", false};
+            const ConnectionPort input{origin + QPointF(150, 90), QRectF(0, 0, 20, 10), "in", "B", true};
+            scene->addItem(new ConnectionItem(output, input));
+        }
+        // Build the index up front, as a shown scene would have.
+        scene->items(QRectF(0, 0, 1, 1));
+        return scene;
+    }
+
+    QPainterPath
+    band(qreal size)
+    {
+        QPainterPath path;
+        path.addRect(QRectF(1000, 1000, size, size));
+        return path;
+    }
+}
+
+// Rubber-band selection over 50k wires; range(0) is the band side in scene units.
+static void
+BM_RubberBandSelection(benchmark::State& state)
+{
+    auto scene = makeWires(50000);
+    const QPainterPath area = band(static_cast<qreal>(state.range(0)));
+    int selected = 0;
+    for (auto _ : state)
+    {
+        scene->setSelectionArea(area);
+        selected = scene->selectedItems().size();
+        scene->clearSelection();
+    }
+    state.counters["selected"] = selected;
+}
+BENCHMARK(BM_RubberBandSelection)->Arg(500)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+// Point queries, as issued by hover and clicks.
+static void
+BM_PointQuery(benchmark::State& state)
+{
+    auto scene = makeWires(50000);
+    int hits = 0;
+    for (auto _ : state)
+    {
+        hits = 0;
+        for (int i = 0; i < 1000; ++i)
+            hits += scene->items(QPointF(37.0 * i, 11.0 * i)).size();
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["hits"] = hits;
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_PointQuery)->Unit(benchmark::kMillisecond);
+
+// What every shape() call used to cost, against the cached shape.
+static void
+BM_ShapeStroked(benchmark::State& state)
+{
+    const ConnectionItem item({QPointF(10, 10), QRectF(0, 0, 20, 10), "out", "A", false},
+                              {QPointF(150, 90), QRectF(0, 0, 20, 10), "in", "B", true});
+    for (auto _ : state)
+    {
+        QPainterPathStroker stroker;
+        stroker.setWidth(10);
+        benchmark::DoNotOptimize(stroker.createStroke(item.path()));
+    }
+}
+BENCHMARK(BM_ShapeStroked);
+
+static void
+BM_ShapeCached(benchmark::State& state)
+{
+    const ConnectionItem item({QPointF(10, 10), QRectF(0, 0, 20, 10), "out", "A", false},
+                              {QPointF(150, 90), QRectF(0, 0, 20, 10), "in", "B", true});
+    for (auto _ : state)
+        benchmark::DoNotOptimize(item.shape());
+}
+BENCHMARK(BM_ShapeCached);
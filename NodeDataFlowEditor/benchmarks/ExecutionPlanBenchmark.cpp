@@ -0,0 +1,104 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include "utility/ExecutionPlan.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // Layers of 100 nodes; every node feeds two nodes of the next layer, uids
+    // descending so the order has to be computed rather than read off.
+    ExecutionPlan::Source
+    layeredGraph(int nodes, int groupSize)
+    {
+        constexpr int width = 100;
+        ExecutionPlan::Source source;
+        source.nodes.reserve(nodes);
+        for (int i = 0; i < nodes; ++i)
+        {
+            const qint64 uid = nodes - i;
+            const PortId base = PortId(uid) * 4;
+            source.nodes.push_back({uid, {base, base + 1}, {base + 2}, {base + 3}});
+        }
+
+        // Group ports sit above every node port id.
+        PortId nextGroupPort = PortId(nodes + 1) * 4;
+        ConnectionId nextConnection = 1;
+        for (int i = 0; i + width < nodes; ++i)
+        {
+            const PortId output = PortId(nodes - i) * 4 + 2;
+            for (int k = 0; k < 2; ++k)
+            {
+                const int target = i + width + (i + k) % width - i % width;
+                if (target >= nodes)
+                    continue;
+                PortId input = PortId(nodes - target) * 4 + k;
+                if (groupSize > 0 && target % groupSize == 0)
+                {
+                    // Wire to a group port forwarding to the actual input.
+                    source.forwards.insert(nextGroupPort, {input});
+                    input = nextGroupPort++;
+                }
+                source.connections.push_back({nextConnection++, output, input});
+            }
+        }
+        return source;
+    }
+}
+
+// Compiling a 100k-node graph; range(0) is the group size, 0 for no groups.
+static void
+BM_CompilePlan(benchmark::State& state)
+{
+    const ExecutionPlan::Source source = layeredGraph(100000, static_cast<int>(state.range(0)));
+    int edges = 0;
+    for (auto _ : state)
+    {
+        const auto plan = ExecutionPlan::compile(source);
+        edges = plan->edges().size();
+        benchmark::DoNotOptimize(plan.get());
+    }
+    state.counters["edges"] = edges;
+    state.SetItemsProcessed(state.iterations() * source.nodes.size());
+}
+BENCHMARK(BM_CompilePlan)->Arg(0)->Arg(8)->Unit(benchmark::kMillisecond);
+
+// Walking a compiled plan in order, as an evaluator does on every run.
+static void
+BM_WalkPlan(benchmark::State& state)
+{
+    const auto plan = ExecutionPlan::compile(layeredGraph(100000, 0));
+    for (auto _ : state)
+    {
+        qint64 sum = 0;
+        for (const ExecutionPlan::Node& node : plan->nodes())
+            for (int e = node.firstEdge; e < node.firstEdge + node.edgeCount; ++e)
+                sum += plan->edges()[e].input;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * plan->nodes().size());
+}
+BENCHMARK(BM_WalkPlan)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,270 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/NodeDescriptor.hpp"
+#include "utility/ObjectPool.hpp"
+#include "view/ConnectionItem.hpp"
+#include "view/GraphScene.hpp"
+
+#include <QApplication>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#if defined(Q_OS_LINUX)
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    struct BenchTag
+    {};
+
+    // Resident set size of the process right now, in KiB (0 where unsupported).
+    double
+    currentRssKb()
+    {
+#if defined(Q_OS_LINUX)
+        std::ifstream statm("/proc/self/statm");
+        long pages = 0;
+        long resident = 0;
+        statm >> pages >> resident;
+        return static_cast<double>(resident) * static_cast<double>(sysconf(_SC_PAGESIZE)) / 1024.0;
+#else
+        return 0.0;
+#endif
+    }
+
+    // KiB currently allocated from the heap (0 where unsupported).
+    double
+    heapInUseKb()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return static_cast<double>(mallinfo2().uordblks) / 1024.0;
+#else
+        return 0.0;
+#endif
+    }
+
+    // Chain of @p edges + 1 tagged nodes through the public factory API; the scene owns every wire.
+    std::vector<std::unique_ptr<NodeFactory::Node>>
+    buildChain(GraphScene& scene, int edges)
+    {
+        auto factory = scene.getNodeFactory();
+        scene.getGraphRegistry()->reserve(edges + 1, edges);
+
+        std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+        nodes.reserve(static_cast<std::size_t>(edges) + 1);
+        for (int i = 0; i <= edges; ++i)
+        {
+            auto node = factory->createNode(&scene, QStringLiteral("N%1").arg(i));
+            factory->addInput(*node, "in");
+            factory->addOutput(*node, "out");
+            factory->addInputTag<BenchTag>(*node, "in");
+            factory->addOutputTag<BenchTag>(*node, "out");
+            if (!nodes.empty())
+            {
+                if (ConnectionItem* c = factory->createConnectionBetweenPorts(factory->getOutputPortByName(*nodes.back(), "out"),
+                                                                              factory->getInputPortByName(*node, "in")))
+                    scene.addItem(c);
+            }
+            nodes.push_back(std::move(node));
+        }
+        return nodes;
+    }
+
+    // The registry's share of a chain of @p edges wires: one descriptor per node with its
+    // input, output and wires, allocated from an ObjectPool or one by one from the heap.
+    template <bool Pooled>
+    void
+    chainDescriptors(benchmark::State& state)
+    {
+        const auto edges = static_cast<int>(state.range(0));
+        const auto count = static_cast<std::size_t>(edges) + 1;
+
+        // Ports and wires are only stored, never dereferenced.
+        std::vector<char> handles(count * 2);
+        auto port = [&handles](std::size_t node, std::size_t i) { return reinterpret_cast<PortLabel*>(&handles[node * 2 + i]); };
+        auto wire = [&handles](std::size_t node) { return reinterpret_cast<ConnectionItem*>(&handles[node * 2 + 1]); };
+
+        double heapKb = 0.0;
+        double rssKb = 0.0;
+        for (auto _ : state)
+        {
+            const double heapBefore = heapInUseKb();
+            const double rssBefore = currentRssKb();
+
+            ObjectPool<NodeDescriptor> pool;
+            std::vector<NodeDescriptor*> nodes(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                NodeDescriptor* d = nullptr;
+                if constexpr (Pooled)
+                    d = pool.create();
+                else
+                    d = new NodeDescriptor();
+                d->uid = static_cast<qint64>(i) + 1;
+                if (i > 0)
+                    d->ports.addConnection(port(i, 0), PortTable::Kind::Input, wire(i - 1));
+                else
+                    d->ports.addPort(port(i, 0), PortTable::Kind::Input);
+                if (i + 1 < count)
+                    d->ports.addConnection(port(i, 1), PortTable::Kind::Output, wire(i));
+                else
+                    d->ports.addPort(port(i, 1), PortTable::Kind::Output);
+                nodes[i] = d;
+            }
+            heapKb = std::max(heapKb, heapInUseKb() - heapBefore);
+            rssKb = std::max(rssKb, currentRssKb() - rssBefore);
+
+            for (NodeDescriptor* d : nodes)
+            {
+                if constexpr (Pooled)
+                    pool.destroy(d);
+                else
+                    delete d;
+            }
+        }
+        state.counters["heap_kb"] = heapKb;
+        state.counters["rss_kb"] = rssKb;
+        state.SetItemsProcessed(state.iterations() * edges);
+    }
+} // namespace
+
+// Build a chain with the given number of wires through the public factory API,
+// then tear the whole scene down. Exercises descriptor, port and connection
+// allocation; rss_kb is the largest growth of the resident set during a build.
+static void
+BM_BuildAndTeardownChain(benchmark::State& state)
+{
+    const auto edges = static_cast<int>(state.range(0));
+    double rssKb = 0.0;
+    for (auto _ : state)
+    {
+        const double before = currentRssKb();
+        auto scene = std::make_unique<GraphScene>();
+        auto nodes = buildChain(*scene, edges);
+        rssKb = std::max(rssKb, currentRssKb() - before);
+
+        nodes.clear();
+        scene.reset();
+    }
+    state.counters["rss_kb"] = rssKb;
+    state.SetItemsProcessed(state.iterations() * edges);
+}
+BENCHMARK(BM_BuildAndTeardownChain)->Arg(255)->Arg(1023)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Registry descriptors of the same chains, pooled as GraphRegistry allocates them and unpooled.
+static void
+BM_ChainDescriptorsPooled(benchmark::State& state)
+{
+    chainDescriptors<true>(state);
+}
+BENCHMARK(BM_ChainDescriptorsPooled)->Arg(255)->Arg(1023)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_ChainDescriptorsHeap(benchmark::State& state)
+{
+    chainDescriptors<false>(state);
+}
+BENCHMARK(BM_ChainDescriptorsHeap)->Arg(255)->Arg(1023)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Descriptor churn through the registry's pool versus plain new/delete.
+static void
+BM_DescriptorPooled(benchmark::State& state)
+{
+    ObjectPool<NodeDescriptor> pool;
+    std::vector<NodeDescriptor*> live(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        for (auto& d : live)
+            d = pool.create();
+        for (auto* d : live)
+            pool.destroy(d);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DescriptorPooled)->Arg(100000);
+
+static void
+BM_DescriptorHeap(benchmark::State& state)
+{
+    std::vector<NodeDescriptor*> live(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        for (auto& d : live)
+            d = new NodeDescriptor();
+        for (auto* d : live)
+            delete d;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DescriptorHeap)->Arg(100000);
+
+// Drag connection: recycled item (what GraphScene does now) versus a fresh item per drag.
+static void
+BM_TempConnectionRecycled(benchmark::State& state)
+{
+    const ConnectionPort start{QPointF(10, 10), QRectF(0, 0, 20, 10), "out", "N0", false};
+    ConnectionItem item(start);
+    for (auto _ : state)
+    {
+        item.reset(start);
+        item.updateEndPoint(QPointF(200, 120));
+        benchmark::DoNotOptimize(item.path());
+    }
+}
+BENCHMARK(BM_TempConnectionRecycled);
+
+static void
+BM_TempConnectionAllocated(benchmark::State& state)
+{
+    const ConnectionPort start{QPointF(10, 10), QRectF(0, 0, 20, 10), "out", "N0", false};
+    for (auto _ : state)
+    {
+        auto item = std::make_unique<ConnectionItem>(start);
+        item->updateEndPoint(QPointF(200, 120));
+        benchmark::DoNotOptimize(item->path());
+    }
+}
+BENCHMARK(BM_TempConnectionAllocated);
+
+int
+main(int argc, char** argv)
+{
+    QApplication app(argc, argv);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include "utility/GraphDeltaStream.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // A mixed batch of @p count events, as a busy editing frame would produce.
+    QVector<GraphDelta>
+    makeEvents(int count)
+    {
+        QVector<GraphDelta> events;
+        events.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            GraphDelta d;
+            switch (i % 4)
+            {
+                case 0:
+                    d.type = GraphDelta::Type::NodeAdded;
+                    d.node = i;
+                    d.name = QStringLiteral("Node");
+                    break;
+                case 1:
+                    d.type = GraphDelta::Type::PortAdded;
+                    d.node = i - 1;
+                    d.port = static_cast<PortId>(i);
+                    d.name = QStringLiteral("out");
+                    break;
+                case 2:
+                    d.type = GraphDelta::Type::ConnectionAdded;
+                    d.connection = static_cast<ConnectionId>(i);
+                    d.node = i - 2;
+                    d.port = static_cast<PortId>(i - 1);
+                    d.toNode = i + 2;
+                    d.toPort = static_cast<PortId>(i + 3);
+                    break;
+                default:
+                    d.type = GraphDelta::Type::ParameterChanged;
+                    d.node = i;
+                    d.port = static_cast<PortId>(i);
+                    d.value = i * 0.5;
+                    break;
+            }
+            events.append(d);
+        }
+        return events;
+    }
+}
+
+// Encoding 100k events; the stream has to keep up with at least that many per second.
+static void
+BM_EncodeFrame(benchmark::State& state)
+{
+    const QVector<GraphDelta> events = makeEvents(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GraphDeltaCodec::encode(GraphDeltaCodec::FrameKind::Delta, 1, events));
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_EncodeFrame)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// What the receiving runtime pays to decode the same frame.
+static void
+BM_DecodeFrame(benchmark::State& state)
+{
+    const QVector<GraphDelta> events = makeEvents(static_cast<int>(state.range(0)));
+    const QByteArray encoded = GraphDeltaCodec::encode(GraphDeltaCodec::FrameKind::Delta, 1, events);
+    GraphDeltaCodec::Frame frame;
+    for (auto _ : state)
+    {
+        QByteArray buffer = encoded;
+        benchmark::DoNotOptimize(GraphDeltaCodec::takeFrame(buffer, frame));
+    }
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_DecodeFrame)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
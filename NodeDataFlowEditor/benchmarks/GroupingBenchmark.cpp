@@ -0,0 +1,98 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
+#include "view/GroupItem.hpp"
+#include "view/NodeItem.hpp"
+
+#include <QSpinBox>
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace
+{
+    // N scene-owned nodes, each with an input, an output and a spin box parameter.
+    QList<NodeItem*>
+    makeNodes(GraphScene& scene, int count)
+    {
+        QList<NodeItem*> nodes;
+        nodes.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            auto* node = new NodeItem(scene.getGraphRegistry(), QStringLiteral("N%1").arg(i));
+            node->addInput("in");
+            node->addOutput("out");
+            node->addParameter(new QSpinBox(), "gain");
+            node->setPos((i % 20) * 220.0, (i / 20) * 160.0);
+            scene.addItem(node);
+            nodes.append(node);
+        }
+        return nodes;
+    }
+} // namespace
+
+// Group a selection of N nodes: mirror 3N ports and register their forwarding.
+static void
+BM_GroupSelection(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto scene = std::make_unique<GraphScene>();
+        const QList<NodeItem*> nodes = makeNodes(*scene, count);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(new GroupItem(scene->getGraphRegistry(), nodes, scene.get()));
+
+        state.PauseTiming();
+        scene.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_GroupSelection)->Arg(100)->Arg(300)->Unit(benchmark::kMillisecond);
+
+// Build every mirrored parameter editor of a group of N nodes, as showing all of them would.
+static void
+BM_MaterializeParameters(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto scene = std::make_unique<GraphScene>();
+        auto* group = new GroupItem(scene->getGraphRegistry(), makeNodes(*scene, count), scene.get());
+        state.ResumeTiming();
+
+        group->materializeParameters();
+
+        state.PauseTiming();
+        scene.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MaterializeParameters)->Arg(100)->Arg(300)->Unit(benchmark::kMillisecond);
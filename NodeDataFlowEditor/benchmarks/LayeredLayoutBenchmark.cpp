@@ -0,0 +1,85 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/LayeredLayout.hpp"
+#include "view/GraphScene.hpp"
+
+#include <QRandomGenerator>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct LayoutTag
+    {};
+
+    /**
+     * @brief Scene of N stacked nodes wired as a random DAG (about two edges per node).
+     */
+    struct ImportedGraph
+    {
+        explicit ImportedGraph(int count)
+            : scene(std::make_unique<GraphScene>())
+        {
+            auto factory = scene->getNodeFactory();
+            scene->getGraphRegistry()->reserve(count, 2 * count);
+            QRandomGenerator rng(42);
+            nodes.reserve(count);
+            for (int i = 0; i < count; ++i)
+            {
+                auto node = factory->createNode(scene.get(), QStringLiteral("L%1").arg(i));
+                factory->addInput(*node, "in");
+                factory->addOutput(*node, "out");
+                factory->addInputTag<LayoutTag>(*node, "in");
+                factory->addOutputTag<LayoutTag>(*node, "out");
+                for (int e = 0; e < 2 && i > 0; ++e)
+                {
+                    const int from = static_cast<int>(rng.bounded(i));
+                    factory->createConnectionBetweenPorts(factory->getOutputPortByName(*nodes[from], "out"),
+                                                          factory->getInputPortByName(*node, "in"));
+                }
+                nodes.push_back(std::move(node));
+            }
+        }
+
+        std::unique_ptr<GraphScene> scene;
+        std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    };
+} // namespace
+
+// Layout computation alone, as done on the worker thread by GraphScene::autoLayout.
+static void
+BM_LayeredLayoutRun(benchmark::State& state)
+{
+    ImportedGraph graph(static_cast<int>(state.range(0)));
+    const auto snapshot = graph.scene->getGraphRegistry()->snapshot();
+    const LayeredLayout layout;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(layout.run(*snapshot));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LayeredLayoutRun)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
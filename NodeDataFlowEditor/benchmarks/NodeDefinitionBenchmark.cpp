@@ -0,0 +1,118 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "factory/NodeDefinition.hpp"
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
+
+#include <QCheckBox>
+#include <QSpinBox>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct ImageTag
+    {};
+    struct IntTag
+    {};
+    struct BoolTag
+    {};
+
+    // The demo's "Resize" node, declared.
+    struct ResizeNode
+    {
+        static constexpr const char* name = "Resize";
+        static constexpr QRgb color = qRgb(70, 160, 230);
+        static constexpr auto ports = std::make_tuple(
+            nodedef::Input<ImageTag>{"image", "input image"},
+            nodedef::Output<ImageTag>{"image", "output image"},
+            nodedef::Parameter<QSpinBox, IntTag>{"width", "kernel width"},
+            nodedef::Parameter<QSpinBox, IntTag>{"height", "kernel height"},
+            nodedef::Parameter<QCheckBox, BoolTag>{"keep_aspect", "keep scale"});
+    };
+
+    // The same node built through string-keyed calls, tagging each port by name afterwards.
+    std::unique_ptr<NodeFactory::Node>
+    createByName(NodeFactory& factory, GraphScene* scene)
+    {
+        auto node = factory.createNode(scene, "Resize", QColor(70, 160, 230));
+        factory.addInput(*node, "image", "input image");
+        factory.addInputTag<ImageTag>(*node, "image");
+        factory.addOutput(*node, "image", "output image");
+        factory.addOutputTag<ImageTag>(*node, "image");
+        factory.addParameter(*node, new QSpinBox(), "width", "kernel width");
+        factory.addParamTag<IntTag>(*node, "width");
+        factory.addParameter(*node, new QSpinBox(), "height", "kernel height");
+        factory.addParamTag<IntTag>(*node, "height");
+        factory.addParameter(*node, new QCheckBox(), "keep_aspect", "keep scale");
+        factory.addParamTag<BoolTag>(*node, "keep_aspect");
+        return node;
+    }
+
+    template <typename Create>
+    void
+    createNodes(benchmark::State& state, Create create)
+    {
+        const auto count = static_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto scene = std::make_unique<GraphScene>();
+            auto factory = scene->getNodeFactory();
+            factory->setLazyParameterWidgets(true);
+            scene->getGraphRegistry()->reserve(count, 0);
+            std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+            nodes.reserve(count);
+            state.ResumeTiming();
+
+            for (int i = 0; i < count; ++i)
+                nodes.push_back(create(*factory, scene.get()));
+
+            state.PauseTiming();
+            nodes.clear();
+            scene.reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+} // namespace
+
+// Node creation through addInput/addOutput/addParameter followed by add*Tag by port name.
+static void
+BM_CreateByName(benchmark::State& state)
+{
+    createNodes(state, createByName);
+}
+BENCHMARK(BM_CreateByName)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Node creation from a declared definition: ports come out already tagged.
+static void
+BM_CreateDeclared(benchmark::State& state)
+{
+    createNodes(state, [](NodeFactory& factory, GraphScene* scene) { return factory.create<ResizeNode>(scene); });
+}
+BENCHMARK(BM_CreateDeclared)->Arg(10000)->Unit(benchmark::kMillisecond);
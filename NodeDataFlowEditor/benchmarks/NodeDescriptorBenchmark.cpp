@@ -0,0 +1,246 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/NodeDescriptor.hpp"
+
+#include <QMap>
+#include <QVector>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    // The per-node layout NodeDescriptor used before PortTable: one map per port kind.
+    struct MapDescriptor
+    {
+        QMap<PortLabel*, QVector<ConnectionItem*>> inputs;
+        QMap<PortLabel*, QVector<ConnectionItem*>> outputs;
+        QMap<PortLabel*, QVector<ConnectionItem*>> parameters;
+    };
+
+    // A typical node: two inputs, one output, three parameters; every input and the output connected.
+    constexpr int inputsPerNode = 2;
+    constexpr int parametersPerNode = 3;
+    constexpr int portsPerNode = inputsPerNode + 1 + parametersPerNode;
+
+    // Ports and connections are only compared and stored, never dereferenced.
+    struct FakeGraph
+    {
+        explicit FakeGraph(int nodes)
+            : storage(static_cast<std::size_t>(nodes) * portsPerNode)
+        {}
+
+        PortLabel* port(int node, int index) { return reinterpret_cast<PortLabel*>(&storage[static_cast<std::size_t>(node) * portsPerNode + index]); }
+        ConnectionItem* connection(int node, int index) { return reinterpret_cast<ConnectionItem*>(&storage[static_cast<std::size_t>(node) * portsPerNode + index]); }
+
+        std::vector<char> storage;
+    };
+
+    void
+    fill(MapDescriptor& d, FakeGraph& graph, int node)
+    {
+        for (int i = 0; i < inputsPerNode; ++i)
+            d.inputs[graph.port(node, i)].push_back(graph.connection(node, i));
+        d.outputs[graph.port(node, inputsPerNode)].push_back(graph.connection(node, inputsPerNode));
+        for (int i = inputsPerNode + 1; i < portsPerNode; ++i)
+            d.parameters[graph.port(node, i)] = {};
+    }
+
+    void
+    fill(NodeDescriptor& d, FakeGraph& graph, int node)
+    {
+        for (int i = 0; i < inputsPerNode; ++i)
+            d.ports.addConnection(graph.port(node, i), PortTable::Kind::Input, graph.connection(node, i));
+        d.ports.addConnection(graph.port(node, inputsPerNode), PortTable::Kind::Output, graph.connection(node, inputsPerNode));
+        for (int i = inputsPerNode + 1; i < portsPerNode; ++i)
+            d.ports.addPort(graph.port(node, i), PortTable::Kind::Parameter);
+    }
+
+    // Bytes currently allocated from the heap (0 where unsupported).
+    double
+    heapInUse()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return static_cast<double>(mallinfo2().uordblks);
+#else
+        return 0.0;
+#endif
+    }
+
+    template <typename Descriptor>
+    std::vector<std::unique_ptr<Descriptor>>
+    build(FakeGraph& graph, int count)
+    {
+        std::vector<std::unique_ptr<Descriptor>> nodes;
+        nodes.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            nodes.push_back(std::make_unique<Descriptor>());
+            fill(*nodes.back(), graph, i);
+        }
+        return nodes;
+    }
+
+    // Heap bytes per node, descriptor included.
+    template <typename Descriptor>
+    void
+    memoryPerNode(benchmark::State& state)
+    {
+        const auto count = static_cast<int>(state.range(0));
+        FakeGraph graph(count);
+        double bytes = 0.0;
+        for (auto _ : state)
+        {
+            const double before = heapInUse();
+            auto nodes = build<Descriptor>(graph, count);
+            bytes = heapInUse() - before;
+            benchmark::DoNotOptimize(nodes.data());
+        }
+        state.counters["bytes_per_node"] = bytes / count;
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    std::size_t
+    visit(const MapDescriptor& d)
+    {
+        std::size_t sum = 0;
+        for (const auto* map : {&d.inputs, &d.outputs, &d.parameters})
+            for (auto it = map->cbegin(); it != map->cend(); ++it)
+                for (ConnectionItem* c : it.value())
+                    sum += reinterpret_cast<quintptr>(c) ^ reinterpret_cast<quintptr>(it.key());
+        return sum;
+    }
+
+    std::size_t
+    visit(const NodeDescriptor& d)
+    {
+        std::size_t sum = 0;
+        for (int i = 0; i < d.ports.portCount(); ++i)
+            for (ConnectionItem* c : d.ports.connectionsAt(i))
+                sum += reinterpret_cast<quintptr>(c) ^ reinterpret_cast<quintptr>(d.ports.portAt(i).port);
+        return sum;
+    }
+
+    // Every connection of every node with its port, as GraphRegistry::nodeMoved and snapshots walk them.
+    template <typename Descriptor>
+    void
+    iterateConnections(benchmark::State& state)
+    {
+        const auto count = static_cast<int>(state.range(0));
+        FakeGraph graph(count);
+        const auto nodes = build<Descriptor>(graph, count);
+        for (auto _ : state)
+        {
+            std::size_t sum = 0;
+            for (const auto& d : nodes)
+                sum += visit(*d);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    int
+    lookup(const MapDescriptor& d, PortLabel* port)
+    {
+        int found = 0;
+        for (const auto* map : {&d.inputs, &d.outputs, &d.parameters})
+        {
+            const auto it = map->constFind(port);
+            if (it != map->cend())
+                found += it.value().size();
+        }
+        return found;
+    }
+
+    int
+    lookup(const NodeDescriptor& d, PortLabel* port)
+    {
+        return d.ports.connections(port).size();
+    }
+
+    // Connections of one port per node, as GraphRegistry::getConnections and hasConnection look them up.
+    template <typename Descriptor>
+    void
+    lookupPort(benchmark::State& state)
+    {
+        const auto count = static_cast<int>(state.range(0));
+        FakeGraph graph(count);
+        const auto nodes = build<Descriptor>(graph, count);
+        for (auto _ : state)
+        {
+            int found = 0;
+            for (int i = 0; i < count; ++i)
+                found += lookup(*nodes[static_cast<std::size_t>(i)], graph.port(i, inputsPerNode));
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+} // namespace
+
+static void
+BM_MemoryMapLayout(benchmark::State& state)
+{
+    memoryPerNode<MapDescriptor>(state);
+}
+BENCHMARK(BM_MemoryMapLayout)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_MemoryFlatLayout(benchmark::State& state)
+{
+    memoryPerNode<NodeDescriptor>(state);
+}
+BENCHMARK(BM_MemoryFlatLayout)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_IterateMapLayout(benchmark::State& state)
+{
+    iterateConnections<MapDescriptor>(state);
+}
+BENCHMARK(BM_IterateMapLayout)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void
+BM_IterateFlatLayout(benchmark::State& state)
+{
+    iterateConnections<NodeDescriptor>(state);
+}
+BENCHMARK(BM_IterateFlatLayout)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void
+BM_LookupMapLayout(benchmark::State& state)
+{
+    lookupPort<MapDescriptor>(state);
+}
+BENCHMARK(BM_LookupMapLayout)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void
+BM_LookupFlatLayout(benchmark::State& state)
+{
+    lookupPort<NodeDescriptor>(state);
+}
+BENCHMARK(BM_LookupFlatLayout)->Arg(1000)->Arg(10000)->Arg(100000);
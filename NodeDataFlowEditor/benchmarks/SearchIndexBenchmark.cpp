@@ -0,0 +1,87 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/SearchIndex.hpp"
+
+#include <QString>
+#include <QStringList>
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr int termCount = 100000;
+
+    /// 100k names built from a small vocabulary, so common words hit thousands of terms.
+    const SearchIndex& index()
+    {
+        static const SearchIndex built = [] {
+            const QStringList words = {"add",    "multiply", "filter", "blur",   "sharpen", "threshold", "resize",
+                                       "convert", "merge",   "split",  "load",   "save",    "camera",    "display",
+                                       "gain",    "offset",  "clamp",  "noise",  "median",  "gauss"};
+            SearchIndex idx;
+            quint32 seed = 1;
+            auto next = [&seed] { return (seed = seed * 1664525u + 1013904223u) >> 8; };
+            for (int i = 0; i < termCount; ++i)
+            {
+                const QString name = words[int(next() % words.size())] + "_" + words[int(next() % words.size())] +
+                                     QString::number(i);
+                idx.addTerm(i / 4, SearchHit::Field::Name, name);
+            }
+            return idx;
+        }();
+        return built;
+    }
+} // namespace
+
+static void
+BM_SearchIndex(benchmark::State& state, const char* query)
+{
+    const SearchIndex& idx = index();
+    const QString q = QString::fromLatin1(query);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(idx.search(q, 20));
+}
+BENCHMARK_CAPTURE(BM_SearchIndex, Selective, "sharpen_clamp9")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SearchIndex, CommonWord, "multiply")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SearchIndex, ShortPrefix, "ga")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SearchIndex, Typo, "blr_gain")->Unit(benchmark::kMicrosecond);
+
+// What findNode() does for a fuzzy lookup without an index: scan and compare every name.
+static void
+BM_LinearScan(benchmark::State& state)
+{
+    QStringList names;
+    names.reserve(termCount);
+    for (int i = 0; i < termCount; ++i)
+        names.append(QStringLiteral("multiply_gain%1").arg(i));
+    const QString q = QStringLiteral("gain9999");
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (const QString& name : std::as_const(names))
+            hits += name.contains(q, Qt::CaseInsensitive);
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_LinearScan)->Unit(benchmark::kMicrosecond);
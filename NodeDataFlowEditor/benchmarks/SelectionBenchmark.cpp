@@ -0,0 +1,88 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "factory/NodeFactory.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/SelectionDispatcher.hpp"
+
+#include <QApplication>
+#include <QKeyEvent>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct SelectionScene
+    {
+        explicit SelectionScene(int count)
+            : scene(std::make_unique<GraphScene>())
+        {
+            auto factory = scene->getNodeFactory();
+            factory->setLazyParameterWidgets(true);
+            nodes.reserve(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i)
+            {
+                nodes.push_back(factory->createNode(scene.get(), QStringLiteral("N%1").arg(i), Qt::darkCyan, QPointF((i % 200) * 220.0, (i / 200) * 120.0)));
+                factory->addInput(*nodes.back(), "in");
+                factory->addOutput(*nodes.back(), "out");
+            }
+        }
+
+        std::unique_ptr<GraphScene> scene;
+        std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    };
+} // namespace
+
+// Ctrl+A on N nodes: every node is selected, each presenter hears about it once.
+static void
+BM_SelectAll(benchmark::State& state)
+{
+    SelectionScene fixture(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        QKeyEvent selectAll(QEvent::KeyPress, Qt::Key_A, Qt::ControlModifier);
+        QApplication::sendEvent(fixture.scene.get(), &selectAll);
+
+        state.PauseTiming();
+        fixture.scene->clearSelection();
+        state.ResumeTiming();
+    }
+    state.counters["notifications"] = static_cast<double>(fixture.scene->selectionDispatcher()->notifications());
+}
+BENCHMARK(BM_SelectAll)->Arg(2000)->Arg(20000)->Unit(benchmark::kMillisecond);
+
+// Clearing a one-node selection and selecting a node: costs the changed nodes only, not one slot call per node.
+static void
+BM_SelectSingle(benchmark::State& state)
+{
+    SelectionScene fixture(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        fixture.scene->clearSelection();
+        fixture.nodes.front()->item->setSelected(true);
+    }
+}
+BENCHMARK(BM_SelectSingle)->Arg(20000)->Unit(benchmark::kMicrosecond);
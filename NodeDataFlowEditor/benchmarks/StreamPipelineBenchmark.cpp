@@ -0,0 +1,95 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/StreamPipeline.hpp"
+#include "view/GraphScene.hpp"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct StreamBenchTag
+    {};
+
+    constexpr int frameCount = 200;
+    constexpr int stageCount = 3;
+
+    void
+    busyWait(std::chrono::microseconds duration)
+    {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+    }
+}
+
+// Three 200 µs stages streaming 200 frames; with pipelining a frame costs
+// about one stage, not three. range(0) is the per-edge queue capacity.
+static void
+BM_StreamThreeStages(benchmark::State& state)
+{
+    GraphScene scene;
+    auto factory = scene.getNodeFactory();
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    for (int i = 0; i < stageCount; ++i)
+    {
+        auto node = factory->createNode(&scene, QString("Stage%1").arg(i));
+        factory->addInput(*node, "in");
+        factory->addInputTag<StreamBenchTag>(*node, "in");
+        factory->addOutput(*node, "out");
+        factory->addOutputTag<StreamBenchTag>(*node, "out");
+        if (!nodes.empty())
+            factory->createConnection(scene,
+                                      *factory->getOutputPortByName(*nodes.back(), "out"),
+                                      *factory->getInputPortByName(*node, "in"),
+                                      false);
+        nodes.push_back(std::move(node));
+    }
+    const auto snapshot = scene.getGraphRegistry()->snapshot();
+
+    for (auto _ : state)
+    {
+        StreamPipeline pipeline(snapshot, static_cast<int>(state.range(0)));
+        for (int i = 0; i < stageCount; ++i)
+        {
+            pipeline.setStage(QString("Stage%1").arg(i), [](StreamFrame& frame) {
+                busyWait(std::chrono::microseconds(200));
+                frame.setOutput("out", frame.input("in"));
+                if (frame.index() + 1 == frameCount)
+                    frame.finish();
+            });
+        }
+        pipeline.start();
+        pipeline.waitForFinished();
+    }
+    state.SetItemsProcessed(state.iterations() * frameCount);
+}
+BENCHMARK(BM_StreamThreeStages)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,130 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/Symbol.hpp"
+#include "view/ConnectionPort.hpp"
+
+#include <QString>
+#include <QVector>
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr int portCount = 64;
+
+    QVector<QString> portNames()
+    {
+        QVector<QString> names;
+        names.reserve(portCount);
+        for (int i = 0; i < portCount; ++i)
+            names.append(QStringLiteral("ImageProcessingNode_%1").arg(i));
+        return names;
+    }
+} // namespace
+
+// Forwarded-port match as done on connect before interning: one concatenation per candidate.
+static void
+BM_ForwardedMatchConcat(benchmark::State& state)
+{
+    const QVector<QString> names = portNames();
+    const QString module = QStringLiteral("Blur");
+    const QString target = module + "_" + names.last();
+    for (auto _ : state)
+    {
+        int hit = -1;
+        for (int i = 0; i < names.size(); ++i)
+            if ((module + "_" + names[i]) == target)
+                hit = i;
+        benchmark::DoNotOptimize(hit);
+    }
+}
+BENCHMARK(BM_ForwardedMatchConcat);
+
+// Same match against precomputed forwarded-name symbols.
+static void
+BM_ForwardedMatchSymbol(benchmark::State& state)
+{
+    const QVector<QString> names = portNames();
+    QVector<Symbol> forwarded;
+    for (const QString& n : names)
+        forwarded.append(Symbol(QStringLiteral("Blur_") + n));
+    const Symbol target(QStringLiteral("Blur_") + names.last());
+    for (auto _ : state)
+    {
+        int hit = -1;
+        for (int i = 0; i < forwarded.size(); ++i)
+            if (forwarded[i] == target)
+                hit = i;
+        benchmark::DoNotOptimize(hit);
+    }
+}
+BENCHMARK(BM_ForwardedMatchSymbol);
+
+// Connection lookup by endpoint name (findConnection / hasConnectionTo), string keys.
+static void
+BM_EndpointCompareString(benchmark::State& state)
+{
+    const QVector<QString> names = portNames();
+    const QString module = QStringLiteral("Blur");
+    const QString wanted = names.last();
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (const QString& n : names)
+            hits += (n == wanted && module == QLatin1String("Blur")) ? 1 : 0;
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_EndpointCompareString);
+
+static void
+BM_EndpointCompareSymbol(benchmark::State& state)
+{
+    QVector<ConnectionPort> ports;
+    for (const QString& n : portNames())
+        ports.append(ConnectionPort(QPointF(), QRectF(), n, "Blur", true));
+    const Symbol wanted = ports.last().portName;
+    const Symbol module("Blur");
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (const ConnectionPort& p : ports)
+            hits += (p.portName == wanted && p.moduleName == module) ? 1 : 0;
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_EndpointCompareSymbol);
+
+// Drag feedback copies ConnectionPort on every mouse move (inputPort()/outputPort()).
+static void
+BM_ConnectionPortCopy(benchmark::State& state)
+{
+    const ConnectionPort port(QPointF(1, 2), QRectF(0, 0, 10, 10), "ImageProcessingNode_1", "Blur", false);
+    for (auto _ : state)
+    {
+        ConnectionPort copy = port;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ConnectionPortCopy);
@@ -0,0 +1,45 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/WireRouter.hpp"
+
+#include <QVector>
+#include <benchmark/benchmark.h>
+
+// One route across a dense grid of nodes, as computed per wire on the routing thread.
+static void
+BM_WireRouteDenseGrid(benchmark::State& state)
+{
+    const auto side = static_cast<int>(state.range(0));
+    QVector<QRectF> nodes;
+    for (int i = 0; i < side; ++i)
+        for (int j = 0; j < side; ++j)
+            nodes.append(QRectF(i * 200, j * 150, 120, 80));
+    const WireRouter router(nodes);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(router.route(QPointF(120, 40), QPointF(200 * (side / 2), 150 * (side / 2) + 40)));
+    state.counters["obstacles"] = router.obstacleCount();
+}
+BENCHMARK(BM_WireRouteDenseGrid)->Arg(20)->Arg(100)->Unit(benchmark::kMicrosecond);
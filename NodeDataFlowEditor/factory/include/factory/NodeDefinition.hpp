@@ -0,0 +1,166 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "factory/NodeFactory.hpp"
+#include "taggable/TagRegistry.hpp"
+
+#include <QColor>
+#include <QString>
+#include <array>
+#include <cstddef>
+#include <tuple>
+
+/**
+ * @brief Declarative node types.
+ *
+ * A node definition is a struct naming the node, its title color and its
+ * ports. Port tags and parameter widget types are template arguments, so
+ * NodeFactory::create() adds every port with its tag mask already set in a
+ * single pass instead of adding ports by name and tagging them afterwards:
+ *
+ * @code
+ * struct ResizeNode
+ * {
+ *     static constexpr const char* name = "Resize";
+ *     static constexpr QRgb color = qRgb(70, 160, 230);
+ *     static constexpr auto ports = std::make_tuple(
+ *         nodedef::Input<data::ImageType>{"image", "input image"},
+ *         nodedef::Output<data::ImageType>{"image", "output image"},
+ *         nodedef::Parameter<QSpinBox, data::ValueWrapper<int>>{"width", "kernel width",
+ *                                                              [](QSpinBox* w) { w->setRange(16, 8192); }});
+ * };
+ *
+ * auto resize = factory->create<ResizeNode>(scene, QPointF(320, 60));
+ * @endcode
+ *
+ * Tag indices are assigned by TagRegistry at run time; the mask of each
+ * declared tag list is computed on first use and then reused for every node.
+ */
+namespace nodedef
+{
+    /**
+     * @brief Input port carrying @p Tags.
+     */
+    template <typename... Tags>
+    struct Input
+    {
+        const char* name;
+        const char* displayName = nullptr; ///< Defaults to the name.
+    };
+
+    /**
+     * @brief Output port carrying @p Tags.
+     */
+    template <typename... Tags>
+    struct Output
+    {
+        const char* name;
+        const char* displayName = nullptr; ///< Defaults to the name.
+    };
+
+    /**
+     * @brief Parameter port edited by a default-constructed @p Widget, carrying @p Tags.
+     */
+    template <typename Widget, typename... Tags>
+    struct Parameter
+    {
+        const char* name;
+        const char* displayName = nullptr; ///< Defaults to the name.
+        void (*setup)(Widget*) = nullptr;  ///< Configures every new widget (range, initial value...).
+    };
+
+    namespace detail
+    {
+        struct PortNames
+        {
+            QString name;
+            QString displayName;
+        };
+
+        template <typename Port>
+        PortNames namesOf(const Port& port)
+        {
+            const QString name = QString::fromUtf8(port.name);
+            return {name, port.displayName ? QString::fromUtf8(port.displayName) : name};
+        }
+
+        /// Port names of @p Definition, converted once and shared by every node of that type.
+        template <typename Definition>
+        const auto& portNames()
+        {
+            static const auto names = std::apply(
+                [](const auto&... port) { return std::array<PortNames, sizeof...(port)>{namesOf(port)...}; },
+                Definition::ports);
+            return names;
+        }
+
+        template <typename... Tags>
+        void addPort(NodeFactory& factory, const NodeFactory::Node& node, const Input<Tags...>&, const PortNames& names)
+        {
+            factory.addInput(node, names.name, names.displayName, TagRegistry::maskOf<Tags...>());
+        }
+
+        template <typename... Tags>
+        void addPort(NodeFactory& factory, const NodeFactory::Node& node, const Output<Tags...>&, const PortNames& names)
+        {
+            factory.addOutput(node, names.name, names.displayName, TagRegistry::maskOf<Tags...>());
+        }
+
+        template <typename Widget, typename... Tags>
+        void addPort(NodeFactory& factory,
+                     const NodeFactory::Node& node,
+                     const Parameter<Widget, Tags...>& port,
+                     const PortNames& names)
+        {
+            auto* widget = new Widget();
+            if (port.setup)
+                port.setup(widget);
+            factory.addParameter(node, widget, names.name, names.displayName, TagRegistry::maskOf<Tags...>());
+        }
+    } // namespace detail
+} // namespace nodedef
+
+template <typename Definition>
+std::unique_ptr<NodeFactory::Node>
+NodeFactory::create(GraphScene* scene, const QPointF& pos)
+{
+    static const QString name = QString::fromUtf8(Definition::name);
+    auto node = createNode(scene, name, QColor::fromRgb(Definition::color), pos);
+    if (!node->item)
+        return node;
+
+    const auto& names = nodedef::detail::portNames<Definition>();
+    // Every port would otherwise relayout the node; lay it out once, at the end.
+    NodeItem::DeferredLayout layout(node->item);
+    std::apply(
+        [&](const auto&... port) {
+            std::size_t index = 0;
+            (nodedef::detail::addPort(*this, *node, port, names[index++]), ...);
+        },
+        Definition::ports);
+    return node;
+}
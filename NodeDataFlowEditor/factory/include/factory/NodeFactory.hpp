@@ -118,6 +118,27 @@ public:
                                      const QColor& color = Qt::darkCyan,
                                      const QPointF& pos = QPointF(0, 0));
 
+    /**
+     * @brief Create a node of a declared type in one pass.
+     * @tparam Definition Node definition, see NodeDefinition.hpp (which defines this function).
+     * @param scene Target Scene where the node will be added.
+     * @param pos Scene position for the new node (default: origin).
+     * @return A unique_ptr to the created Node structure.
+     *
+     * Ports are added in declaration order with their tags already set and
+     * parameter widgets are built from their declared types; no port is
+     * looked up by name.
+     */
+    template <typename Definition>
+    std::unique_ptr<Node> create(GraphScene* scene, const QPointF& pos = QPointF(0, 0));
+
+    /**
+     * @brief Create subsequent nodes with lazy parameter widgets.
+     * @param lazy True to paint parameter snapshots until a widget is hovered.
+     * @see NodeItem::setLazyParameters
+     */
+    void setLazyParameterWidgets(bool lazy);
+
     // ================================
     // Port manipulation (Model-driven)
     // ================================
@@ -169,6 +190,38 @@ public:
      */
     void addParameter(const Node& node, QWidget* widget, const QString& name, const QString& displayedName);
 
+    /**
+     * @brief Add an input port that starts with the given tags.
+     * @param node Target node.
+     * @param name Port name to add.
+     * @param displayedName Port displayed name.
+     * @param tags Tags of the new port, e.g. from TagRegistry::maskOf().
+     */
+    void addInput(const Node& node, const QString& name, const QString& displayedName, const TagBitMask& tags);
+
+    /**
+     * @brief Add an output port that starts with the given tags.
+     * @param node Target node.
+     * @param name Port name to add.
+     * @param displayedName Port displayed name.
+     * @param tags Tags of the new port, e.g. from TagRegistry::maskOf().
+     */
+    void addOutput(const Node& node, const QString& name, const QString& displayedName, const TagBitMask& tags);
+
+    /**
+     * @brief Add a parameter port that starts with the given tags.
+     * @param node Target node.
+     * @param widget Associated parameter widget (e.g., slider, combo box).
+     * @param name Port name to add.
+     * @param displayedName Port displayed name.
+     * @param tags Tags of the new port, e.g. from TagRegistry::maskOf().
+     */
+    void addParameter(const Node& node,
+                      QWidget* widget,
+                      const QString& name,
+                      const QString& displayedName,
+                      const TagBitMask& tags);
+
     /**
      * @brief Create a connection between two ports.
      * @param scene Target scene where the connection will be created.
@@ -268,6 +321,7 @@ public:
             if (port->name() == portName)
             {
                 port->template addTag<TAG>();
+                markTagsChanged(node);
                 break;
             }
         }
@@ -286,6 +340,7 @@ public:
             if (port->name() == portName)
             {
                 port->template addTag<TAG>();
+                markTagsChanged(node);
                 break;
             }
         }
@@ -305,6 +360,7 @@ public:
             if (port->name() == portName)
             {
                 port->template addTag<TAG>();
+                markTagsChanged(node);
                 break;
             }
         }
@@ -336,6 +392,12 @@ public:
     void removeParameter(const Node& node, const QString& name);
 
 private:
+    /**
+     * @brief Flags @p node so the next registry snapshot picks up its new port tags.
+     */
+    void markTagsChanged(const Node& node);
+
     GraphScene* m_scene{nullptr}; ///< Cached pointer to the active scene.
     std::shared_ptr<GraphRegistry> m_registry;
+    bool m_lazyParameterWidgets{false}; ///< Applied to every node created afterwards.
 };
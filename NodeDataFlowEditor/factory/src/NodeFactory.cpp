@@ -94,6 +94,7 @@ NodeFactory::createNode(GraphScene* scene,
 
     // View NodeItem
     out->item = new NodeItem(m_registry, nodeName, displayedName, color);
+    out->item->setLazyParameters(m_lazyParameterWidgets);
     out->item->setPos(pos);
     scene->addItem(out->item);
 
@@ -122,6 +123,12 @@ NodeFactory::createNode(GraphScene* scene,
     return createNode(scene, nodeName, nodeName, color, pos);
 }
 
+void
+NodeFactory::setLazyParameterWidgets(bool lazy)
+{
+    m_lazyParameterWidgets = lazy;
+}
+
 void
 NodeFactory::addInput(const Node& node, const QString& name, const QString& displayedName)
 {
@@ -143,6 +150,31 @@ NodeFactory::addParameter(const Node& node, QWidget* widget, const QString& name
         node.model->addParam(name, displayedName, widget, PortSpec::Kind::Param);
 }
 
+void
+NodeFactory::addInput(const Node& node, const QString& name, const QString& displayedName, const TagBitMask& tags)
+{
+    if (node.model)
+        node.model->addPort(name, displayedName, PortSpec::Kind::Input, tags);
+}
+
+void
+NodeFactory::addOutput(const Node& node, const QString& name, const QString& displayedName, const TagBitMask& tags)
+{
+    if (node.model)
+        node.model->addPort(name, displayedName, PortSpec::Kind::Output, tags);
+}
+
+void
+NodeFactory::addParameter(const Node& node,
+                          QWidget* widget,
+                          const QString& name,
+                          const QString& displayedName,
+                          const TagBitMask& tags)
+{
+    if (node.model)
+        node.model->addParam(name, displayedName, widget, PortSpec::Kind::Param, tags);
+}
+
 void
 NodeFactory::addInput(const Node& node, const QString& name)
 {
@@ -239,17 +271,8 @@ NodeFactory::getParameterPortByName(const Node& node, const QString& portName)
 void
 NodeFactory::disableWidgetOfConnectedParametersInput(NodeItem* item)
 {
-    for (auto* pPort : item->parameterPorts().keys())
-    {
-        if (m_registry->hasConnection(pPort))
-        {
-            item->parameterPorts().value(pPort)->setEnabled(false);
-        }
-        else
-        {
-            item->parameterPorts().value(pPort)->setEnabled(true);
-        }
-    }
+    for (auto* pPort : item->paramsInputs())
+        item->setParameterEnabled(pPort, !m_registry->hasConnection(pPort));
 }
 
 ConnectionItem*
@@ -271,7 +294,7 @@ NodeFactory::createConnectionBetweenPorts(PortLabel* fromPort, PortLabel* toPort
     {
         for (auto p : std::as_const(fwdFromports))
         {
-            if ((p->moduleName() + "_" + p->name()) == fromPort->name())
+            if (p->forwardedNameSymbol() == fromPort->nameSymbol())
             {
                 concreteFrom = p;
                 break;
@@ -282,7 +305,7 @@ NodeFactory::createConnectionBetweenPorts(PortLabel* fromPort, PortLabel* toPort
     {
         for (auto p : std::as_const(fwdToports))
         {
-            if ((p->moduleName() + "_" + p->name()) == toPort->name())
+            if (p->forwardedNameSymbol() == toPort->nameSymbol())
             {
                 concreteTo = p;
                 break;
@@ -329,6 +352,13 @@ NodeFactory::createConnectionBetweenPorts(PortLabel* fromPort, PortLabel* toPort
     return connection;
 }
 
+void
+NodeFactory::markTagsChanged(const Node& node)
+{
+    if (node.item)
+        m_registry->markDirty(node.item);
+}
+
 void
 NodeFactory::removeInput(const Node& node, const QString& name)
 {
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include "taggable/TagRegistry.hpp"
+
 #include <QColor>
 #include <QObject>
 #include <QPointF>
@@ -52,6 +54,7 @@ struct PortSpec
     QString name;        ///< Name of the port.
     QString displayName; ///< Display name of the port.
     Kind kind;           ///< Type of the port.
+    TagBitMask tags{};   ///< Tags the view port starts with.
 };
 
 /**
@@ -165,8 +168,9 @@ public slots:
      * @param name Name of the port.
      * @param displayName Display name of the port.
      * @param kind Type of the port (Input, Output, or Param).
+     * @param tags Tags the port starts with.
      */
-    void addPort(const QString& name, const QString& displayName, PortSpec::Kind kind);
+    void addPort(const QString& name, const QString& displayName, PortSpec::Kind kind, TagBitMask tags = {});
 
     /**
      * @brief Add a new parameter port with an associated widget.
@@ -174,8 +178,9 @@ public slots:
      * @param displayName Display name of the parameter.
      * @param widget Pointer to the associated input widget.
      * @param kind Type of the port (typically Param).
+     * @param tags Tags the port starts with.
      */
-    void addParam(const QString& name, const QString& displayName, QWidget* widget, PortSpec::Kind kind);
+    void addParam(const QString& name, const QString& displayName, QWidget* widget, PortSpec::Kind kind, TagBitMask tags = {});
 
     /**
      * @brief Remove a port from the node.
@@ -0,0 +1,166 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "utility/GraphIds.hpp"
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVariant>
+#include <QVector>
+
+/**
+ * @brief Identifies one value of a parameter port.
+ *
+ * A port edited by a single widget has one value, leaf 0. A port whose widget
+ * is a container has one value per editor inside it, numbered in the order
+ * the editors were bound, so sibling editors never share a value.
+ */
+struct ParameterKey
+{
+    PortId port = invalidGraphId; ///< Registry id of the parameter port.
+    int leaf = 0;                 ///< Editor within the port's widget.
+
+    ParameterKey() = default;
+    ParameterKey(PortId p, int l = 0) // NOLINT(google-explicit-constructor)
+        : port(p)
+        , leaf(l)
+    {}
+
+    friend bool operator==(const ParameterKey& a, const ParameterKey& b)
+    {
+        return a.port == b.port && a.leaf == b.leaf;
+    }
+    friend bool operator!=(const ParameterKey& a, const ParameterKey& b) { return !(a == b); }
+};
+
+inline size_t
+qHash(const ParameterKey& key, size_t seed = 0) noexcept
+{
+    return qHash(key.port ^ (quint64(quint32(key.leaf)) << 40), seed);
+}
+
+/**
+ * @brief Typed value store for parameter ports, keyed by registry port id and leaf.
+ *
+ * Each parameter editor owns one value (int, double, bool, string, enum index,
+ * date, time or date-time) under its ParameterKey. Editors write the store instead of talking to each
+ * other: pending writes are coalesced and announced once per frame, together
+ * with the object that made the write, so views can refresh every editor of
+ * that value but the one the user is typing into. The store knows nothing about
+ * widgets; ParameterBinder attaches them.
+ */
+class ParameterStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Kind of value held for a port.
+     */
+    enum class ValueType : uint8_t
+    {
+        Invalid,  ///< No editable value.
+        Int,      ///< Integer, e.g. spin box or slider position.
+        Double,   ///< Floating point.
+        Bool,     ///< Checked state.
+        String,   ///< Text.
+        Enum,     ///< Index into a list of choices.
+        Date,     ///< QDate.
+        Time,     ///< QTime.
+        DateTime  ///< QDateTime.
+    };
+
+    explicit ParameterStore(QObject* parent = nullptr);
+
+    /**
+     * @brief Start tracking @p key with an initial @p value.
+     * @return False if @p type is Invalid or the key is already known.
+     */
+    bool addPort(ParameterKey key, ValueType type, const QVariant& value);
+
+    /**
+     * @brief Forget every value of @p port.
+     */
+    void removePort(PortId port);
+
+    /**
+     * @brief True if @p key has a value in the store.
+     */
+    bool contains(ParameterKey key) const;
+
+    /**
+     * @brief Value kind of @p key, or Invalid if unknown.
+     */
+    ValueType type(ParameterKey key) const;
+
+    /**
+     * @brief Write a value for @p key; it is announced on the next frame.
+     * @param origin Object that made the edit, reported back by sgnValueChanged().
+     */
+    void setValue(ParameterKey key, const QVariant& value, QObject* origin = nullptr);
+
+    /**
+     * @brief Current value of @p key, or an invalid QVariant if unknown.
+     */
+    QVariant value(ParameterKey key) const;
+
+    /**
+     * @brief Number of leaves of @p port, one past the highest leaf added; 0 if unknown.
+     */
+    int leafCount(PortId port) const;
+
+    /**
+     * @brief Announce every pending value now.
+     */
+    void flush();
+
+signals:
+    /**
+     * @brief Emitted once per flushed key with its coalesced value and the object that wrote it last.
+     */
+    void sgnValueChanged(ParameterKey key, const QVariant& value, QObject* origin);
+
+    /**
+     * @brief Emitted by removePort(), after every value of @p port is gone.
+     */
+    void sgnPortRemoved(PortId port);
+
+private:
+    struct Entry
+    {
+        QVariant value;
+        ValueType type = ValueType::Invalid;
+        QPointer<QObject> origin; ///< Object that produced the pending value.
+        bool pending = false;
+    };
+
+    QHash<ParameterKey, Entry> m_entries; ///< Value per port leaf.
+    QHash<PortId, int> m_leafCounts;      ///< One past the highest leaf added per port.
+    QVector<ParameterKey> m_pending;      ///< Keys written since the last flush.
+    QTimer m_frameTimer;                  ///< Coalesces writes to one flush per frame.
+};
@@ -82,17 +82,17 @@ NodeModel::setPosition(const QPointF& p)
 }
 
 void
-NodeModel::addPort(const QString& name, const QString& displayName, PortSpec::Kind kind)
+NodeModel::addPort(const QString& name, const QString& displayName, PortSpec::Kind kind, TagBitMask tags)
 {
-    PortSpec ps{name, displayName, kind};
+    PortSpec ps{name, displayName, kind, tags};
     m_ports.push_back(ps);
     emit portAdded(ps);
 }
 
 void
-NodeModel::addParam(const QString& name, const QString& displayName, QWidget* widget, PortSpec::Kind kind)
+NodeModel::addParam(const QString& name, const QString& displayName, QWidget* widget, PortSpec::Kind kind, TagBitMask tags)
 {
-    ParamSpec ps{{name, displayName, kind}, widget};
+    ParamSpec ps{{name, displayName, kind, tags}, widget};
     m_params.push_back(ps);
     emit paramAdded(ps);
 }
@@ -0,0 +1,134 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "model/ParameterStore.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+constexpr int frameIntervalMs = 16;
+}
+
+ParameterStore::ParameterStore(QObject* parent)
+    : QObject(parent)
+{
+    m_frameTimer.setSingleShot(true);
+    m_frameTimer.setInterval(frameIntervalMs);
+    connect(&m_frameTimer, &QTimer::timeout, this, &ParameterStore::flush);
+}
+
+bool
+ParameterStore::addPort(ParameterKey key, ValueType type, const QVariant& value)
+{
+    if (key.port == invalidGraphId || key.leaf < 0 || type == ValueType::Invalid || m_entries.contains(key))
+        return false;
+
+    Entry& entry = m_entries[key];
+    entry.type = type;
+    entry.value = value;
+    int& leafCount = m_leafCounts[key.port];
+    leafCount = std::max(leafCount, key.leaf + 1);
+    return true;
+}
+
+void
+ParameterStore::removePort(PortId port)
+{
+    const int leafCount = m_leafCounts.take(port);
+    if (leafCount == 0)
+        return;
+
+    for (int leaf = 0; leaf < leafCount; ++leaf)
+        m_entries.remove({port, leaf});
+    m_pending.erase(std::remove_if(m_pending.begin(),
+                                   m_pending.end(),
+                                   [port](const ParameterKey& key) { return key.port == port; }),
+                    m_pending.end());
+    emit sgnPortRemoved(port);
+}
+
+bool
+ParameterStore::contains(ParameterKey key) const
+{
+    return m_entries.contains(key);
+}
+
+ParameterStore::ValueType
+ParameterStore::type(ParameterKey key) const
+{
+    return m_entries.value(key).type;
+}
+
+void
+ParameterStore::setValue(ParameterKey key, const QVariant& value, QObject* origin)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+
+    it->value = value;
+    it->origin = origin;
+    if (!it->pending)
+    {
+        it->pending = true;
+        m_pending.append(key);
+    }
+    if (!m_frameTimer.isActive())
+        m_frameTimer.start();
+}
+
+QVariant
+ParameterStore::value(ParameterKey key) const
+{
+    return m_entries.value(key).value;
+}
+
+int
+ParameterStore::leafCount(PortId port) const
+{
+    return m_leafCounts.value(port);
+}
+
+void
+ParameterStore::flush()
+{
+    m_frameTimer.stop();
+
+    const QVector<ParameterKey> keys = std::exchange(m_pending, {});
+    for (const ParameterKey& key : keys)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            continue;
+
+        it->pending = false;
+        QObject* origin = it->origin;
+        it->origin = nullptr;
+        const QVariant value = it->value;
+        // Receivers may add or remove ports, so nothing from the hash is used after emitting.
+        emit sgnValueChanged(key, value, origin);
+    }
+}
@@ -29,6 +29,16 @@
 
 #include <QPointF>
 
+namespace
+{
+    // Ports declared with tags get them in the same pass that creates them.
+    void applyTags(PortLabel* port, const TagBitMask& tags)
+    {
+        if (port && tags.any())
+            port->setTagBitMask(port->getTagBitMask() | tags);
+    }
+} // namespace
+
 NodePresenter::NodePresenter(NodeModel* model, INodeView* view, QObject* parent)
     : QObject(parent)
     , m_model(model)
@@ -68,12 +78,12 @@ NodePresenter::connectModelToView()
         {
             case PortSpec::Kind::Input:
             {
-                m_view->addInput(s.name, s.displayName);
+                applyTags(m_view->addInput(s.name, s.displayName), s.tags);
                 break;
             }
             case PortSpec::Kind::Output:
             {
-                m_view->addOutput(s.name, s.displayName);
+                applyTags(m_view->addOutput(s.name, s.displayName), s.tags);
                 break;
             }
             case PortSpec::Kind::Param:
@@ -87,7 +97,7 @@ NodePresenter::connectModelToView()
         switch (s.kind)
         {
             case PortSpec::Kind::Param:
-                m_view->addParam(s.widget, s.name, s.displayName);
+                applyTags(m_view->addParam(s.widget, s.name, s.displayName), s.tags);
                 break;
             case PortSpec::Kind::Input:
             case PortSpec::Kind::Output:
@@ -177,11 +187,11 @@ NodePresenter::addPortsMissingInView() const
         {
             case PortSpec::Kind::Input:
                 if (!viewInputs.contains(s.name))
-                    m_view->addInput(s.name);
+                    applyTags(m_view->addInput(s.name), s.tags);
                 break;
             case PortSpec::Kind::Output:
                 if (!viewOutputs.contains(s.name))
-                    m_view->addOutput(s.name);
+                    applyTags(m_view->addOutput(s.name), s.tags);
                 break;
             case PortSpec::Kind::Param:
                 break;
@@ -193,7 +203,7 @@ NodePresenter::addPortsMissingInView() const
         {
             case PortSpec::Kind::Param:
                 if (!viewParams.contains(s.name))
-                    m_view->addParam(s.widget, s.name);
+                    applyTags(m_view->addParam(s.widget, s.name), s.tags);
                 break;
             case PortSpec::Kind::Input:
             case PortSpec::Kind::Output:
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <bitset>
+#include <cstdint>
 #include <mutex>
 #include <stdexcept>
 #include <string_view>
@@ -90,6 +92,31 @@ public:
         return newIndex;
     }
 
+    /**
+     * @brief Bitmask of the given tag types, registering them if needed.
+     * @tparam Tags Tag types whose bits are set.
+     *
+     * The mask is computed once per tag list and cached until a tag is
+     * unregistered, so repeated calls take no lock and do no lookup.
+     */
+    template <typename... Tags>
+    static TagBitMask maskOf()
+    {
+        static_assert(MaxTags <= 32, "cached masks are packed into 32 bits");
+
+        // Generation in the high half, mask in the low half; updated as one word.
+        static std::atomic<std::uint64_t> cache{~std::uint64_t(0)};
+        const std::uint64_t current = generation.load(std::memory_order_acquire);
+        const std::uint64_t cached = cache.load(std::memory_order_acquire);
+        if ((cached >> 32) == current)
+            return TagBitMask(cached & 0xffffffffu);
+
+        TagBitMask mask;
+        (mask.set(getTagIndex<Tags>()), ...);
+        cache.store((current << 32) | mask.to_ulong(), std::memory_order_release);
+        return mask;
+    }
+
     /**
      * @brief Get the human-readable name of a tag type.
      * @tparam Tag The tag type.
@@ -139,6 +166,7 @@ public:
             size_t index = it->second;
             tagIndices.erase(it);
             indexToName.erase(index);
+            generation.fetch_add(1, std::memory_order_acq_rel);
         }
     }
 
@@ -150,6 +178,7 @@ public:
         std::lock_guard<std::mutex> lock(mutex_);
         tagIndices.clear();
         indexToName.clear();
+        generation.fetch_add(1, std::memory_order_acq_rel);
     }
 
     /**
@@ -166,4 +195,5 @@ private:
     static inline std::unordered_map<std::type_index, size_t> tagIndices; ///< Map from tag type to index.
     static inline std::unordered_map<size_t, const char*> indexToName;    ///< Map from index to tag name.
     static inline std::mutex mutex_;                                      ///< Mutex for thread-safe access.
+    static inline std::atomic<std::uint64_t> generation{0};               ///< Bumped when indices may be reused.
 };
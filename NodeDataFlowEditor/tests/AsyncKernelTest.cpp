@@ -0,0 +1,236 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "utility/AsyncKernel.hpp"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+    struct CountTag
+    {};
+
+    /**
+     * @brief Stand-in for a slow remote service: answers every request after a fixed latency, from its own thread.
+     */
+    class FakeSlowService
+    {
+    public:
+        explicit FakeSlowService(std::chrono::milliseconds latency)
+            : m_latency(latency)
+            , m_thread(QThread::create([this] { serve(); }))
+        {
+            m_thread->start();
+        }
+
+        ~FakeSlowService()
+        {
+            {
+                QMutexLocker lock(&m_mutex);
+                m_quit = true;
+                m_wakeUp.wakeOne();
+            }
+            m_thread->wait();
+        }
+
+        /// Asks for @p value doubled; the answer arrives after the service latency.
+        AsyncValue<int> doubled(int value)
+        {
+            AsyncValue<int> answer;
+            QMutexLocker lock(&m_mutex);
+            m_requests.push_back({Clock::now() + m_latency, value, answer});
+            m_wakeUp.wakeOne();
+            return answer;
+        }
+
+        int served() const { return m_served; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Request
+        {
+            Clock::time_point due;
+            int value;
+            AsyncValue<int> answer;
+        };
+
+        void serve()
+        {
+            QMutexLocker lock(&m_mutex);
+            while (!m_quit)
+            {
+                if (m_requests.empty())
+                {
+                    m_wakeUp.wait(&m_mutex);
+                    continue;
+                }
+                const auto left =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(m_requests.front().due - Clock::now());
+                if (left.count() > 0)
+                {
+                    m_wakeUp.wait(&m_mutex, static_cast<unsigned long>(left.count()));
+                    continue;
+                }
+                const Request request = m_requests.front();
+                m_requests.pop_front();
+                ++m_served;
+                request.answer.complete(request.value * 2);
+            }
+        }
+
+        const std::chrono::milliseconds m_latency;
+        QMutex m_mutex;
+        QWaitCondition m_wakeUp;
+        std::deque<Request> m_requests; ///< In due order: the latency is fixed.
+        std::atomic<int> m_served{0};
+        bool m_quit = false;
+        std::unique_ptr<QThread> m_thread;
+    };
+
+    KernelTask
+    askService(FakeSlowService* service, KernelContext ctx)
+    {
+        const int value = *ctx.input("in").get<int>();
+        const int answer = co_await service->doubled(value);
+        co_return KernelOutputs{{"out", Payload::make<CountTag>(answer)}};
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class AsyncKernelTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        executor = std::make_unique<AsyncExecutor>();
+        executor->setCompletionHandler([this](qint64 uid, const KernelOutputs& outputs) {
+            QMutexLocker lock(&mutex);
+            results.insert(uid, *outputs.value("out").get<int>());
+        });
+    }
+
+    void TearDown() override
+    {
+        executor.reset();
+    }
+
+    void submitAsk(FakeSlowService& service, qint64 uid, int value)
+    {
+        executor->submit(uid, [&service](KernelContext ctx) { return askService(&service, std::move(ctx)); },
+                         {{"in", Payload::make<CountTag>(value)}});
+    }
+
+    std::unique_ptr<AsyncExecutor> executor;
+    QMutex mutex;
+    QHash<qint64, int> results; ///< Guarded by mutex.
+};
+
+TEST_F(AsyncKernelTest, OneWorkerKeepsHundredsOfKernelsInFlight)
+{
+    constexpr int nodes = 300;
+    FakeSlowService service(std::chrono::milliseconds(50));
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+    for (int uid = 0; uid < nodes; ++uid)
+        submitAsk(service, uid, uid);
+    ASSERT_TRUE(executor->waitForIdle(10000));
+
+    // Run one after the other, 300 calls would take 15 s.
+    EXPECT_LT(elapsed.elapsed(), 3000);
+    EXPECT_EQ(executor->completedRuns(), quint64(nodes));
+    EXPECT_EQ(service.served(), nodes);
+    QMutexLocker lock(&mutex);
+    ASSERT_EQ(results.size(), nodes);
+    for (int uid = 0; uid < nodes; ++uid)
+        EXPECT_EQ(results.value(uid), uid * 2);
+}
+
+TEST_F(AsyncKernelTest, SleepResumesOnTheWorker)
+{
+    AsyncExecutor* exec = executor.get();
+    std::atomic<bool> onWorker{false};
+    const QThread* caller = QThread::currentThread();
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+    executor->submit(
+        7,
+        [exec, caller, &onWorker](KernelContext) -> KernelTask {
+            co_await exec->sleepFor(std::chrono::milliseconds(30));
+            onWorker = QThread::currentThread() != caller;
+            co_return KernelOutputs{{"out", Payload::make<CountTag>(1)}};
+        },
+        {});
+    ASSERT_TRUE(executor->waitForIdle(5000));
+
+    EXPECT_GE(elapsed.elapsed(), 30);
+    EXPECT_TRUE(onWorker);
+    QMutexLocker lock(&mutex);
+    EXPECT_EQ(results.value(7), 1);
+}
+
+TEST_F(AsyncKernelTest, NewInputsCancelTheRunInFlight)
+{
+    FakeSlowService service(std::chrono::milliseconds(50));
+
+    submitAsk(service, 1, 10);
+    submitAsk(service, 1, 20);
+    ASSERT_TRUE(executor->waitForIdle(5000));
+
+    EXPECT_EQ(executor->cancelledRuns(), 1u);
+    EXPECT_EQ(executor->completedRuns(), 1u);
+    QMutexLocker lock(&mutex);
+    EXPECT_EQ(results.value(1), 40);
+}
+
+TEST_F(AsyncKernelTest, FailingKernelIsCountedAndDropped)
+{
+    executor->submit(
+        3, [](KernelContext) -> KernelTask {
+            throw std::runtime_error("service unreachable");
+            co_return KernelOutputs{};
+        },
+        {});
+    ASSERT_TRUE(executor->waitForIdle(5000));
+
+    EXPECT_EQ(executor->failedRuns(), 1u);
+    EXPECT_EQ(executor->inFlight(), 0);
+    QMutexLocker lock(&mutex);
+    EXPECT_FALSE(results.contains(3));
+}
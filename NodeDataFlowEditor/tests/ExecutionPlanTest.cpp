@@ -0,0 +1,193 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <QApplication>
+#include <QSpinBox>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/ExecutionPlan.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/PortLabel.hpp"
+
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class ExecutionPlanTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    /// Node @p uid with one input (uid * 10 + 1), one output (uid * 10 + 2) and one parameter (uid * 10 + 3).
+    static ExecutionPlan::Source::Node node(qint64 uid)
+    {
+        return {uid, {PortId(uid * 10 + 1)}, {PortId(uid * 10 + 2)}, {PortId(uid * 10 + 3)}};
+    }
+
+    static QApplication* app;
+};
+
+QApplication* ExecutionPlanTest::app = nullptr;
+
+TEST_F(ExecutionPlanTest, OrdersNodesTopologically)
+{
+    // 3 → 1 → 2, listed out of order.
+    ExecutionPlan::Source source;
+    source.nodes = {node(2), node(1), node(3)};
+    source.connections = {{100, 32, 11}, {101, 12, 23}};
+
+    const auto plan = ExecutionPlan::compile(source, 7);
+
+    EXPECT_TRUE(plan->acyclic());
+    EXPECT_EQ(plan->topologyRevision(), 7u);
+    ASSERT_EQ(plan->nodes().size(), 3);
+    EXPECT_EQ(plan->nodes()[0].uid, 3);
+    EXPECT_EQ(plan->nodes()[1].uid, 1);
+    EXPECT_EQ(plan->nodes()[2].uid, 2);
+    EXPECT_EQ(plan->indexOf(1), 1);
+    EXPECT_EQ(plan->indexOf(42), -1);
+
+    ASSERT_EQ(plan->edges().size(), 2);
+    const ExecutionPlan::Edge& first = plan->edges()[0];
+    EXPECT_EQ(first.from, 0);
+    EXPECT_EQ(first.to, 1);
+    EXPECT_FALSE(first.toParameter);
+    EXPECT_EQ(plan->outputPorts()[first.output], PortId(32));
+    EXPECT_EQ(plan->inputPorts()[first.input], PortId(11));
+
+    // The second edge feeds node 2's parameter slot.
+    const ExecutionPlan::Edge& second = plan->edges()[1];
+    EXPECT_EQ(second.from, 1);
+    EXPECT_TRUE(second.toParameter);
+    EXPECT_EQ(second.input, plan->parameterSlot(23));
+    EXPECT_EQ(plan->parameterPorts().size(), 3);
+    EXPECT_EQ(plan->nodes()[2].firstParameter, second.input);
+}
+
+TEST_F(ExecutionPlanTest, FlattensGroupForwarding)
+{
+    // Group input 900 forwards to the inputs of nodes 2 and 3; group output 901 to node 3's output.
+    ExecutionPlan::Source source;
+    source.nodes = {node(1), node(2), node(3), node(4)};
+    source.forwards.insert(900, {21, 31});
+    source.forwards.insert(901, {32});
+    source.connections = {{100, 12, 900}, {101, 901, 41}};
+
+    const auto plan = ExecutionPlan::compile(source);
+
+    ASSERT_EQ(plan->edges().size(), 3);
+    for (const ExecutionPlan::Edge& edge : plan->edges())
+    {
+        EXPECT_NE(edge.from, edge.to);
+        EXPECT_LT(edge.from, edge.to);
+    }
+    const ExecutionPlan::Node& source1 = plan->nodes()[plan->indexOf(1)];
+    EXPECT_EQ(source1.edgeCount, 2);
+    for (int e = source1.firstEdge; e < source1.firstEdge + source1.edgeCount; ++e)
+        EXPECT_EQ(plan->edges()[e].connection, ConnectionId(100));
+    EXPECT_LT(plan->indexOf(3), plan->indexOf(4));
+    // Group ports get no slot.
+    EXPECT_FALSE(plan->inputPorts().contains(900));
+    EXPECT_FALSE(plan->outputPorts().contains(901));
+}
+
+TEST_F(ExecutionPlanTest, ReportsCycles)
+{
+    ExecutionPlan::Source source;
+    source.nodes = {node(1), node(2), node(3)};
+    source.connections = {{100, 12, 21}, {101, 22, 31}, {102, 32, 21}};
+
+    const auto plan = ExecutionPlan::compile(source);
+
+    EXPECT_FALSE(plan->acyclic());
+    ASSERT_EQ(plan->nodes().size(), 3);
+    EXPECT_EQ(plan->nodes()[0].uid, 1);
+    EXPECT_EQ(plan->edges().size(), 3);
+}
+
+TEST_F(ExecutionPlanTest, IndependentChainsInterleaveByUid)
+{
+    // 1 → 4 and 2 → 3: once 1 and 2 ran, 3 is ready as early as 4 and has the smaller uid.
+    ExecutionPlan::Source source;
+    source.nodes = {node(4), node(3), node(2), node(1)};
+    source.connections = {{100, 12, 41}, {101, 22, 31}};
+
+    const auto plan = ExecutionPlan::compile(source);
+
+    EXPECT_TRUE(plan->acyclic());
+    ASSERT_EQ(plan->nodes().size(), 4);
+    EXPECT_EQ(plan->nodes()[0].uid, 1);
+    EXPECT_EQ(plan->nodes()[1].uid, 2);
+    EXPECT_EQ(plan->nodes()[2].uid, 3);
+    EXPECT_EQ(plan->nodes()[3].uid, 4);
+}
+
+TEST_F(ExecutionPlanTest, RegistryRecompilesOnlyOnTopologyChanges)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = factory->createNode(scene.get(), "Src", Qt::red, QPointF(0, 0));
+    auto dst = factory->createNode(scene.get(), "Dst", Qt::blue, QPointF(300, 0));
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addParameter(*dst, new QSpinBox(), "gain");
+
+    const auto unconnected = registry->executionPlan();
+    EXPECT_TRUE(unconnected->edges().isEmpty());
+    EXPECT_EQ(registry->executionPlan(), unconnected);
+
+    ASSERT_NE(factory->createConnection(*scene,
+                                        *factory->getOutputPortByName(*src, "out"),
+                                        *factory->getInputPortByName(*dst, "in"),
+                                        false),
+              nullptr);
+    const auto connected = registry->executionPlan();
+    ASSERT_NE(connected, unconnected);
+    ASSERT_EQ(connected->edges().size(), 1);
+    EXPECT_EQ(connected->nodes()[connected->edges().front().from].uid, registry->getNode(src->item)->uid);
+    EXPECT_EQ(connected->parameterSlot(factory->getParameterPortByName(*dst, "gain")->id()), 0);
+
+    // Moves, renames and colors leave the plan alone.
+    src->item->setPos(50, 80);
+    dst->item->setDisplayedNodeName("Renamed");
+    dst->item->setNodeNameColor(Qt::green);
+    EXPECT_EQ(registry->executionPlan(), connected);
+}
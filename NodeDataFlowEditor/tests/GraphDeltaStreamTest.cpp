@@ -0,0 +1,251 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <QApplication>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QSpinBox>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphDeltaStream.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <algorithm>
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class GraphDeltaStreamTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        factory = scene->getNodeFactory();
+        registry = scene->getGraphRegistry();
+
+        src = factory->createNode(scene.get(), "Src");
+        dst = factory->createNode(scene.get(), "Dst", Qt::blue, QPointF(300, 0));
+        factory->addOutput(*src, "out");
+        factory->addInput(*dst, "in");
+    }
+
+    void TearDown() override
+    {
+        src.reset();
+        dst.reset();
+        scene.reset();
+    }
+
+    /// Blocks until the stand-in runtime has received a whole frame.
+    static bool readFrame(QLocalSocket* socket, QByteArray& buffer, GraphDeltaCodec::Frame& frame)
+    {
+        while (!GraphDeltaCodec::takeFrame(buffer, frame))
+        {
+            if (!socket->waitForReadyRead(5000))
+                return false;
+            buffer += socket->readAll();
+        }
+        return true;
+    }
+
+    static int count(const GraphDeltaCodec::Frame& frame, GraphDelta::Type type)
+    {
+        return static_cast<int>(std::count_if(frame.events.begin(), frame.events.end(), [type](const GraphDelta& d) {
+            return d.type == type;
+        }));
+    }
+
+    qint64 uid(const NodeFactory::Node& node) const
+    {
+        return registry->getNode(node.item)->uid;
+    }
+
+    void connectNodes()
+    {
+        ASSERT_NE(factory->createConnection(*scene,
+                                            *factory->getOutputPortByName(*src, "out"),
+                                            *factory->getInputPortByName(*dst, "in"),
+                                            false),
+                  nullptr);
+    }
+
+    std::unique_ptr<GraphScene> scene;
+    std::shared_ptr<NodeFactory> factory;
+    std::shared_ptr<GraphRegistry> registry;
+    std::unique_ptr<NodeFactory::Node> src;
+    std::unique_ptr<NodeFactory::Node> dst;
+
+    static QApplication* app;
+};
+
+QApplication* GraphDeltaStreamTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Codec
+// -----------------------------------------------------------------------------
+TEST_F(GraphDeltaStreamTest, FramesRoundTrip)
+{
+    QVector<GraphDelta> events;
+    GraphDelta node;
+    node.type = GraphDelta::Type::NodeAdded;
+    node.node = 42;
+    node.name = "Blur";
+    events.append(node);
+
+    GraphDelta value;
+    value.type = GraphDelta::Type::ParameterChanged;
+    value.node = 42;
+    value.port = 7;
+    value.value = 2.5;
+    events.append(value);
+
+    GraphDelta wire;
+    wire.type = GraphDelta::Type::ConnectionAdded;
+    wire.connection = 9;
+    wire.node = 41;
+    wire.port = 3;
+    wire.toNode = 42;
+    wire.toPort = 5;
+    events.append(wire);
+
+    QByteArray buffer = GraphDeltaCodec::encode(GraphDeltaCodec::FrameKind::Delta, 12, events);
+    const QByteArray second = GraphDeltaCodec::encode(GraphDeltaCodec::FrameKind::Snapshot, 13, {});
+    buffer += second.left(3);
+
+    GraphDeltaCodec::Frame frame;
+    ASSERT_TRUE(GraphDeltaCodec::takeFrame(buffer, frame));
+    EXPECT_EQ(frame.kind, GraphDeltaCodec::FrameKind::Delta);
+    EXPECT_EQ(frame.revision, 12u);
+    EXPECT_EQ(frame.events, events);
+
+    // The second frame is incomplete until the rest of it arrives.
+    EXPECT_FALSE(GraphDeltaCodec::takeFrame(buffer, frame));
+    EXPECT_EQ(buffer.size(), 3);
+    buffer += second.mid(3);
+    ASSERT_TRUE(GraphDeltaCodec::takeFrame(buffer, frame));
+    EXPECT_EQ(frame.kind, GraphDeltaCodec::FrameKind::Snapshot);
+    EXPECT_TRUE(frame.events.isEmpty());
+    EXPECT_TRUE(buffer.isEmpty());
+}
+
+TEST_F(GraphDeltaStreamTest, DiffOrdersRemovalsBeforeAdditions)
+{
+    auto before = registry->snapshot();
+    const qint64 srcUid = uid(*src);
+
+    scene->removeItem(src->item);
+    delete src->item;
+    src->item = nullptr;
+    auto extra = factory->createNode(scene.get(), "Extra");
+    factory->addOutput(*extra, "out");
+
+    const auto events = GraphDeltaCodec::diff(before.get(), *registry->snapshot());
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0].type, GraphDelta::Type::NodeRemoved);
+    EXPECT_EQ(events[0].node, srcUid);
+    EXPECT_EQ(events[1].type, GraphDelta::Type::NodeAdded);
+    EXPECT_EQ(events[1].name, "Extra");
+    EXPECT_EQ(events[2].type, GraphDelta::Type::PortAdded);
+    EXPECT_EQ(events[2].node, events[1].node);
+}
+
+// -----------------------------------------------------------------------------
+// Publisher against a stand-in runtime
+// -----------------------------------------------------------------------------
+TEST_F(GraphDeltaStreamTest, StreamsSnapshotThenDeltas)
+{
+    QLocalServer server;
+    const QString name = QString("GraphDeltaStreamTest-%1").arg(QCoreApplication::applicationPid());
+    QLocalServer::removeServer(name);
+    ASSERT_TRUE(server.listen(name));
+
+    GraphDeltaPublisher publisher(registry);
+    publisher.connectToServer(name);
+    ASSERT_TRUE(server.waitForNewConnection(5000));
+    QLocalSocket* runtime = server.nextPendingConnection();
+    ASSERT_NE(runtime, nullptr);
+
+    QByteArray buffer;
+    GraphDeltaCodec::Frame frame;
+    ASSERT_TRUE(readFrame(runtime, buffer, frame));
+    EXPECT_EQ(frame.kind, GraphDeltaCodec::FrameKind::Snapshot);
+    EXPECT_EQ(count(frame, GraphDelta::Type::NodeAdded), 2);
+    EXPECT_EQ(count(frame, GraphDelta::Type::PortAdded), 2);
+
+    // Several edits between two polls arrive as one frame.
+    connectNodes();
+    auto* spin = new QSpinBox();
+    factory->addParameter(*dst, spin, "gain");
+    spin->setValue(3);
+    spin->setValue(4);
+    publisher.publishNow();
+
+    ASSERT_TRUE(readFrame(runtime, buffer, frame));
+    EXPECT_EQ(frame.kind, GraphDeltaCodec::FrameKind::Delta);
+    EXPECT_EQ(frame.revision, registry->snapshot()->revision());
+    ASSERT_EQ(count(frame, GraphDelta::Type::ConnectionAdded), 1);
+    EXPECT_EQ(count(frame, GraphDelta::Type::PortAdded), 1);
+    ASSERT_EQ(count(frame, GraphDelta::Type::ParameterChanged), 1);
+    for (const GraphDelta& d : frame.events)
+    {
+        if (d.type == GraphDelta::Type::ConnectionAdded)
+        {
+            EXPECT_EQ(d.node, uid(*src));
+            EXPECT_EQ(d.toNode, uid(*dst));
+            EXPECT_NE(d.connection, invalidGraphId);
+        }
+        if (d.type == GraphDelta::Type::ParameterChanged)
+            EXPECT_EQ(d.value.toInt(), 4);
+    }
+
+    // The runtime lost track and asks for everything again.
+    runtime->write(QByteArray(1, static_cast<char>(GraphDeltaCodec::Command::Resync)));
+    runtime->flush();
+    ASSERT_TRUE(readFrame(runtime, buffer, frame));
+    EXPECT_EQ(frame.kind, GraphDeltaCodec::FrameKind::Snapshot);
+    EXPECT_EQ(count(frame, GraphDelta::Type::NodeAdded), 2);
+    EXPECT_EQ(count(frame, GraphDelta::Type::ConnectionAdded), 1);
+
+    EXPECT_TRUE(publisher.isConnected());
+    EXPECT_GT(publisher.sentEvents(), 0);
+}
@@ -0,0 +1,185 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "view/ConnectionItem.hpp"
+#include "view/GraphMinimap.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class GraphMinimapTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        factory = scene->getNodeFactory();
+        minimap = std::make_unique<GraphMinimap>(scene.get(), nullptr);
+        minimap->resize(200, 100);
+    }
+
+    void TearDown() override
+    {
+        minimap.reset();
+        nodes.clear();
+        scene.reset();
+    }
+
+    NodeItem* addNode(const QString& name, const QColor& color, const QPointF& pos)
+    {
+        nodes.push_back(factory->createNode(scene.get(), name, color, pos));
+        return nodes.back()->item;
+    }
+
+    /// Minimap pixel under the middle of @p node's body.
+    QColor colorAt(const NodeItem* node) const
+    {
+        const QSizeF size = node->boundingRect().size();
+        const QPointF center = node->pos() + QPointF(size.width() / 2, size.height() / 2);
+        return minimap->image().pixelColor(minimap->mapFromScene(center).toPoint());
+    }
+
+    std::unique_ptr<GraphScene> scene;
+    std::shared_ptr<NodeFactory> factory;
+    std::unique_ptr<GraphMinimap> minimap;
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+
+    static QApplication* app;
+};
+
+QApplication* GraphMinimapTest::app = nullptr;
+
+TEST_F(GraphMinimapTest, DrawsNodesInTitleColor)
+{
+    NodeItem* a = addNode("A", Qt::red, QPointF(0, 0));
+    NodeItem* b = addNode("B", Qt::blue, QPointF(800, 0));
+
+    minimap->refresh();
+
+    ASSERT_EQ(minimap->image().size(), QSize(200, 100));
+    EXPECT_EQ(colorAt(a), QColor(Qt::red));
+    EXPECT_EQ(colorAt(b), QColor(Qt::blue));
+
+    const QPointF p(400, 50);
+    const QPointF back = minimap->mapToScene(minimap->mapFromScene(p));
+    EXPECT_NEAR(back.x(), p.x(), 1e-6);
+    EXPECT_NEAR(back.y(), p.y(), 1e-6);
+}
+
+TEST_F(GraphMinimapTest, SmallMoveRedrawsInPlace)
+{
+    addNode("A", Qt::red, QPointF(0, 0));
+    NodeItem* b = addNode("B", Qt::blue, QPointF(800, 0));
+    minimap->refresh();
+    ASSERT_EQ(minimap->fullRenderCount(), 1);
+
+    b->setPos(b->pos() + QPointF(-60, 60));
+    minimap->refresh();
+
+    EXPECT_EQ(minimap->fullRenderCount(), 1);
+    EXPECT_EQ(colorAt(b), QColor(Qt::blue));
+}
+
+TEST_F(GraphMinimapTest, UnchangedGraphIsNotRedrawn)
+{
+    addNode("A", Qt::red, QPointF(0, 0));
+    minimap->refresh();
+    minimap->refresh();
+    minimap->refresh();
+
+    EXPECT_EQ(minimap->fullRenderCount(), 1);
+}
+
+TEST_F(GraphMinimapTest, GrowingPastMappedAreaRefitsImage)
+{
+    NodeItem* a = addNode("A", Qt::red, QPointF(0, 0));
+    NodeItem* b = addNode("B", Qt::blue, QPointF(800, 0));
+    minimap->refresh();
+
+    b->setPos(QPointF(20000, 5000));
+    minimap->refresh();
+
+    EXPECT_EQ(minimap->fullRenderCount(), 2);
+    EXPECT_EQ(colorAt(a), QColor(Qt::red));
+    EXPECT_EQ(colorAt(b), QColor(Qt::blue));
+}
+
+TEST_F(GraphMinimapTest, IncrementalRedrawMatchesFullRender)
+{
+    struct ChainTag
+    {};
+
+    // Given a zigzag chain large enough for partial redraws to go through the grid
+    std::vector<NodeItem*> chain;
+    for (int i = 0; i < 40; ++i)
+    {
+        chain.push_back(addNode(QString("N%1").arg(i), i % 2 ? Qt::red : Qt::blue, QPointF(i * 300, (i % 2) * 200)));
+        factory->addInput(*nodes.back(), "in");
+        factory->addOutput(*nodes.back(), "out");
+        factory->addInputTag<ChainTag>(*nodes.back(), "in");
+        factory->addOutputTag<ChainTag>(*nodes.back(), "out");
+        if (i > 0)
+        {
+            ConnectionItem* c = factory->createConnectionBetweenPorts(factory->getOutputPortByName(*nodes[i - 1], "out"),
+                                                                      factory->getInputPortByName(*nodes[i], "in"));
+            ASSERT_NE(c, nullptr);
+            scene->addItem(c);
+        }
+    }
+    minimap->setShowEdges(true);
+    minimap->refresh();
+
+    // When one node in the middle moves a little
+    chain[20]->setPos(chain[20]->pos() + QPointF(40, 30));
+    minimap->refresh();
+    ASSERT_EQ(minimap->fullRenderCount(), 1);
+
+    // Then the patched image equals a minimap drawn from scratch
+    GraphMinimap fresh(scene.get(), nullptr);
+    fresh.resize(minimap->size());
+    fresh.setShowEdges(true);
+    fresh.refresh();
+    EXPECT_EQ(minimap->image(), fresh.image());
+}
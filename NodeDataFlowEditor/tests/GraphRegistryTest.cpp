@@ -24,10 +24,12 @@
 
 #include <QApplication>
 #include <QGraphicsScene>
+#include <QSpinBox>
 #include <QWidget>
 #include <gtest/gtest.h>
 
 #include "factory/NodeFactory.hpp"
+#include "utility/ExecutionPlan.hpp"
 #include "utility/GraphRegistry.hpp"
 #include "utility/GroupDescriptor.hpp"
 #include "utility/NodeDescriptor.hpp"
@@ -87,11 +89,31 @@ protected:
         registry->unregisterParameter(item, param);
     }
 
+    void registerConnection(GraphRegistry* registry, PortLabel* from, PortLabel* to, ConnectionItem* conn)
+    {
+        registry->registerConnection(from, to, conn);
+    }
+
     void unregisterConnection(GraphRegistry* registry, ConnectionItem* conn)
     {
         registry->unregisterConnection(conn);
     }
 
+    QSet<NodeItem*> unregisterConnections(GraphRegistry* registry, const QVector<ConnectionItem*>& conns)
+    {
+        return registry->unregisterConnections(conns);
+    }
+
+    int connectionEndCount(GraphRegistry* registry, NodeItem* node)
+    {
+        return registry->m_nodeConnections.value(node).size();
+    }
+
+    int portConnectionCount(GraphRegistry* registry, PortId port)
+    {
+        return registry->m_portConnections.value(port).size();
+    }
+
     void addNodeToGroup(GraphRegistry* registry, GroupItem* group, NodeItem* node)
     {
         registry->addNodeToGroup(group, node);
@@ -285,6 +307,186 @@ TEST_F(GraphRegistryTest, UnregisterConnection)
     delete conn;
 }
 
+TEST_F(GraphRegistryTest, RemovingConnectedPortForgetsItsConnections)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = makeNode(factory.get(), scene.get(), "PSrc");
+    auto dst = makeNode(factory.get(), scene.get(), "PDst");
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInputTag<ValueHolder<int>>(*dst, "in");
+    PortLabel* out = factory->getOutputPortByName(*src, "out");
+    PortLabel* in = factory->getInputPortByName(*dst, "in");
+    ASSERT_NE(factory->createConnection(*scene, *in, *out, false), nullptr);
+    ASSERT_EQ(registry->executionPlan()->edges().size(), 1);
+
+    // When the connected input is removed and freed
+    dst->item->removeInput("in");
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    // Then neither the registry nor the surviving end keeps the connection
+    EXPECT_TRUE(registry->allConnections().isEmpty());
+    EXPECT_TRUE(registry->getConnections(out).isEmpty());
+    EXPECT_TRUE(registry->getNode(src->item)->ports.connections(out).isEmpty());
+    EXPECT_TRUE(registry->executionPlan()->edges().isEmpty());
+}
+
+TEST_F(GraphRegistryTest, ConnectionEndCountsFollowEveryRemovalPath)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = makeNode(factory.get(), scene.get(), "ESrc");
+    auto dst = makeNode(factory.get(), scene.get(), "EDst");
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "a");
+    factory->addInput(*dst, "b");
+    for (const char* name : {"a", "b"})
+        factory->addInputTag<ValueHolder<int>>(*dst, name);
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    PortLabel* out = factory->getOutputPortByName(*src, "out");
+    ConnectionItem* toA = factory->createConnection(*scene, *factory->getInputPortByName(*dst, "a"), *out, false);
+    ASSERT_NE(toA, nullptr);
+    ASSERT_NE(factory->createConnection(*scene, *factory->getInputPortByName(*dst, "b"), *out, false), nullptr);
+    EXPECT_EQ(connectionEndCount(registry.get(), src->item), 2);
+    EXPECT_EQ(connectionEndCount(registry.get(), dst->item), 2);
+    EXPECT_EQ(portConnectionCount(registry.get(), out->id()), 2);
+    const PortId b = factory->getInputPortByName(*dst, "b")->id();
+    EXPECT_EQ(portConnectionCount(registry.get(), b), 1);
+
+    // Removing a connection, then a connected port, releases their ends
+    unregisterConnection(registry.get(), toA);
+    delete toA;
+    EXPECT_EQ(connectionEndCount(registry.get(), src->item), 1);
+    EXPECT_EQ(portConnectionCount(registry.get(), out->id()), 1);
+    dst->item->removeInput("b");
+    EXPECT_EQ(connectionEndCount(registry.get(), src->item), 0);
+    EXPECT_EQ(connectionEndCount(registry.get(), dst->item), 0);
+    EXPECT_EQ(portConnectionCount(registry.get(), out->id()), 0);
+    EXPECT_EQ(portConnectionCount(registry.get(), b), 0);
+}
+
+TEST_F(GraphRegistryTest, UnregisterConnectionsReportsEnteredNodes)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = makeNode(factory.get(), scene.get(), "Src");
+    auto dst1 = makeNode(factory.get(), scene.get(), "Dst1");
+    auto dst2 = makeNode(factory.get(), scene.get(), "Dst2");
+    factory->addOutput(*src, "out");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    for (auto* dst : {dst1.get(), dst2.get()})
+    {
+        factory->addInput(*dst, "in");
+        factory->addInputTag<ValueHolder<int>>(*dst, "in");
+    }
+    PortLabel* out = factory->getOutputPortByName(*src, "out");
+    PortLabel* in1 = factory->getInputPortByName(*dst1, "in");
+    PortLabel* in2 = factory->getInputPortByName(*dst2, "in");
+    ConnectionItem* c1 = factory->createConnection(*scene, *out, *in1, false);
+    ConnectionItem* c2 = factory->createConnection(*scene, *out, *in2, false);
+    ASSERT_NE(c1, nullptr);
+    ASSERT_NE(c2, nullptr);
+
+    const QSet<NodeItem*> entered = unregisterConnections(registry.get(), {c1, c2});
+
+    EXPECT_EQ(entered, (QSet<NodeItem*>{dst1->item, dst2->item}));
+    EXPECT_FALSE(registry->hasConnection(out));
+    EXPECT_FALSE(registry->hasConnection(in1));
+    EXPECT_TRUE(registry->allConnections().isEmpty());
+
+    delete c1;
+    delete c2;
+}
+
+TEST_F(GraphRegistryTest, DeleteItemsRemovesNodesAndTheirWires)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = makeNode(factory.get(), scene.get(), "Src");
+    auto mid = makeNode(factory.get(), scene.get(), "Mid");
+    auto dst = makeNode(factory.get(), scene.get(), "Dst");
+    factory->addOutput(*src, "out");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInput(*mid, "in");
+    factory->addInputTag<ValueHolder<int>>(*mid, "in");
+    factory->addOutput(*mid, "out");
+    factory->addOutputTag<ValueHolder<int>>(*mid, "out");
+    factory->addParameter(*dst, new QSpinBox(), "p");
+    factory->addParamTag<ValueHolder<int>>(*dst, "p");
+
+    PortLabel* param = factory->getParameterPortByName(*dst, "p");
+    ASSERT_NE(factory->createConnection(*scene, *factory->getOutputPortByName(*src, "out"), *factory->getInputPortByName(*mid, "in"), false), nullptr);
+    ASSERT_NE(factory->createConnection(*scene, *factory->getOutputPortByName(*mid, "out"), *param, false), nullptr);
+    ASSERT_FALSE(dst->item->isParameterEnabled(param));
+
+    scene->deleteItems({src->item, mid->item});
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    EXPECT_TRUE(registry->allConnections().isEmpty());
+    EXPECT_EQ(registry->allNodes().size(), 1);
+    EXPECT_NE(registry->getNode(dst->item), nullptr);
+    // The surviving node lost its only parameter input, so its widget is editable again.
+    EXPECT_FALSE(registry->hasConnection(param));
+    EXPECT_TRUE(dst->item->isParameterEnabled(param));
+}
+
+TEST_F(GraphRegistryTest, IdsIdentifyPortsAndConnectionsAcrossRenames)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto n1 = makeNode(factory.get(), scene.get(), "Id1");
+    auto n2 = makeNode(factory.get(), scene.get(), "Id2");
+    factory->addInput(*n1, "in");
+    factory->addOutput(*n2, "out");
+    PortLabel* in = factory->getInputPortByName(*n1, "in");
+    PortLabel* out = factory->getOutputPortByName(*n2, "out");
+    factory->addInputTag<ValueHolder<int>>(*n1, "in");
+    factory->addOutputTag<ValueHolder<int>>(*n2, "out");
+
+    ASSERT_NE(in->id(), invalidGraphId);
+    ASSERT_NE(out->id(), invalidGraphId);
+    EXPECT_NE(in->id(), out->id());
+    EXPECT_EQ(registry->getPortById(in->id()), in);
+    EXPECT_EQ(registry->getPortById(out->id()), out);
+
+    ConnectionItem* conn = factory->createConnection(*scene, *in, *out, false);
+    ASSERT_NE(conn->id(), invalidGraphId);
+    EXPECT_EQ(registry->getConnectionById(conn->id()), conn);
+    EXPECT_EQ(conn->inputPort().portId, in->id());
+    EXPECT_EQ(conn->outputPort().portId, out->id());
+
+    n2->item->setNodeName("Id2Renamed");
+    EXPECT_TRUE(registry->hasConnectionTo(*in, *out));
+
+    auto record = registry->snapshot()->node(registry->getNode(n2->item)->uid);
+    ASSERT_EQ(record->outgoing.size(), 1);
+    EXPECT_EQ(record->outgoing.first().id, conn->id());
+    EXPECT_EQ(record->outgoing.first().fromPortId, out->id());
+    EXPECT_EQ(record->outgoing.first().toPortId, in->id());
+
+    const ConnectionId connId = conn->id();
+    unregisterConnection(registry.get(), conn);
+    EXPECT_EQ(registry->getConnectionById(connId), nullptr);
+
+    const PortId inId = in->id();
+    unregisterInput(registry.get(), n1->item, in);
+    EXPECT_EQ(registry->getPortById(inId), nullptr);
+
+    delete conn;
+}
+
 // -----------------------------------------------------------------------------
 // 4. Groups + forward ports
 // -----------------------------------------------------------------------------
@@ -336,6 +538,111 @@ TEST_F(GraphRegistryTest, AddRemoveNodeFromGroupAndGroupsOf)
     delete group;
 }
 
+TEST_F(GraphRegistryTest, ForwardIndexResolvesBothDirections)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto n1 = makeNode(factory.get(), scene.get(), "FwdOut");
+    auto n2 = makeNode(factory.get(), scene.get(), "FwdIn");
+    factory->addOutput(*n1, "o");
+    factory->addInput(*n2, "i");
+    factory->addOutputTag<ValueHolder<int>>(*n1, "o");
+    factory->addInputTag<ValueHolder<int>>(*n2, "i");
+    PortLabel* out = factory->getOutputPortByName(*n1, "o");
+    PortLabel* in = factory->getInputPortByName(*n2, "i");
+
+    ConnectionItem* conn = factory->createConnection(*scene, *in, *out, false);
+    ASSERT_NE(conn, nullptr);
+
+    QList<NodeItem*> nodes{n1->item};
+    GroupItem* group = new GroupItem(registry, nodes, scene.get());
+    ASSERT_EQ(group->outputs().size(), 1);
+    PortLabel* forward = group->outputs().first();
+
+    EXPECT_EQ(registry->getAllForwardedPortsFromAPort(forward), QVector<PortLabel*>{out});
+    EXPECT_EQ(registry->getAllPortsForwardedToAPort(out), QVector<PortLabel*>{forward});
+    EXPECT_TRUE(registry->hasConnection(forward));
+    EXPECT_TRUE(registry->getConnectionsFromGroupPort(forward).contains(conn));
+
+    unregisterGroup(registry.get(), group);
+    EXPECT_TRUE(registry->getAllForwardedPortsFromAPort(forward).isEmpty());
+    EXPECT_TRUE(registry->getAllPortsForwardedToAPort(out).isEmpty());
+
+    unregisterConnection(registry.get(), conn);
+    delete conn;
+    delete group;
+}
+
+TEST_F(GraphRegistryTest, SnapshotKeepsWiresOnGroupPorts)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = makeNode(factory.get(), scene.get(), "GwSrc");
+    auto member = makeNode(factory.get(), scene.get(), "GwMember");
+    auto dst = makeNode(factory.get(), scene.get(), "GwDst");
+    factory->addOutput(*src, "o");
+    factory->addInput(*member, "i");
+    factory->addOutput(*member, "o");
+    factory->addInput(*dst, "i");
+    PortLabel* srcOut = factory->getOutputPortByName(*src, "o");
+    PortLabel* memberIn = factory->getInputPortByName(*member, "i");
+    PortLabel* memberOut = factory->getOutputPortByName(*member, "o");
+    PortLabel* dstIn = factory->getInputPortByName(*dst, "i");
+
+    QList<NodeItem*> nodes{member->item};
+    GroupItem* group = new GroupItem(registry, nodes, scene.get());
+    ASSERT_EQ(group->inputs().size(), 1);
+    ASSERT_EQ(group->outputs().size(), 1);
+    PortLabel* groupIn = group->inputs().first();
+    PortLabel* groupOut = group->outputs().first();
+
+    // Both wires end on the group ports themselves, not on the member ports behind them
+    auto* into = new ConnectionItem(srcOut->getConnectionPortData(), groupIn->getConnectionPortData());
+    auto* outOf = new ConnectionItem(groupOut->getConnectionPortData(), dstIn->getConnectionPortData());
+    registerConnection(registry.get(), srcOut, groupIn, into);
+    registerConnection(registry.get(), groupOut, dstIn, outOf);
+
+    auto snap = registry->snapshot();
+    const qint64 groupUid = registry->findGroup(group->nodeName())->uid;
+    auto srcRecord = snap->node(registry->getNode(src->item)->uid);
+    ASSERT_EQ(srcRecord->outgoing.size(), 1);
+    EXPECT_EQ(srcRecord->outgoing.first().toNode, -1);
+    EXPECT_EQ(srcRecord->outgoing.first().toGroup, groupUid);
+    EXPECT_EQ(srcRecord->outgoing.first().toPortId, groupIn->id());
+
+    auto groupRecord = snap->group(groupUid);
+    ASSERT_NE(groupRecord, nullptr);
+    ASSERT_EQ(groupRecord->outgoing.size(), 1);
+    EXPECT_EQ(groupRecord->outgoing.first().fromGroup, groupUid);
+    EXPECT_EQ(groupRecord->outgoing.first().fromPortId, groupOut->id());
+    EXPECT_EQ(groupRecord->outgoing.first().toNode, registry->getNode(dst->item)->uid);
+    EXPECT_EQ(groupRecord->outgoing.first().toPortId, dstIn->id());
+    EXPECT_EQ(snap->edges().size(), 2);
+
+    // The forwards resolve each group port id to the member port behind it
+    bool inResolved = false;
+    bool outResolved = false;
+    for (const ForwardRecord& forward : groupRecord->forwards)
+    {
+        inResolved |= forward.groupPortId == groupIn->id() && forward.portId == memberIn->id();
+        outResolved |= forward.groupPortId == groupOut->id() && forward.portId == memberOut->id();
+    }
+    EXPECT_TRUE(inResolved);
+    EXPECT_TRUE(outResolved);
+
+    unregisterConnection(registry.get(), into);
+    unregisterConnection(registry.get(), outOf);
+    EXPECT_TRUE(registry->snapshot()->edges().isEmpty());
+
+    delete into;
+    delete outOf;
+    delete group;
+}
+
 // -----------------------------------------------------------------------------
 // 5. nodeMoved propagation
 // -----------------------------------------------------------------------------
@@ -0,0 +1,304 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <QHBoxLayout>
+#include <QSpinBox>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "utility/NodeDescriptor.hpp"
+#include "utility/PersistentVector.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/PortLabel.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class GraphSnapshotTest : public ::testing::Test
+{
+public:
+    template <typename T>
+    struct ValueHolder
+    {};
+
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* GraphSnapshotTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// PersistentVector
+// -----------------------------------------------------------------------------
+TEST_F(GraphSnapshotTest, PersistentVectorKeepsOldVersions)
+{
+    PersistentVector<int> v1;
+    for (int i = 0; i < 2000; ++i)
+        v1 = v1.set(i, std::make_shared<const int>(i));
+
+    auto v2 = v1.set(1500, std::make_shared<const int>(-1)).erase(3);
+
+    EXPECT_EQ(*v1.at(1500), 1500);
+    EXPECT_EQ(*v1.at(3), 3);
+    EXPECT_EQ(*v2.at(1500), -1);
+    EXPECT_EQ(v2.at(3), nullptr);
+    EXPECT_EQ(v2.at(5000), nullptr);
+
+    int changes = 0;
+    v2.forEachChange(v1, [&](std::size_t index, const int*, const int*) {
+        EXPECT_TRUE(index == 3 || index == 1500);
+        ++changes;
+    });
+    EXPECT_EQ(changes, 2);
+}
+
+// -----------------------------------------------------------------------------
+// Snapshots
+// -----------------------------------------------------------------------------
+TEST_F(GraphSnapshotTest, SnapshotContainsNodesPortsAndEdges)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = factory->createNode(scene.get(), "Src", Qt::red, QPointF(10, 20));
+    auto dst = factory->createNode(scene.get(), "Dst", Qt::blue, QPointF(300, 20));
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInputTag<ValueHolder<int>>(*dst, "in");
+
+    auto* spin = new QSpinBox();
+    spin->setValue(7);
+    factory->addParameter(*dst, spin, "gain");
+
+    ASSERT_NE(factory->createConnection(*scene,
+                                        *factory->getOutputPortByName(*src, "out"),
+                                        *factory->getInputPortByName(*dst, "in"),
+                                        false),
+              nullptr);
+
+    auto snap = registry->snapshot();
+    ASSERT_NE(snap, nullptr);
+    EXPECT_EQ(snap->nodeCount(), 2);
+
+    const qint64 srcUid = registry->getNode(src->item)->uid;
+    const qint64 dstUid = registry->getNode(dst->item)->uid;
+
+    auto srcRecord = snap->node(srcUid);
+    auto dstRecord = snap->node(dstUid);
+    ASSERT_NE(srcRecord, nullptr);
+    ASSERT_NE(dstRecord, nullptr);
+
+    EXPECT_EQ(srcRecord->name, "Src");
+    EXPECT_EQ(srcRecord->position, QPointF(10, 20));
+    ASSERT_EQ(srcRecord->outputs.size(), 1);
+    EXPECT_TRUE(srcRecord->outputs.front().tags.any());
+
+    ASSERT_EQ(dstRecord->parameters.size(), 1);
+    EXPECT_EQ(dstRecord->parameters.front().value.toInt(), 7);
+
+    ASSERT_EQ(srcRecord->outgoing.size(), 1);
+    EXPECT_EQ(srcRecord->outgoing.front().toNode, dstUid);
+    EXPECT_EQ(srcRecord->outgoing.front().toPort, "in");
+    EXPECT_EQ(snap->edges().size(), 1);
+}
+
+TEST_F(GraphSnapshotTest, PublishedSnapshotIsImmutable)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto node = factory->createNode(scene.get(), "Mover", Qt::gray, QPointF(0, 0));
+    const qint64 uid = registry->getNode(node->item)->uid;
+
+    auto before = registry->snapshot();
+    node->item->setPos(QPointF(50, 60));
+    auto after = registry->snapshot();
+
+    EXPECT_EQ(before->node(uid)->position, QPointF(0, 0));
+    EXPECT_EQ(after->node(uid)->position, QPointF(50, 60));
+    EXPECT_GT(after->revision(), before->revision());
+}
+
+TEST_F(GraphSnapshotTest, ContainerParameterCarriesEveryLeaf)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto node = factory->createNode(scene.get(), "Range");
+    auto* container = new QWidget();
+    auto* layout = new QHBoxLayout(container);
+    auto* low = new QSpinBox();
+    auto* high = new QSpinBox();
+    low->setValue(2);
+    high->setValue(9);
+    layout->addWidget(low);
+    layout->addWidget(high);
+    factory->addParameter(*node, container, "range");
+    const qint64 uid = registry->getNode(node->item)->uid;
+
+    auto first = registry->snapshot();
+    ASSERT_EQ(first->node(uid)->parameters.size(), 1);
+    const PortRecord& range = first->node(uid)->parameters.front();
+    ASSERT_EQ(range.values.size(), 2);
+    EXPECT_EQ(range.values[0].toInt(), 2);
+    EXPECT_EQ(range.values[1].toInt(), 9);
+    EXPECT_EQ(range.value.toInt(), 2);
+
+    // An edit of the second editor alone reaches the next snapshot.
+    high->setValue(12);
+    registry->parameterStore().flush();
+    auto second = registry->snapshot();
+    EXPECT_EQ(second->node(uid)->parameters.front().values[1].toInt(), 12);
+}
+
+TEST_F(GraphSnapshotTest, UnchangedRecordsAreShared)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto moved = factory->createNode(scene.get(), "Moved");
+    auto still = factory->createNode(scene.get(), "Still");
+    const qint64 movedUid = registry->getNode(moved->item)->uid;
+    const qint64 stillUid = registry->getNode(still->item)->uid;
+
+    auto first = registry->snapshot();
+    moved->item->setPos(QPointF(5, 5));
+    auto second = registry->snapshot();
+
+    EXPECT_EQ(first->node(stillUid).get(), second->node(stillUid).get());
+    EXPECT_NE(first->node(movedUid).get(), second->node(movedUid).get());
+
+    int changed = 0;
+    second->forEachNodeChange(*first, [&](const NodeRecord* before, const NodeRecord* after) {
+        ASSERT_NE(before, nullptr);
+        ASSERT_NE(after, nullptr);
+        EXPECT_EQ(after->uid, movedUid);
+        ++changed;
+    });
+    EXPECT_EQ(changed, 1);
+
+    // Nothing changed since: the same snapshot is handed out again.
+    EXPECT_EQ(registry->snapshot().get(), second.get());
+}
+
+TEST_F(GraphSnapshotTest, RemovedNodeDisappearsFromNextSnapshot)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto node = factory->createNode(scene.get(), "Temp");
+    const qint64 uid = registry->getNode(node->item)->uid;
+    auto before = registry->snapshot();
+
+    scene->removeItem(node->item);
+    delete node->item;
+    node->item = nullptr;
+    node.reset();
+
+    auto after = registry->snapshot();
+    EXPECT_NE(before->node(uid), nullptr);
+    EXPECT_EQ(after->node(uid), nullptr);
+    EXPECT_EQ(after->nodeCount(), before->nodeCount() - 1);
+}
+
+TEST_F(GraphSnapshotTest, RemovedNodeLeavesNoEdgesOnItsNeighbours)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = factory->createNode(scene.get(), "Src");
+    auto dst = factory->createNode(scene.get(), "Dst");
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInputTag<ValueHolder<int>>(*dst, "in");
+    ASSERT_NE(factory->createConnection(*scene,
+                                        *factory->getOutputPortByName(*src, "out"),
+                                        *factory->getInputPortByName(*dst, "in"),
+                                        false),
+              nullptr);
+    const qint64 srcUid = registry->getNode(src->item)->uid;
+    ASSERT_EQ(registry->snapshot()->node(srcUid)->outgoing.size(), 1);
+
+    scene->removeItem(dst->item);
+    delete dst->item;
+    dst->item = nullptr;
+    dst.reset();
+
+    auto after = registry->snapshot();
+    EXPECT_TRUE(after->node(srcUid)->outgoing.isEmpty());
+    EXPECT_TRUE(after->edges().isEmpty());
+}
+
+TEST_F(GraphSnapshotTest, SnapshotCanBeReadFromWorkerThread)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    for (int i = 0; i < 64; ++i)
+        nodes.push_back(factory->createNode(scene.get(), QString("N%1").arg(i)));
+    registry->snapshot();
+
+    std::atomic<int> seen{0};
+    std::thread reader([&] {
+        auto snap = registry->latestSnapshot();
+        snap->forEachNode([&](const NodeRecord&) { ++seen; });
+    });
+
+    // Keep editing on the GUI thread while the worker reads.
+    for (auto& node : nodes)
+        node->item->setPos(node->item->pos() + QPointF(1, 1));
+    reader.join();
+
+    EXPECT_EQ(seen.load(), 64);
+}
@@ -23,13 +23,18 @@
 */
 
 #include "view/GroupItem.hpp"
+#include "model/ParameterStore.hpp"
 #include "utility/GraphRegistry.hpp"
+#include "view/DeferredParameterWidget.hpp"
 #include "view/GraphScene.hpp"
 #include "view/NodeItem.hpp"
 #include "view/PortLabel.hpp"
 
 #include <QApplication>
+#include <QCheckBox>
 #include <QGraphicsScene>
+#include <QKeyEvent>
+#include <QSpinBox>
 #include <QWidget>
 #include <gtest/gtest.h>
 #include <memory>
@@ -157,6 +162,37 @@ TEST_F(GroupItemTest, UngroupRestoresNodes)
     EXPECT_TRUE(scene->items().indexOf(group) == -1);
 }
 
+TEST_F(GroupItemTest, UngroupForgetsForwardedPorts)
+{
+    // Given a group forwarding an input, an output and a parameter
+    NodeItem node1(registry, "Node1");
+    NodeItem node2(registry, "Node2");
+    PortLabel* in = node1.addInput("In1");
+    PortLabel* out = node2.addOutput("Out1");
+    PortLabel* param = node1.addParameter(new QSpinBox(), "Gain");
+    scene->addItem(&node1);
+    scene->addItem(&node2);
+
+    auto* group = new TestableGroupItem(registry, {&node1, &node2}, scene);
+    QVector<PortId> groupPortIds;
+    for (PortLabel* port : group->getAllPorts())
+        groupPortIds.append(port->id());
+    ASSERT_EQ(groupPortIds.size(), 3);
+
+    // When ungrouping and letting the deferred deletes run
+    group->ungroup(scene);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    // Then no forwarding or port id of the group survives
+    for (PortLabel* actual : {in, out, param})
+    {
+        EXPECT_TRUE(registry->getAllPortsForwardedToAPort(actual).isEmpty());
+        EXPECT_TRUE(registry->getAllForwardedPortsFromAPort(actual).isEmpty());
+    }
+    for (PortId id : groupPortIds)
+        EXPECT_EQ(registry->getPortById(id), nullptr);
+}
+
 TEST_F(GroupItemTest, GroupTitleConcatenation)
 {
     // Given nodes with titles
@@ -195,4 +231,254 @@ TEST_F(GroupItemTest, ForwardPortClick)
     SUCCEED();
 }
 
+TEST_F(GroupItemTest, CollapsedGroupDetachesMembersAndDefersMoves)
+{
+    // Given two scene-owned nodes grouped together
+    auto* node1 = new NodeItem(registry, "Node1");
+    auto* node2 = new NodeItem(registry, "Node2");
+    node1->addInput("In1");
+    node2->addOutput("Out1");
+    node1->setPos(0, 0);
+    node2->setPos(100, 0);
+    scene->addItem(node1);
+    scene->addItem(node2);
+
+    auto* group = new TestableGroupItem(registry, {node1, node2}, scene);
+    scene->addItem(group);
+
+    // When collapsing the group and moving it twice
+    group->setCollapsed(true);
+    EXPECT_TRUE(group->isCollapsed());
+    EXPECT_EQ(node1->scene(), nullptr);
+    EXPECT_EQ(node2->scene(), nullptr);
+
+    group->setPos(group->pos() + QPointF(10, 5));
+    group->setPos(group->pos() + QPointF(20, 5));
+
+    // Then the detached members have not moved yet
+    EXPECT_EQ(node1->pos(), QPointF(0, 0));
+    EXPECT_EQ(node2->pos(), QPointF(100, 0));
+
+    // When expanding, the accumulated offset is applied once and members return
+    group->setCollapsed(false);
+    EXPECT_FALSE(group->isCollapsed());
+    EXPECT_EQ(node1->scene(), scene);
+    EXPECT_EQ(node2->scene(), scene);
+    EXPECT_EQ(node1->pos(), QPointF(30, 10));
+    EXPECT_EQ(node2->pos(), QPointF(130, 10));
+}
+
+TEST_F(GroupItemTest, SceneTeardownDeletesDetachedMembers)
+{
+    // Given a collapsed group in a graph scene
+    auto graphScene = std::make_unique<GraphScene>();
+    auto* node1 = new NodeItem(graphScene->getGraphRegistry(), "Node1");
+    auto* node2 = new NodeItem(graphScene->getGraphRegistry(), "Node2");
+    graphScene->addItem(node1);
+    graphScene->addItem(node2);
+    auto* group = new GroupItem(graphScene->getGraphRegistry(), {node1, node2}, graphScene.get());
+    group->setCollapsed(true);
+
+    int destroyed = 0;
+    QObject::connect(node1, &QObject::destroyed, [&destroyed] { ++destroyed; });
+    QObject::connect(node2, &QObject::destroyed, [&destroyed] { ++destroyed; });
+
+    // When the scene goes away
+    graphScene.reset();
+
+    // Then the detached members are deleted with it
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST_F(GroupItemTest, DeletingCollapsedGroupDeletesItsMembers)
+{
+    // Given a collapsed group of two wired nodes, and a node outside it
+    GraphScene graphScene;
+    auto graphRegistry = graphScene.getGraphRegistry();
+    auto* node1 = new NodeItem(graphRegistry, "Node1");
+    auto* node2 = new NodeItem(graphRegistry, "Node2");
+    auto* outsider = new NodeItem(graphRegistry, "Outsider");
+    PortLabel* out = node1->addOutput("Out");
+    PortLabel* in = node2->addInput("In");
+    for (NodeItem* node : {node1, node2, outsider})
+        graphScene.addItem(node);
+    ASSERT_NE(graphScene.connectPorts(out, in), nullptr);
+
+    auto* group = new GroupItem(graphRegistry, {node1, node2}, &graphScene);
+    group->setCollapsed(true);
+
+    // When the group is selected and deleted with the Delete key
+    graphScene.clearSelection();
+    group->setSelected(true);
+    QKeyEvent del(QEvent::KeyPress, Qt::Key_Delete, Qt::NoModifier);
+    QApplication::sendEvent(&graphScene, &del);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    // Then only the outsider is left, in the scene and in the registry
+    int sceneNodes = 0;
+    for (QGraphicsItem* item : graphScene.items())
+        if (dynamic_cast<NodeItem*>(item))
+            ++sceneNodes;
+    EXPECT_EQ(sceneNodes, 1);
+    ASSERT_EQ(graphRegistry->allNodes().size(), 1);
+    EXPECT_EQ(graphRegistry->allNodes().front()->node, outsider);
+    EXPECT_TRUE(graphRegistry->allConnections().isEmpty());
+}
+
+TEST_F(GroupItemTest, LargeGroupsCollapseOnlyWhenEnabled)
+{
+    GraphScene graphScene;
+    auto makeNodes = [&graphScene](const QString& prefix) {
+        QList<NodeItem*> nodes;
+        for (int i = 0; i < 4; ++i)
+        {
+            auto* node = new NodeItem(graphScene.getGraphRegistry(), prefix + QString::number(i));
+            graphScene.addItem(node);
+            nodes.append(node);
+        }
+        return nodes;
+    };
+    auto selectedGroup = [&graphScene]() -> GroupItem* {
+        for (QGraphicsItem* item : graphScene.selectedItems())
+            if (auto* group = dynamic_cast<GroupItem*>(item))
+                return group;
+        return nullptr;
+    };
+
+    // By default groups keep their members in the scene
+    EXPECT_EQ(graphScene.autoCollapseThreshold(), 0);
+    graphScene.groupSelectedNodes(makeNodes("A"));
+    GroupItem* plain = selectedGroup();
+    ASSERT_NE(plain, nullptr);
+    EXPECT_FALSE(plain->isCollapsed());
+
+    // With a threshold, groups that reach it are collapsed on creation
+    graphScene.clearSelection();
+    graphScene.setAutoCollapseThreshold(4);
+    graphScene.groupSelectedNodes(makeNodes("B"));
+    GroupItem* collapsed = selectedGroup();
+    ASSERT_NE(collapsed, nullptr);
+    EXPECT_TRUE(collapsed->isCollapsed());
+
+    graphScene.clearSelection();
+    graphScene.setAutoCollapseThreshold(5);
+    graphScene.groupSelectedNodes(makeNodes("C"));
+    GroupItem* small = selectedGroup();
+    ASSERT_NE(small, nullptr);
+    EXPECT_FALSE(small->isCollapsed());
+}
+
+TEST_F(GroupItemTest, GroupingManyNodesForwardsEveryPort)
+{
+    // Given 300 scene-owned nodes, each with an input, an output and a parameter
+    constexpr int count = 300;
+    QList<NodeItem*> nodes;
+    for (int i = 0; i < count; ++i)
+    {
+        auto* node = new NodeItem(registry, QString("Node%1").arg(i));
+        node->addInput("In");
+        node->addOutput("Out");
+        node->addParameter(new QSpinBox(), "Gain");
+        scene->addItem(node);
+        nodes.append(node);
+    }
+
+    // When grouping them all
+    auto* group = new TestableGroupItem(registry, nodes, scene);
+
+    // Then every port is mirrored and forwarded to its member port
+    ASSERT_EQ(group->inputs().size(), count);
+    ASSERT_EQ(group->outputs().size(), count);
+    ASSERT_EQ(group->paramsInputs().size(), count);
+    for (PortLabel* port : group->inputs())
+        EXPECT_EQ(registry->getAllForwardedPortsFromAPort(port).size(), 1);
+    for (PortLabel* port : group->paramsInputs())
+        EXPECT_EQ(registry->getAllForwardedPortsFromAPort(port).size(), 1);
+    EXPECT_EQ(registry->getAllPortsForwardedToAPort(nodes.front()->outputs().front()).size(), 1);
+
+    // And no parameter editor has been cloned yet
+    EXPECT_EQ(group->deferredParameterCount(), count);
+}
+
+TEST_F(GroupItemTest, ParameterEditorIsClonedOnDemand)
+{
+    // Given a grouped node with a spin box parameter
+    NodeItem node(registry, "Node1");
+    auto* spin = new QSpinBox();
+    spin->setRange(0, 100);
+    spin->setValue(7);
+    node.addParameter(spin, "Gain");
+    scene->addItem(&node);
+
+    TestableGroupItem group(registry, {&node}, scene);
+    ASSERT_EQ(group.paramsInputs().size(), 1);
+    PortLabel* groupPort = group.paramsInputs().front();
+
+    // Then the group shows a placeholder reporting the member's value
+    auto const* placeholder = qobject_cast<DeferredParameterWidget*>(group.getParameterWidget(groupPort));
+    ASSERT_NE(placeholder, nullptr);
+    EXPECT_EQ(placeholder->value().toInt(), 7);
+
+    // When the editor is first needed
+    group.materializeParameters();
+
+    // Then it is a clone of the member's editor, bound to the same value
+    auto* clone = qobject_cast<QSpinBox*>(group.getParameterWidget(groupPort));
+    ASSERT_NE(clone, nullptr);
+    EXPECT_EQ(group.deferredParameterCount(), 0);
+    EXPECT_EQ(clone->maximum(), 100);
+    EXPECT_EQ(clone->value(), 7);
+
+    clone->setValue(42);
+    registry->parameterStore().flush();
+    EXPECT_EQ(spin->value(), 42);
+}
+
+TEST_F(GroupItemTest, ParameterEditorIsClonedOnHoverNotOnPaint)
+{
+    // Given a grouped node with a spin box parameter
+    NodeItem node(registry, "Node1");
+    node.addParameter(new QSpinBox(), "Gain");
+    scene->addItem(&node);
+    TestableGroupItem group(registry, {&node}, scene);
+    PortLabel* groupPort = group.paramsInputs().front();
+    auto* placeholder = qobject_cast<DeferredParameterWidget*>(group.getParameterWidget(groupPort));
+    ASSERT_NE(placeholder, nullptr);
+
+    // When the placeholder is painted, e.g. for a snapshot
+    placeholder->grab();
+    QApplication::processEvents();
+
+    // Then the editor is still deferred
+    EXPECT_EQ(group.deferredParameterCount(), 1);
+
+    // When the mouse enters it
+    QEvent enter(QEvent::Enter);
+    QApplication::sendEvent(placeholder, &enter);
+    QApplication::processEvents();
+
+    // Then the clone replaces it
+    EXPECT_EQ(group.deferredParameterCount(), 0);
+    EXPECT_NE(qobject_cast<QSpinBox*>(group.getParameterWidget(groupPort)), nullptr);
+}
+
+TEST_F(GroupItemTest, ContainerParametersAreForwarded)
+{
+    // Given a grouped node whose parameter is a container of two editors
+    NodeItem node(registry, "Node1");
+    auto* container = new QWidget();
+    new QCheckBox(container);
+    new QCheckBox(container);
+    PortLabel* param = node.addParameter(container, "Pair");
+    scene->addItem(&node);
+
+    TestableGroupItem group(registry, {&node}, scene);
+
+    // Then each cloned child gets a group port forwarded to the member's parameter
+    ASSERT_EQ(group.paramsInputs().size(), 2);
+    for (PortLabel* port : group.paramsInputs())
+        EXPECT_EQ(registry->getAllForwardedPortsFromAPort(port).size(), 1);
+    EXPECT_EQ(registry->getAllPortsForwardedToAPort(param).size(), 2);
+}
+
 // test ports tagging compatibility
@@ -0,0 +1,190 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/LayeredLayout.hpp"
+#include "utility/NodeDescriptor.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class LayeredLayoutTest : public ::testing::Test
+{
+public:
+    template <typename T>
+    struct ValueHolder
+    {};
+
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        factory = scene->getNodeFactory();
+        registry = scene->getGraphRegistry();
+    }
+
+    void TearDown() override
+    {
+        nodes.clear();
+        scene.reset();
+    }
+
+    /// Creates a node at the origin with one input and one output.
+    NodeItem* addNode(const QString& name)
+    {
+        nodes.push_back(factory->createNode(scene.get(), name, Qt::gray, QPointF()));
+        auto& node = *nodes.back();
+        factory->addInput(node, "in");
+        factory->addOutput(node, "out");
+        factory->addInputTag<ValueHolder<int>>(node, "in");
+        factory->addOutputTag<ValueHolder<int>>(node, "out");
+        return node.item;
+    }
+
+    void connect(NodeItem* from, NodeItem* to)
+    {
+        factory->createConnection(*scene,
+                                  *registry->getInputPortByName(*to, "in"),
+                                  *registry->getOutputPortByName(*from, "out"),
+                                  false);
+    }
+
+    qint64 uid(NodeItem* node) { return registry->getNode(node)->uid; }
+
+    std::unique_ptr<GraphScene> scene;
+    std::shared_ptr<NodeFactory> factory;
+    std::shared_ptr<GraphRegistry> registry;
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+
+    static QApplication* app;
+};
+
+QApplication* LayeredLayoutTest::app = nullptr;
+
+TEST_F(LayeredLayoutTest, ChainFlowsLeftToRight)
+{
+    NodeItem* a = addNode("A");
+    NodeItem* b = addNode("B");
+    NodeItem* c = addNode("C");
+    connect(a, b);
+    connect(b, c);
+
+    auto positions = LayeredLayout().run(*registry->snapshot());
+
+    ASSERT_EQ(positions.size(), 3);
+    EXPECT_LT(positions[uid(a)].x() + a->boundingRect().width(), positions[uid(b)].x());
+    EXPECT_LT(positions[uid(b)].x() + b->boundingRect().width(), positions[uid(c)].x());
+}
+
+TEST_F(LayeredLayoutTest, NodesOfOneLayerDoNotOverlap)
+{
+    NodeItem* root = addNode("Root");
+    QList<NodeItem*> leaves;
+    for (int i = 0; i < 5; ++i)
+    {
+        leaves.append(addNode(QString("Leaf%1").arg(i)));
+        connect(root, leaves.last());
+    }
+
+    auto positions = LayeredLayout().run(*registry->snapshot());
+
+    QList<QRectF> rects;
+    for (NodeItem* leaf : leaves)
+        rects.append(QRectF(positions[uid(leaf)], leaf->boundingRect().size()));
+    for (int i = 0; i < rects.size(); ++i)
+        for (int j = i + 1; j < rects.size(); ++j)
+            EXPECT_FALSE(rects[i].intersects(rects[j]));
+}
+
+TEST_F(LayeredLayoutTest, CyclesAreLaidOut)
+{
+    NodeItem* a = addNode("CycA");
+    NodeItem* b = addNode("CycB");
+    NodeItem* c = addNode("CycC");
+    connect(a, b);
+    connect(b, c);
+    connect(c, a);
+
+    auto positions = LayeredLayout().run(*registry->snapshot());
+
+    ASSERT_EQ(positions.size(), 3);
+    EXPECT_NE(positions[uid(a)].x(), positions[uid(b)].x());
+    EXPECT_NE(positions[uid(b)].x(), positions[uid(c)].x());
+}
+
+TEST_F(LayeredLayoutTest, SubsetIsAnchoredAtItsBoundingBox)
+{
+    NodeItem* fixed = addNode("Fixed");
+    NodeItem* a = addNode("SubA");
+    NodeItem* b = addNode("SubB");
+    connect(fixed, a);
+    connect(a, b);
+    a->setPos(500, 400);
+    b->setPos(520, 450);
+
+    auto positions = LayeredLayout().run(*registry->snapshot(), {uid(a), uid(b)});
+
+    ASSERT_EQ(positions.size(), 2);
+    EXPECT_FALSE(positions.contains(uid(fixed)));
+    EXPECT_EQ(positions[uid(a)], QPointF(500, 400));
+    EXPECT_GT(positions[uid(b)].x(), 500);
+}
+
+TEST_F(LayeredLayoutTest, SceneAppliesLayoutFromWorker)
+{
+    NodeItem* a = addNode("WorkA");
+    NodeItem* b = addNode("WorkB");
+    connect(a, b);
+
+    QEventLoop loop;
+    QObject::connect(scene.get(), &GraphScene::sgnLayoutApplied, &loop, &QEventLoop::quit);
+    QTimer::singleShot(5000, &loop, &QEventLoop::quit);
+    scene->autoLayout();
+    loop.exec();
+
+    EXPECT_LT(a->pos().x(), b->pos().x());
+}
@@ -0,0 +1,110 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/NodeDescriptor.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+    // The table only compares and stores pointers, so stand-ins never need to be real objects.
+    template <typename T>
+    std::vector<T*> fakePointers(std::vector<char>& storage, int count)
+    {
+        storage.resize(static_cast<std::size_t>(count));
+        std::vector<T*> out;
+        for (int i = 0; i < count; ++i)
+            out.push_back(reinterpret_cast<T*>(&storage[static_cast<std::size_t>(i)]));
+        return out;
+    }
+
+    std::vector<ConnectionItem*> toVector(PortTable::Connections connections)
+    {
+        return {connections.begin(), connections.end()};
+    }
+} // namespace
+
+TEST(NodeDescriptorTest, PortsKeepTheirInsertionOrderWithTheirConnections)
+{
+    std::vector<char> portStorage;
+    std::vector<char> connectionStorage;
+    const auto ports = fakePointers<PortLabel>(portStorage, 4);
+    const auto connections = fakePointers<ConnectionItem>(connectionStorage, 4);
+
+    PortTable table;
+    table.addPort(ports[2], PortTable::Kind::Output);
+    table.addPort(ports[0], PortTable::Kind::Input);
+    table.addConnection(ports[2], PortTable::Kind::Output, connections[0]);
+    table.addConnection(ports[0], PortTable::Kind::Input, connections[1]);
+    table.addConnection(ports[2], PortTable::Kind::Output, connections[2]);
+    // A port seen first through a connection is added on the fly.
+    table.addConnection(ports[1], PortTable::Kind::Parameter, connections[3]);
+
+    // Order follows insertion, not addresses, so it is the same on every run.
+    ASSERT_EQ(table.portCount(), 3);
+    EXPECT_EQ(table.connectionCount(), 4);
+    EXPECT_EQ(table.portAt(0).port, ports[2]);
+    EXPECT_EQ(table.portAt(1).port, ports[0]);
+    EXPECT_EQ(table.portAt(2).port, ports[1]);
+    EXPECT_EQ(table.portAt(2).kind, PortTable::Kind::Parameter);
+    EXPECT_EQ(toVector(table.connectionsAt(0)), (std::vector<ConnectionItem*>{connections[0], connections[2]}));
+
+    EXPECT_EQ(toVector(table.connections(ports[0])), std::vector<ConnectionItem*>{connections[1]});
+    EXPECT_EQ(toVector(table.connections(ports[1])), std::vector<ConnectionItem*>{connections[3]});
+    EXPECT_EQ(toVector(table.connections(ports[2])), (std::vector<ConnectionItem*>{connections[0], connections[2]}));
+    EXPECT_TRUE(table.connections(ports[3]).isEmpty());
+    EXPECT_FALSE(table.contains(ports[3]));
+}
+
+TEST(NodeDescriptorTest, RemovalKeepsOtherPortsIntact)
+{
+    std::vector<char> portStorage;
+    std::vector<char> connectionStorage;
+    const auto ports = fakePointers<PortLabel>(portStorage, 3);
+    const auto connections = fakePointers<ConnectionItem>(connectionStorage, 3);
+
+    PortTable table;
+    table.addConnection(ports[0], PortTable::Kind::Input, connections[0]);
+    table.addConnection(ports[1], PortTable::Kind::Output, connections[1]);
+    table.addConnection(ports[1], PortTable::Kind::Output, connections[2]);
+    table.addConnection(ports[2], PortTable::Kind::Parameter, connections[2]);
+
+    EXPECT_EQ(table.removeConnection(connections[2]), 2);
+    EXPECT_EQ(table.removeConnection(connections[2]), 0);
+    EXPECT_EQ(toVector(table.connections(ports[1])), std::vector<ConnectionItem*>{connections[1]});
+    EXPECT_TRUE(table.connections(ports[2]).isEmpty());
+    EXPECT_TRUE(table.contains(ports[2]));
+
+    EXPECT_TRUE(table.removePort(ports[0]));
+    EXPECT_FALSE(table.removePort(ports[0]));
+    EXPECT_EQ(table.portCount(), 2);
+    EXPECT_EQ(table.connectionCount(), 1);
+    EXPECT_EQ(toVector(table.connections(ports[1])), std::vector<ConnectionItem*>{connections[1]});
+
+    // Re-adding a port changes its kind but keeps its connections.
+    table.addPort(ports[1], PortTable::Kind::Input);
+    EXPECT_EQ(table.portAt(table.indexOf(ports[1])).kind, PortTable::Kind::Input);
+    EXPECT_EQ(table.connections(ports[1]).size(), 1);
+}
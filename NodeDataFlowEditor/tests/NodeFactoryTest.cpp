@@ -22,6 +22,7 @@
     THE SOFTWARE.
 */
 
+#include "factory/NodeDefinition.hpp"
 #include "factory/NodeFactory.hpp"
 #include "model/NodeModel.hpp"
 #include "utility/GraphRegistry.hpp"
@@ -29,6 +30,7 @@
 #include "view/NodeItemViewAdapter.hpp"
 #include "view/PortLabel.hpp"
 #include <QApplication>
+#include <QSpinBox>
 #include <QThread>
 #include <QWidget>
 #include <gtest/gtest.h>
@@ -39,6 +41,22 @@ public:
     struct ValueHolder
     {};
 
+    struct ImageTag
+    {};
+
+    struct ScaleNode
+    {
+        static constexpr const char* name = "Scale";
+        static constexpr QRgb color = qRgb(70, 160, 230);
+        static constexpr auto ports = std::make_tuple(
+            nodedef::Input<ImageTag>{"image", "input image"},
+            nodedef::Output<ImageTag>{"image"},
+            nodedef::Parameter<QSpinBox, ValueHolder<int>>{"factor", "scale factor", [](QSpinBox* w) {
+                                                               w->setRange(1, 16);
+                                                               w->setValue(4);
+                                                           }});
+    };
+
 protected:
     static void SetUpTestSuite()
     {
@@ -274,3 +292,58 @@ TEST_F(NodeFactoryTest, changesFromModelRecievedInView)
     node->model->setActive(true);
     EXPECT_TRUE(node->adapter->active());
 }
+
+TEST_F(NodeFactoryTest, CreateDeclaredNode)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto node = factory->create<ScaleNode>(scene.get(), QPointF(5, 6));
+
+    ASSERT_NE(node->item, nullptr);
+    EXPECT_EQ(node->item->nodeName(), "Scale");
+    EXPECT_EQ(node->item->nodeNameColor(), QColor(70, 160, 230));
+    EXPECT_EQ(node->item->pos(), QPointF(5, 6));
+    EXPECT_NE(registry->findNode("Scale"), nullptr);
+
+    // Ports exist with their declared names and tags, without any tagging call.
+    PortLabel* in = factory->getInputPortByName(*node, "image");
+    PortLabel* out = factory->getOutputPortByName(*node, "image");
+    PortLabel* factor = factory->getParameterPortByName(*node, "factor");
+    ASSERT_NE(in, nullptr);
+    ASSERT_NE(out, nullptr);
+    ASSERT_NE(factor, nullptr);
+    EXPECT_EQ(in->displayName(), "input image");
+    EXPECT_EQ(out->displayName(), "image");
+    EXPECT_EQ(factor->displayName(), "scale factor");
+    EXPECT_TRUE(in->hasTag<ImageTag>());
+    EXPECT_TRUE(out->hasTag<ImageTag>());
+    EXPECT_TRUE(factor->hasTag<ValueHolder<int>>());
+    EXPECT_FALSE(in->hasTag<ValueHolder<int>>());
+
+    // The parameter widget was built and configured from its declaration.
+    auto* spin = qobject_cast<QSpinBox*>(node->item->getParameterWidget(factor));
+    ASSERT_NE(spin, nullptr);
+    EXPECT_EQ(spin->maximum(), 16);
+    EXPECT_EQ(spin->value(), 4);
+
+    // The model knows the tags too.
+    ASSERT_EQ(node->model->ports().size(), 2);
+    EXPECT_EQ(node->model->ports().front().tags, TagRegistry::maskOf<ImageTag>());
+}
+
+TEST_F(NodeFactoryTest, DeclaredNodesConnectLikeTaggedNodes)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+
+    auto first = factory->create<ScaleNode>(scene.get());
+    auto second = factory->create<ScaleNode>(scene.get(), QPointF(300, 0));
+
+    EXPECT_NE(factory->createConnection(*scene,
+                                        *factory->getOutputPortByName(*first, "image"),
+                                        *factory->getInputPortByName(*second, "image"),
+                                        false),
+              nullptr);
+}
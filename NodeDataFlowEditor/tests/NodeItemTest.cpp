@@ -23,14 +23,23 @@
 */
 
 #include "view/NodeItem.hpp"
+#include "model/ParameterStore.hpp"
 #include "utility/GraphRegistry.hpp"
+#include "view/ParameterBinder.hpp"
+#include "view/ParameterEditorPool.hpp"
 #include "view/PortLabel.hpp"
 
 #include <QApplication>
 #include <QEvent>
+#include <QGraphicsProxyWidget>
 #include <QGraphicsScene>
 #include <QGraphicsSceneHoverEvent>
 #include <QGraphicsSceneMouseEvent>
+#include <QImage>
+#include <QPainter>
+#include <QPixmapCache>
+#include <QSlider>
+#include <QSpinBox>
 #include <QWidget>
 
 #include <gtest/gtest.h>
@@ -183,3 +192,183 @@ TEST_F(NodeItemTest, Visibility)
     // Then NodeItem should not be visible
     EXPECT_FALSE(node.isVisible());
 }
+
+TEST_F(NodeItemTest, LazyParametersBorrowEditorsOnlyWhileHovered)
+{
+    // Given a lazy NodeItem with one parameter widget
+    TestableNodeItem node(registry, "LazyNode");
+    scene->addItem(&node);
+    node.setLazyParameters(true);
+    auto* spin = new QSpinBox();
+    spin->setRange(0, 100);
+    PortLabel* param = node.addParameter(spin, "Param1");
+
+    // Then no proxy exists until the mouse reaches the parameter
+    EXPECT_EQ(node.parameterPorts().value(param), nullptr);
+    EXPECT_FALSE(node.parameterRect(param).isEmpty());
+
+    // When hovering the parameter row
+    QGraphicsSceneHoverEvent hoverMove(QEvent::GraphicsSceneHoverMove);
+    hoverMove.setPos(node.parameterRect(param).center());
+    node.publicSceneEvent(&hoverMove);
+
+    // Then a pooled editor of the same kind stands in for the widget
+    QGraphicsProxyWidget* proxy = node.parameterPorts().value(param);
+    ASSERT_NE(proxy, nullptr);
+    EXPECT_TRUE(proxy->isVisible());
+    auto* editor = qobject_cast<QSpinBox*>(proxy->widget());
+    ASSERT_NE(editor, nullptr);
+    EXPECT_NE(editor, spin);
+    EXPECT_EQ(editor->maximum(), 100);
+
+    // And its edits reach the parked widget
+    editor->setValue(42);
+    registry->parameterStore().flush();
+    EXPECT_EQ(spin->value(), 42);
+
+    // When the mouse leaves the node
+    QGraphicsSceneHoverEvent hoverLeave(QEvent::GraphicsSceneHoverLeave);
+    node.publicSceneEvent(&hoverLeave);
+
+    // Then the proxy and editor go back to the pool
+    EXPECT_EQ(node.parameterPorts().value(param), nullptr);
+    EXPECT_EQ(registry->parameterEditorPool().idleEditorCount(), 1);
+    EXPECT_EQ(registry->parameterEditorPool().idleProxyCount(), 1);
+
+    // And the next hover reuses them
+    node.publicSceneEvent(&hoverMove);
+    ASSERT_NE(node.parameterPorts().value(param), nullptr);
+    EXPECT_EQ(node.parameterPorts().value(param)->widget(), editor);
+    EXPECT_EQ(registry->parameterEditorPool().idleEditorCount(), 0);
+    node.publicSceneEvent(&hoverLeave);
+
+    // When lazy mode is turned off, the widget itself is embedded and always shown
+    node.setLazyParameters(false);
+    ASSERT_NE(node.parameterPorts().value(param), nullptr);
+    EXPECT_EQ(node.parameterPorts().value(param)->widget(), spin);
+    EXPECT_TRUE(node.parameterPorts().value(param)->isVisible());
+}
+
+TEST_F(NodeItemTest, LazyParameterEditorReceivesTheFirstPress)
+{
+    // Given a lazy node whose slider has no editor yet
+    TestableNodeItem node(registry, "Pressed");
+    scene->addItem(&node);
+    node.setLazyParameters(true);
+    auto* slider = new QSlider(Qt::Horizontal);
+    slider->setRange(0, 100);
+    slider->setValue(0);
+    PortLabel* param = node.addParameter(slider, "Value");
+    const QRectF area = node.parameterRect(param);
+
+    // When the parameter is pressed without any hover first, near the end of the groove
+    QGraphicsSceneMouseEvent press(QEvent::GraphicsSceneMousePress);
+    press.setButton(Qt::LeftButton);
+    press.setButtons(Qt::LeftButton);
+    press.setPos(QPointF(area.right() - 2, area.center().y()));
+    press.setButtonDownPos(Qt::LeftButton, press.pos());
+    EXPECT_TRUE(node.publicSceneEvent(&press));
+
+    // Then the borrowed editor handled that press and moved towards it
+    QGraphicsProxyWidget* proxy = node.parameterPorts().value(param);
+    ASSERT_NE(proxy, nullptr);
+    auto* editor = qobject_cast<QSlider*>(proxy->widget());
+    ASSERT_NE(editor, nullptr);
+    EXPECT_GT(editor->value(), 0);
+
+    // And the release finishes the click on the editor as well
+    QGraphicsSceneMouseEvent release(QEvent::GraphicsSceneMouseRelease);
+    release.setButton(Qt::LeftButton);
+    release.setPos(press.pos());
+    EXPECT_TRUE(node.publicSceneEvent(&release));
+    registry->parameterStore().flush();
+    EXPECT_EQ(slider->value(), editor->value());
+    scene->removeItem(&node);
+}
+
+TEST_F(NodeItemTest, LazySnapshotsDistinguishSliderRanges)
+{
+    // Given two lazy nodes whose sliders hold the same value over different ranges
+    auto paintSnapshot = [this](const QString& name, int maximum) {
+        TestableNodeItem node(registry, name);
+        scene->addItem(&node);
+        node.setLazyParameters(true);
+        auto* slider = new QSlider(Qt::Horizontal);
+        slider->setRange(0, maximum);
+        slider->setValue(5);
+        PortLabel* param = node.addParameter(slider, "Value");
+        const QRect area = node.parameterRect(param).toRect();
+
+        QImage image(node.boundingRect().size().toSize(), QImage::Format_ARGB32);
+        image.fill(Qt::transparent);
+        QPainter painter(&image);
+        painter.translate(-node.boundingRect().topLeft());
+        node.paint(&painter, nullptr, nullptr);
+        painter.end();
+        scene->removeItem(&node);
+        return image.copy(area.translated(-node.boundingRect().topLeft().toPoint()));
+    };
+    QPixmapCache::clear();
+
+    // When both are painted from the snapshot cache
+    const QImage narrow = paintSnapshot("Narrow", 10);
+    const QImage wide = paintSnapshot("Wide", 100);
+
+    // Then the second node does not reuse the first node's pixmap
+    EXPECT_NE(narrow, wide);
+}
+
+TEST_F(NodeItemTest, LazySnapshotFollowsValueChanges)
+{
+    // Given a lazy node painted once from its snapshot
+    TestableNodeItem node(registry, "Spin");
+    scene->addItem(&node);
+    node.setLazyParameters(true);
+    auto* spin = new QSpinBox();
+    spin->setValue(1);
+    PortLabel* param = node.addParameter(spin, "Value");
+    const QRect area = node.parameterRect(param).toRect();
+    auto paintSnapshot = [&node, &area] {
+        QImage image(node.boundingRect().size().toSize(), QImage::Format_ARGB32);
+        image.fill(Qt::transparent);
+        QPainter painter(&image);
+        painter.translate(-node.boundingRect().topLeft());
+        node.paint(&painter, nullptr, nullptr);
+        painter.end();
+        return image.copy(area.translated(-node.boundingRect().topLeft().toPoint()));
+    };
+    QPixmapCache::clear();
+    const QImage before = paintSnapshot();
+
+    // When the value changes while the editor is parked
+    spin->setValue(42);
+
+    // Then the next paint does not reuse the cached key of the old value
+    EXPECT_NE(paintSnapshot(), before);
+    scene->removeItem(&node);
+}
+
+TEST_F(NodeItemTest, ParametersAreBoundToTheStoreWhenAdded)
+{
+    // Given a node that is not part of any group
+    TestableNodeItem node(registry, "Bound");
+    scene->addItem(&node);
+    auto* spin = new QSpinBox();
+    spin->setValue(3);
+
+    // When a parameter widget is added
+    PortLabel* param = node.addParameter(spin, "Value");
+
+    // Then its value lives in the parameter store under the port's first leaf
+    const ParameterKey key{param->id(), 0};
+    EXPECT_EQ(registry->parameterBinder().keyOf(spin), key);
+    EXPECT_EQ(registry->parameterStore().value(key).toInt(), 3);
+
+    // And edits reach the store
+    spin->setValue(8);
+    EXPECT_EQ(registry->parameterStore().value(key).toInt(), 8);
+
+    // And removing the parameter forgets the value
+    node.removeParamInput(param);
+    EXPECT_FALSE(registry->parameterStore().contains(key));
+}
@@ -0,0 +1,207 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <QApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/NodeDescriptor.hpp"
+#include "utility/NodeProfiler.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class NodeProfilerTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static NodeProfileSample sample(qint64 wallNs, qint64 bytesIn = 0)
+    {
+        NodeProfileSample s;
+        s.wallNs = wallNs;
+        s.cpuNs = wallNs / 2;
+        s.bytesIn = bytesIn;
+        return s;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* NodeProfilerTest::app = nullptr;
+
+TEST_F(NodeProfilerTest, DisabledProfilerRecordsNothing)
+{
+    NodeProfiler profiler;
+    profiler.record(1, sample(100));
+    {
+        NodeProfiler::Scope scope(profiler, 2);
+    }
+
+    EXPECT_TRUE(profiler.stats().isEmpty());
+    EXPECT_EQ(profiler.revision(), 0u);
+}
+
+TEST_F(NodeProfilerTest, AggregatesAndRanksNodes)
+{
+    NodeProfiler profiler;
+    profiler.setEnabled(true);
+    profiler.record(1, sample(100, 8));
+    profiler.record(1, sample(300, 8));
+    profiler.record(2, sample(1000));
+    profiler.record(3, sample(10));
+
+    const NodeProfileStats one = profiler.stats(1);
+    EXPECT_EQ(one.invocations, 2u);
+    EXPECT_EQ(one.wallNs, 400);
+    EXPECT_EQ(one.cpuNs, 200);
+    EXPECT_EQ(one.maxWallNs, 300);
+    EXPECT_EQ(one.bytesIn, 16);
+
+    const QVector<NodeProfileStats> all = profiler.stats();
+    ASSERT_EQ(all.size(), 3);
+    EXPECT_EQ(all[0].uid, 2);
+    EXPECT_DOUBLE_EQ(all[0].percentile, 1.0);
+    EXPECT_DOUBLE_EQ(all[1].percentile, 0.5);
+    EXPECT_EQ(all[2].uid, 3);
+    EXPECT_DOUBLE_EQ(all[2].percentile, 0.0);
+
+    const QStringList lines = profiler.toCsv([](qint64 uid) { return QString("Node, %1").arg(uid); })
+                                  .split('\n', Qt::SkipEmptyParts);
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_TRUE(lines[0].startsWith("uid,name,invocations,wall_ms"));
+    EXPECT_TRUE(lines[1].startsWith("2,\"Node, 2\",1,"));
+}
+
+TEST_F(NodeProfilerTest, RecordsFromWorkerThreads)
+{
+    NodeProfiler profiler;
+    profiler.setEnabled(true);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t)
+        workers.emplace_back([&profiler] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                NodeProfiler::Scope scope(profiler, i % 10);
+                scope.addBytesOut(4);
+            }
+        });
+    for (auto& worker : workers)
+        worker.join();
+
+    quint64 invocations = 0;
+    for (const NodeProfileStats& s : profiler.stats())
+    {
+        invocations += s.invocations;
+        EXPECT_EQ(s.bytesOut, 4 * 400);
+    }
+    EXPECT_EQ(invocations, 4000u);
+    EXPECT_EQ(profiler.revision(), 4000u);
+}
+
+TEST_F(NodeProfilerTest, OverlayFollowsTheProfiler)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+    auto cheap = factory->createNode(scene.get(), "Cheap");
+    auto costly = factory->createNode(scene.get(), "Costly");
+    auto idle = factory->createNode(scene.get(), "Idle");
+
+    auto profiler = scene->getNodeProfiler();
+    scene->setProfileOverlay(true);
+    EXPECT_TRUE(profiler->isEnabled());
+
+    profiler->record(registry->getNode(cheap->item)->uid, sample(1000));
+    profiler->record(registry->getNode(costly->item)->uid, sample(5000000));
+    // Let the throttled refresh run once.
+    QEventLoop loop;
+    QTimer::singleShot(400, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    EXPECT_TRUE(cheap->item->hasProfileOverlay());
+    EXPECT_TRUE(costly->item->hasProfileOverlay());
+    EXPECT_FALSE(idle->item->hasProfileOverlay());
+
+    scene->setProfileOverlay(false);
+    EXPECT_FALSE(cheap->item->hasProfileOverlay());
+    EXPECT_FALSE(costly->item->hasProfileOverlay());
+}
+
+TEST_F(NodeProfilerTest, OverlayRestoresTheProfilerState)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto profiler = scene->getNodeProfiler();
+
+    scene->setProfileOverlay(true);
+    scene->setProfileOverlay(false);
+    EXPECT_FALSE(profiler->isEnabled());
+
+    profiler->setEnabled(true);
+    scene->setProfileOverlay(true);
+    scene->setProfileOverlay(false);
+    EXPECT_TRUE(profiler->isEnabled());
+}
+
+TEST_F(NodeProfilerTest, DeletedNodesAreForgotten)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+    auto kept = factory->createNode(scene.get(), "Kept");
+    auto deleted = factory->createNode(scene.get(), "Deleted");
+
+    auto profiler = scene->getNodeProfiler();
+    profiler->setEnabled(true);
+    const qint64 keptUid = registry->getNode(kept->item)->uid;
+    const qint64 deletedUid = registry->getNode(deleted->item)->uid;
+    profiler->record(keptUid, sample(1000));
+    profiler->record(deletedUid, sample(1000));
+
+    scene->deleteItems({deleted->item});
+    EXPECT_EQ(profiler->stats(keptUid).invocations, 1u);
+    EXPECT_EQ(profiler->stats(deletedUid).invocations, 0u);
+    EXPECT_EQ(profiler->stats().size(), 1);
+}
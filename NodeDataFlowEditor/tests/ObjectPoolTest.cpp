@@ -0,0 +1,84 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/ObjectPool.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+
+namespace
+{
+    struct Counted
+    {
+        static int alive;
+        std::string name;
+
+        explicit Counted(std::string n)
+            : name(std::move(n))
+        {
+            ++alive;
+        }
+        ~Counted() { --alive; }
+    };
+
+    int Counted::alive = 0;
+} // namespace
+
+TEST(ObjectPoolTest, CreateConstructsAndDestroyDestructs)
+{
+    ObjectPool<Counted, 4> pool;
+
+    Counted* a = pool.create("a");
+    Counted* b = pool.create("b");
+    EXPECT_EQ(a->name, "a");
+    EXPECT_EQ(b->name, "b");
+    EXPECT_EQ(Counted::alive, 2);
+    EXPECT_EQ(pool.size(), 2u);
+
+    pool.destroy(a);
+    pool.destroy(b);
+    EXPECT_EQ(Counted::alive, 0);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(ObjectPoolTest, FreedSlotsAreReusedBeforeGrowing)
+{
+    ObjectPool<Counted, 4> pool;
+
+    Counted* first = pool.create("first");
+    EXPECT_EQ(pool.capacity(), 4u);
+    pool.destroy(first);
+
+    Counted* second = pool.create("second");
+    EXPECT_EQ(second, first);
+
+    // Filling the chunk and one more grows by exactly one chunk.
+    Counted* more[4] = {pool.create("1"), pool.create("2"), pool.create("3"), pool.create("4")};
+    EXPECT_EQ(pool.capacity(), 8u);
+
+    for (Counted* c : more)
+        pool.destroy(c);
+    pool.destroy(second);
+    EXPECT_EQ(Counted::alive, 0);
+}
@@ -0,0 +1,219 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/ParameterBinder.hpp"
+
+#include <QApplication>
+#include <QCheckBox>
+#include <QLineEdit>
+#include <QSpinBox>
+#include <QVBoxLayout>
+#include <gtest/gtest.h>
+
+// -----------------------------------------------------------------------------
+// Test Fixture
+// -----------------------------------------------------------------------------
+class ParameterBinderTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static constexpr PortId portA = 1;
+    static constexpr PortId portB = 2;
+
+    ParameterStore store;
+    ParameterBinder binder{store};
+
+    static QApplication* app;
+};
+
+QApplication* ParameterBinderTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+TEST_F(ParameterBinderTest, FirstBindingSeedsValueAndLaterBindingsFollow)
+{
+    QSpinBox first;
+    first.setRange(0, 100);
+    first.setValue(42);
+    QSpinBox second;
+    second.setRange(0, 100);
+
+    EXPECT_TRUE(binder.bind(portA, &first));
+    EXPECT_TRUE(binder.bind(portA, &second));
+
+    EXPECT_EQ(store.value(portA).toInt(), 42);
+    EXPECT_EQ(second.value(), 42);
+    EXPECT_EQ(binder.boundViewCount(portA), 2);
+}
+
+TEST_F(ParameterBinderTest, EditsAreCoalescedUntilFlush)
+{
+    QSpinBox source;
+    source.setRange(0, 100);
+    QSpinBox mirror;
+    mirror.setRange(0, 100);
+    binder.bind(portA, &source);
+    binder.bind(portA, &mirror);
+
+    // When the user drags through several values within one frame
+    source.setValue(1);
+    source.setValue(2);
+    source.setValue(3);
+
+    // Then nothing is fanned out before the frame ends
+    EXPECT_EQ(mirror.value(), 0);
+    EXPECT_EQ(store.value(portA).toInt(), 3);
+
+    // And only the last value reaches the other view
+    store.flush();
+    EXPECT_EQ(mirror.value(), 3);
+}
+
+TEST_F(ParameterBinderTest, UpdatesReachOnlyViewsOfTheSamePort)
+{
+    QSpinBox a1;
+    QSpinBox a2;
+    QSpinBox b1;
+    a1.setRange(0, 100);
+    a2.setRange(0, 100);
+    b1.setRange(0, 100);
+    binder.bind(portA, &a1);
+    binder.bind(portA, &a2);
+    binder.bind(portB, &b1);
+
+    a1.setValue(7);
+    store.flush();
+
+    EXPECT_EQ(a2.value(), 7);
+    EXPECT_EQ(b1.value(), 0);
+}
+
+TEST_F(ParameterBinderTest, MismatchedWidgetTypeIsNotWritten)
+{
+    QSpinBox spin;
+    spin.setRange(0, 100);
+    QCheckBox check;
+    binder.bind(portA, &spin);
+    binder.bind(portA, &check);
+
+    spin.setValue(5);
+    store.flush();
+
+    EXPECT_FALSE(check.isChecked());
+}
+
+TEST_F(ParameterBinderTest, DestroyedWidgetIsUnbound)
+{
+    QSpinBox kept;
+    binder.bind(portA, &kept);
+    {
+        QSpinBox temporary;
+        binder.bind(portA, &temporary);
+        EXPECT_EQ(binder.boundViewCount(portA), 2);
+    }
+    EXPECT_EQ(binder.boundViewCount(portA), 1);
+}
+
+TEST_F(ParameterBinderTest, RemovedPortUnbindsItsWidgets)
+{
+    QSpinBox spin;
+    spin.setRange(0, 100);
+    binder.bind(portA, &spin);
+
+    store.removePort(portA);
+    spin.setValue(5);
+
+    EXPECT_EQ(binder.boundViewCount(portA), 0);
+    EXPECT_FALSE(store.contains(portA));
+}
+
+TEST_F(ParameterBinderTest, EditorsInOneContainerGetTheirOwnValues)
+{
+    // Given a container parameter with two spin boxes and a line edit
+    QWidget container;
+    auto* layout = new QVBoxLayout(&container);
+    auto* first = new QSpinBox;
+    auto* second = new QSpinBox;
+    auto* text = new QLineEdit;
+    first->setRange(0, 100);
+    second->setRange(0, 100);
+    layout->addWidget(first);
+    layout->addWidget(second);
+    layout->addWidget(text);
+
+    EXPECT_EQ(binder.bindEditors(portA, &container), 3);
+    EXPECT_EQ(binder.keyOf(first), ParameterKey(portA, 0));
+    EXPECT_EQ(binder.keyOf(second), ParameterKey(portA, 1));
+    EXPECT_EQ(binder.keyOf(text), ParameterKey(portA, 2));
+
+    // And a mirror of the first spin box only
+    QSpinBox mirror;
+    mirror.setRange(0, 100);
+    binder.bind(binder.keyOf(first), &mirror);
+
+    // When the user edits the first spin box
+    first->setValue(7);
+    store.flush();
+
+    // Then its sibling keeps its value and only the mirror follows
+    EXPECT_EQ(second->value(), 0);
+    EXPECT_EQ(mirror.value(), 7);
+}
+
+TEST_F(ParameterBinderTest, BindEditorsSkipsBoundWidgetsAndReusesReplacedKeys)
+{
+    QSpinBox original;
+    original.setRange(0, 100);
+    original.setValue(12);
+    binder.bindEditors(portA, &original);
+
+    QSpinBox mirror;
+    mirror.setRange(0, 100);
+    binder.bind(binder.keyOf(&original), &mirror);
+
+    // An already bound widget keeps its key
+    EXPECT_EQ(binder.bindEditors(portB, &mirror), 0);
+    EXPECT_EQ(binder.keyOf(&mirror), ParameterKey(portA, 0));
+
+    // A replacement editor takes over the replaced one's value and mirrors
+    QSpinBox replacement;
+    replacement.setRange(0, 100);
+    EXPECT_EQ(binder.bindEditors(portA, &replacement, &original), 1);
+    EXPECT_EQ(binder.keyOf(&original).port, invalidGraphId);
+    EXPECT_EQ(binder.keyOf(&replacement), ParameterKey(portA, 0));
+    EXPECT_EQ(replacement.value(), 12);
+}
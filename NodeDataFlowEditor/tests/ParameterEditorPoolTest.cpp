@@ -0,0 +1,132 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/ParameterEditorPool.hpp"
+#include "model/ParameterStore.hpp"
+#include "view/ParameterBinder.hpp"
+
+#include <QApplication>
+#include <QComboBox>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+#include <QSpinBox>
+#include <gtest/gtest.h>
+
+// -----------------------------------------------------------------------------
+// Test Fixture
+// -----------------------------------------------------------------------------
+class ParameterEditorPoolTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static constexpr PortId portA = 1;
+
+    ParameterStore store;
+    ParameterBinder binder{store};
+    ParameterEditorPool pool{binder, 1};
+    QGraphicsScene scene;
+    QGraphicsRectItem* parent = scene.addRect(0, 0, 100, 100);
+
+    static QApplication* app;
+};
+
+QApplication* ParameterEditorPoolTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+TEST_F(ParameterEditorPoolTest, LentEditorIsSetUpLikeTheSource)
+{
+    // Given a bound combo box parked off-scene
+    QComboBox source;
+    source.addItems({"low", "mid", "high"});
+    source.setCurrentIndex(2);
+    binder.bind(portA, &source);
+
+    // When an editor is borrowed for it
+    QGraphicsProxyWidget* proxy = pool.acquire(&source, parent);
+
+    // Then the editor is another combo box with the same choices and value
+    auto* editor = qobject_cast<QComboBox*>(proxy->widget());
+    ASSERT_NE(editor, nullptr);
+    EXPECT_NE(editor, &source);
+    EXPECT_EQ(proxy->parentItem(), parent);
+    EXPECT_EQ(editor->count(), 3);
+    EXPECT_EQ(editor->currentIndex(), 2);
+    EXPECT_EQ(binder.keyOf(editor), ParameterKey(portA));
+
+    // When it is given back
+    pool.release(proxy, &source);
+
+    // Then it is unbound, off-scene and kept for the next borrower
+    EXPECT_EQ(binder.keyOf(editor).port, invalidGraphId);
+    EXPECT_EQ(proxy->scene(), nullptr);
+    EXPECT_EQ(pool.idleEditorCount(), 1);
+    EXPECT_EQ(pool.idleProxyCount(), 1);
+}
+
+TEST_F(ParameterEditorPoolTest, UnboundSourceIsEmbeddedItself)
+{
+    // Given a spin box that is not bound to any value
+    QSpinBox source;
+
+    // When an editor is borrowed for it, the source itself is embedded
+    QGraphicsProxyWidget* proxy = pool.acquire(&source, parent);
+    EXPECT_EQ(proxy->widget(), &source);
+
+    // And releasing hands the source back hidden, not to the editor pool
+    pool.release(proxy, &source);
+    EXPECT_EQ(source.graphicsProxyWidget(), nullptr);
+    EXPECT_FALSE(source.isVisible());
+    EXPECT_EQ(pool.idleEditorCount(), 0);
+}
+
+TEST_F(ParameterEditorPoolTest, IdleListsAreCapped)
+{
+    QSpinBox first;
+    QSpinBox second;
+    binder.bind(portA, &first);
+    binder.bind({portA, 1}, &second);
+
+    QGraphicsProxyWidget* a = pool.acquire(&first, parent);
+    QGraphicsProxyWidget* b = pool.acquire(&second, parent);
+    pool.release(a, &first);
+    pool.release(b, &second);
+
+    EXPECT_EQ(pool.idleEditorCount(), 1);
+    EXPECT_EQ(pool.idleProxyCount(), 1);
+}
@@ -0,0 +1,172 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "model/ParameterStore.hpp"
+
+#include <QCoreApplication>
+#include <QVector>
+#include <gtest/gtest.h>
+
+// -----------------------------------------------------------------------------
+// Test Fixture
+// -----------------------------------------------------------------------------
+class ParameterStoreTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QCoreApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static constexpr PortId portA = 1;
+    static constexpr PortId portB = 2;
+
+    static QCoreApplication* app;
+};
+
+QCoreApplication* ParameterStoreTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+TEST_F(ParameterStoreTest, FirstValueSeedsThePort)
+{
+    ParameterStore store;
+
+    EXPECT_TRUE(store.addPort(portA, ParameterStore::ValueType::Int, 42));
+    EXPECT_FALSE(store.addPort(portA, ParameterStore::ValueType::Int, 7));
+    EXPECT_FALSE(store.addPort(portB, ParameterStore::ValueType::Invalid, 7));
+    EXPECT_FALSE(store.addPort(invalidGraphId, ParameterStore::ValueType::Int, 7));
+
+    EXPECT_EQ(store.value(portA).toInt(), 42);
+    EXPECT_EQ(store.type(portA), ParameterStore::ValueType::Int);
+    EXPECT_FALSE(store.contains(portB));
+}
+
+TEST_F(ParameterStoreTest, EditsAreCoalescedUntilFlush)
+{
+    ParameterStore store;
+    store.addPort(portA, ParameterStore::ValueType::Int, 0);
+    QObject editor;
+
+    QVector<QVariant> announced;
+    QObject* announcedOrigin = nullptr;
+    QObject::connect(&store,
+                     &ParameterStore::sgnValueChanged,
+                     [&](ParameterKey key, const QVariant& value, QObject* origin) {
+                         EXPECT_EQ(key, ParameterKey(portA));
+                         announced.append(value);
+                         announcedOrigin = origin;
+                     });
+
+    // When the user drags through several values within one frame
+    store.setValue(portA, 1, &editor);
+    store.setValue(portA, 2, &editor);
+    store.setValue(portA, 3, &editor);
+
+    // Then nothing is announced before the frame ends
+    EXPECT_TRUE(announced.isEmpty());
+    EXPECT_EQ(store.value(portA).toInt(), 3);
+
+    // And only the last value is announced, once, with its origin
+    store.flush();
+    ASSERT_EQ(announced.size(), 1);
+    EXPECT_EQ(announced.first().toInt(), 3);
+    EXPECT_EQ(announcedOrigin, &editor);
+}
+
+TEST_F(ParameterStoreTest, DestroyedOriginIsNotReported)
+{
+    ParameterStore store;
+    store.addPort(portA, ParameterStore::ValueType::Int, 0);
+
+    QObject* announcedOrigin = &store;
+    QObject::connect(&store, &ParameterStore::sgnValueChanged, [&](ParameterKey, const QVariant&, QObject* origin) {
+        announcedOrigin = origin;
+    });
+    {
+        QObject editor;
+        store.setValue(portA, 5, &editor);
+    }
+    store.flush();
+
+    EXPECT_EQ(announcedOrigin, nullptr);
+}
+
+TEST_F(ParameterStoreTest, RemovedPortDropsPendingValue)
+{
+    ParameterStore store;
+    store.addPort(portA, ParameterStore::ValueType::Int, 0);
+
+    PortId removed = invalidGraphId;
+    int notifications = 0;
+    QObject::connect(&store, &ParameterStore::sgnPortRemoved, [&](PortId port) { removed = port; });
+    QObject::connect(&store, &ParameterStore::sgnValueChanged, [&](ParameterKey, const QVariant&, QObject*) {
+        ++notifications;
+    });
+
+    store.setValue(portA, 9);
+    store.removePort(portA);
+    store.flush();
+
+    EXPECT_EQ(removed, portA);
+    EXPECT_EQ(notifications, 0);
+    EXPECT_FALSE(store.contains(portA));
+    EXPECT_FALSE(store.value(portA).isValid());
+}
+
+TEST_F(ParameterStoreTest, LeavesOfOnePortHoldSeparateValues)
+{
+    ParameterStore store;
+    store.addPort({portA, 0}, ParameterStore::ValueType::Int, 1);
+    store.addPort({portA, 1}, ParameterStore::ValueType::String, QStringLiteral("x"));
+
+    QVector<ParameterKey> announced;
+    QObject::connect(&store, &ParameterStore::sgnValueChanged, [&](ParameterKey key, const QVariant&, QObject*) {
+        announced.append(key);
+    });
+
+    store.setValue({portA, 1}, QStringLiteral("y"));
+    store.flush();
+
+    ASSERT_EQ(announced.size(), 1);
+    EXPECT_EQ(announced.first(), ParameterKey(portA, 1));
+    EXPECT_EQ(store.value({portA, 0}).toInt(), 1);
+    EXPECT_EQ(store.type({portA, 1}), ParameterStore::ValueType::String);
+    EXPECT_EQ(store.leafCount(portA), 2);
+
+    // Removing the port drops every leaf
+    store.removePort(portA);
+    EXPECT_FALSE(store.contains({portA, 0}));
+    EXPECT_FALSE(store.contains({portA, 1}));
+    EXPECT_EQ(store.leafCount(portA), 0);
+}
@@ -0,0 +1,202 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <QApplication>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/BufferPool.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "utility/Payload.hpp"
+#include "utility/PayloadRouter.hpp"
+#include "view/GraphScene.hpp"
+
+#include <cstring>
+#include <memory>
+
+namespace data
+{
+    struct ImageType
+    {};
+    template <typename T>
+    struct ValueWrapper
+    {};
+} // namespace data
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class PayloadTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* PayloadTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Payload
+// -----------------------------------------------------------------------------
+TEST_F(PayloadTest, CopiesShareUntilMutated)
+{
+    const Payload original = Payload::make<data::ValueWrapper<int>>(QVector<int>{1, 2, 3});
+    Payload copy = original;
+
+    EXPECT_TRUE(copy.sharesDataWith(original));
+    EXPECT_EQ(original.useCount(), 2);
+    EXPECT_EQ(copy.get<QString>(), nullptr);
+    EXPECT_EQ(copy.mutate<QString>(), nullptr);
+
+    QVector<int>* values = copy.mutate<QVector<int>>();
+    ASSERT_NE(values, nullptr);
+    values->append(4);
+
+    EXPECT_FALSE(copy.sharesDataWith(original));
+    EXPECT_EQ(original.get<QVector<int>>()->size(), 3);
+    EXPECT_EQ(copy.get<QVector<int>>()->size(), 4);
+
+    // The sole owner mutates in place.
+    const QVector<int>* before = copy.get<QVector<int>>();
+    EXPECT_EQ(copy.mutate<QVector<int>>(), before);
+}
+
+TEST_F(PayloadTest, PayloadsCarryTheirTag)
+{
+    const Payload image = Payload::make<data::ImageType>(QByteArray(16, '\0'));
+    TagBitMask imagePort;
+    imagePort.set(TagRegistry::getTagIndex<data::ImageType>());
+    TagBitMask valuePort;
+    valuePort.set(TagRegistry::getTagIndex<data::ValueWrapper<int>>());
+
+    EXPECT_TRUE(image.acceptedBy(imagePort));
+    EXPECT_FALSE(image.acceptedBy(valuePort));
+    EXPECT_FALSE(Payload().acceptedBy(imagePort));
+}
+
+// -----------------------------------------------------------------------------
+// BufferPool
+// -----------------------------------------------------------------------------
+TEST_F(PayloadTest, PoolRecyclesBuffers)
+{
+    auto pool = BufferPool::create();
+    const std::byte* first = nullptr;
+    {
+        PooledBuffer buffer = pool->acquire(100000);
+        first = buffer.data();
+        EXPECT_EQ(buffer.size(), 100000u);
+        EXPECT_EQ(buffer.capacity(), 131072u);
+    }
+    EXPECT_EQ(pool->cachedBytes(), 131072u);
+
+    PooledBuffer again = pool->acquire(120000);
+    EXPECT_EQ(again.data(), first);
+    EXPECT_EQ(pool->hits(), 1u);
+    EXPECT_EQ(pool->misses(), 1u);
+    EXPECT_EQ(pool->cachedBytes(), 0u);
+}
+
+TEST_F(PayloadTest, CopyOnWriteClonesIntoThePool)
+{
+    auto pool = BufferPool::create();
+    PooledBuffer pixels = pool->acquire(64 * 64 * 4);
+    std::memset(pixels.data(), 7, pixels.size());
+
+    const Payload shared = Payload::make<data::ImageType>(std::move(pixels));
+    Payload mine = shared;
+    PooledBuffer* writable = mine.mutate<PooledBuffer>();
+    ASSERT_NE(writable, nullptr);
+    writable->data()[0] = std::byte{1};
+
+    EXPECT_EQ(shared.get<PooledBuffer>()->data()[0], std::byte{7});
+    EXPECT_EQ(writable->data()[1], std::byte{7});
+    EXPECT_EQ(pool->misses(), 2u);
+
+    // Dropping the clone hands its storage back for the next frame.
+    mine = Payload();
+    pool->acquire(64 * 64 * 4);
+    EXPECT_EQ(pool->hits(), 1u);
+}
+
+// -----------------------------------------------------------------------------
+// PayloadRouter
+// -----------------------------------------------------------------------------
+TEST_F(PayloadTest, FanOutSharesOnePayload)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = factory->createNode(scene.get(), "Src");
+    auto left = factory->createNode(scene.get(), "Left");
+    auto right = factory->createNode(scene.get(), "Right");
+    factory->addOutput(*src, "out");
+    factory->addOutputTag<data::ImageType>(*src, "out");
+    for (auto* dst : {left.get(), right.get()})
+    {
+        factory->addInput(*dst, "in");
+        factory->addInputTag<data::ImageType>(*dst, "in");
+        ASSERT_NE(factory->createConnection(*scene,
+                                            *factory->getOutputPortByName(*src, "out"),
+                                            *factory->getInputPortByName(*dst, "in"),
+                                            false),
+                  nullptr);
+    }
+
+    auto snapshot = registry->snapshot();
+    const PortId output = snapshot->node(registry->getNode(src->item)->uid)->outputs.front().id;
+    const PortId leftInput = snapshot->node(registry->getNode(left->item)->uid)->inputs.front().id;
+    const PortId rightInput = snapshot->node(registry->getNode(right->item)->uid)->inputs.front().id;
+
+    PayloadRouter router;
+    router.setSnapshot(*snapshot);
+    EXPECT_EQ(router.fanOut(output), 2);
+
+    auto pool = BufferPool::create();
+    const Payload frame = Payload::make<data::ImageType>(pool->acquire(1 << 20));
+    EXPECT_EQ(router.publish(output, frame), 2);
+    EXPECT_TRUE(router.input(leftInput).sharesDataWith(frame));
+    EXPECT_TRUE(router.input(rightInput).sharesDataWith(frame));
+    EXPECT_EQ(pool->misses(), 1u);
+
+    // A payload of another type is not delivered.
+    EXPECT_EQ(router.publish(output, Payload::make<data::ValueWrapper<int>>(3)), 0);
+
+    Payload taken = router.take(leftInput);
+    EXPECT_TRUE(taken.sharesDataWith(frame));
+    EXPECT_TRUE(router.input(leftInput).isNull());
+}
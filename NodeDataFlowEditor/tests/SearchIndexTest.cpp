@@ -0,0 +1,138 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/SearchIndex.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/PortLabel.hpp"
+
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class SearchIndexTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static QVector<qint64> nodesOf(const QVector<SearchHit>& hits)
+    {
+        QVector<qint64> nodes;
+        for (const SearchHit& hit : hits)
+            nodes.append(hit.node);
+        return nodes;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* SearchIndexTest::app = nullptr;
+
+TEST_F(SearchIndexTest, RanksExactThenPrefixThenSubstringThenTypos)
+{
+    SearchIndex index;
+    index.addTerm(1, SearchHit::Field::Name, "fast_gaussian");
+    index.addTerm(2, SearchHit::Field::Name, "gausian");
+    index.addTerm(3, SearchHit::Field::Name, "Gaussian_Blur");
+    index.addTerm(4, SearchHit::Field::Name, "median");
+    index.addTerm(5, SearchHit::Field::Name, "Gaussian");
+
+    const QVector<SearchHit> hits = index.search("gaussian");
+
+    EXPECT_EQ(nodesOf(hits), QVector<qint64>({5, 3, 1, 2}));
+    EXPECT_EQ(hits.first().text, QString("Gaussian"));
+}
+
+TEST_F(SearchIndexTest, ShortQueriesMatchPrefixes)
+{
+    SearchIndex index;
+    index.addTerm(1, SearchHit::Field::Name, "pad");
+    index.addTerm(2, SearchHit::Field::Name, "adder");
+    index.addTerm(3, SearchHit::Field::Name, "add");
+
+    EXPECT_EQ(nodesOf(index.search("ad")), QVector<qint64>({3, 2}));
+    EXPECT_EQ(nodesOf(index.search("p")), QVector<qint64>({1}));
+}
+
+TEST_F(SearchIndexTest, ReturnsOneHitPerNodeAndRespectsLimit)
+{
+    SearchIndex index;
+    for (int i = 0; i < 10; ++i)
+    {
+        index.addTerm(i, SearchHit::Field::Name, QString("blur%1").arg(i));
+        index.addTerm(i, SearchHit::Field::DisplayedName, QString("Blur %1").arg(i));
+    }
+
+    EXPECT_EQ(index.search("blur", 100).size(), 10);
+    EXPECT_EQ(index.search("blur", 3).size(), 3);
+
+    index.removeNode(4);
+    EXPECT_FALSE(nodesOf(index.search("blur", 100)).contains(4));
+    EXPECT_EQ(index.termCount(), 18);
+}
+
+TEST_F(SearchIndexTest, RegistrySearchFollowsRenamesAndRemovals)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto node = factory->createNode(scene.get(), "Threshold");
+    factory->addInput(*node, "image");
+    const qint64 uid = registry->getNode(node->item)->uid;
+    const PortId port = registry->getInputPortByName(*node->item, "image")->id();
+
+    ASSERT_EQ(nodesOf(registry->search("thresh")), QVector<qint64>({uid}));
+
+    const QVector<SearchHit> portHits = registry->search("image");
+    ASSERT_EQ(portHits.size(), 1);
+    EXPECT_EQ(portHits.first().field, SearchHit::Field::Port);
+    EXPECT_EQ(portHits.first().port, port);
+
+    node->item->setDisplayedNodeName("Binarize");
+    EXPECT_EQ(nodesOf(registry->search("binar")), QVector<qint64>({uid}));
+
+    scene->removeItem(node->item);
+    delete node->item;
+    node->item = nullptr;
+    node.reset();
+
+    EXPECT_TRUE(registry->search("thresh").isEmpty());
+}
@@ -0,0 +1,186 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/SelectionDispatcher.hpp"
+#include "factory/NodeFactory.hpp"
+#include "presenter/NodePresenter.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <QApplication>
+#include <QGraphicsRectItem>
+#include <QKeyEvent>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class SelectionDispatcherTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        for (int i = 0; i < 10; ++i)
+        {
+            nodes.push_back(scene->getNodeFactory()->createNode(scene.get(), QString("N%1").arg(i), Qt::darkCyan, QPointF(i * 200, 0)));
+            QObject::connect(nodes.back()->presenter, &NodePresenter::selectionChanged, [this, i](bool selected) {
+                events.push_back({i, selected});
+            });
+        }
+    }
+
+    void TearDown() override
+    {
+        nodes.clear();
+        scene.reset();
+    }
+
+    std::unique_ptr<GraphScene> scene;
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+    std::vector<std::pair<int, bool>> events; ///< (node index, selected) as seen by presenters.
+
+    static QApplication* app;
+};
+
+QApplication* SelectionDispatcherTest::app = nullptr;
+
+TEST_F(SelectionDispatcherTest, NotifiesOnlyNodesWhoseStateChanged)
+{
+    nodes[3]->item->setSelected(true);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0], std::make_pair(3, true));
+
+    events.clear();
+    nodes[5]->item->setSelected(true);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0], std::make_pair(5, true));
+
+    events.clear();
+    scene->clearSelection();
+    EXPECT_EQ(events.size(), 2u);
+    EXPECT_FALSE(nodes[3]->item->isSelected());
+}
+
+TEST_F(SelectionDispatcherTest, SelectAllDispatchesOnce)
+{
+    QKeyEvent selectAll(QEvent::KeyPress, Qt::Key_A, Qt::ControlModifier);
+    QApplication::sendEvent(scene.get(), &selectAll);
+
+    // One notification per node, all from a single diff.
+    EXPECT_EQ(events.size(), nodes.size());
+    EXPECT_EQ(scene->selectionDispatcher()->notifications(), static_cast<qint64>(nodes.size()));
+    for (const auto& node : nodes)
+        EXPECT_TRUE(node->item->isSelected());
+}
+
+TEST_F(SelectionDispatcherTest, BatchDefersUntilOutermostCloses)
+{
+    {
+        SelectionDispatcher::Batch outer(scene->selectionDispatcher());
+        nodes[0]->item->setSelected(true);
+        {
+            SelectionDispatcher::Batch inner(scene->selectionDispatcher());
+            nodes[1]->item->setSelected(true);
+        }
+        // Selected then deselected inside the batch: no net change, no call.
+        nodes[2]->item->setSelected(true);
+        nodes[2]->item->setSelected(false);
+        EXPECT_TRUE(events.empty());
+    }
+    EXPECT_EQ(events.size(), 2u);
+}
+
+TEST_F(SelectionDispatcherTest, DestroyedReceiverStopsBeingNotified)
+{
+    auto* item = scene->addRect(QRectF(0, 300, 50, 50));
+    item->setFlag(QGraphicsItem::ItemIsSelectable);
+    int calls = 0;
+    {
+        QObject receiver;
+        scene->selectionDispatcher()->watch(item, &receiver, [&calls](bool) { ++calls; });
+        item->setSelected(true);
+        EXPECT_EQ(calls, 1);
+    }
+    item->setSelected(false);
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(events.empty());
+}
+
+TEST_F(SelectionDispatcherTest, OneReceiverWatchesManyItems)
+{
+    QList<QGraphicsRectItem*> items;
+    for (int i = 0; i < 3; ++i)
+    {
+        items.append(scene->addRect(QRectF(i * 100, 300, 50, 50)));
+        items.back()->setFlag(QGraphicsItem::ItemIsSelectable);
+    }
+    int calls = 0;
+    {
+        QObject receiver;
+        for (auto* item : items)
+            scene->selectionDispatcher()->watch(item, &receiver, [&calls](bool) { ++calls; });
+        scene->selectionDispatcher()->unwatch(items[1]);
+
+        items[0]->setSelected(true);
+        items[1]->setSelected(true);
+        EXPECT_EQ(calls, 1);
+    }
+
+    // Every item of the destroyed receiver is dropped at once.
+    items[0]->setSelected(false);
+    items[2]->setSelected(true);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(SelectionDispatcherTest, DeletedNodesAreUnwatched)
+{
+    nodes[4]->item->setSelected(true);
+    nodes[6]->item->setSelected(true);
+    events.clear();
+
+    scene->deleteItems({nodes[4]->item});
+    nodes[4]->item = nullptr;
+    delete nodes[6]->item;
+    nodes[6]->item = nullptr;
+
+    // Neither removed node is told it was deselected while going away.
+    EXPECT_TRUE(events.empty());
+    scene->clearSelection();
+    EXPECT_TRUE(events.empty());
+}
@@ -0,0 +1,301 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#include <QApplication>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "utility/NodeProfiler.hpp"
+#include "utility/StreamPipeline.hpp"
+#include "view/GraphScene.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class StreamPipelineTest : public ::testing::Test
+{
+public:
+    struct FrameTag
+    {};
+
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        factory = scene->getNodeFactory();
+        registry = scene->getGraphRegistry();
+    }
+
+    void TearDown() override
+    {
+        nodes.clear();
+        scene.reset();
+    }
+
+    /// Builds a chain of nodes named after @p names, each "out" wired to the next "in".
+    void chain(const QStringList& names)
+    {
+        for (const QString& name : names)
+        {
+            auto node = factory->createNode(scene.get(), name);
+            factory->addInput(*node, "in");
+            factory->addInputTag<FrameTag>(*node, "in");
+            factory->addOutput(*node, "out");
+            factory->addOutputTag<FrameTag>(*node, "out");
+            if (!nodes.empty())
+                ASSERT_NE(factory->createConnection(*scene,
+                                                    *factory->getOutputPortByName(*nodes.back(), "out"),
+                                                    *factory->getInputPortByName(*node, "in"),
+                                                    false),
+                          nullptr);
+            nodes.push_back(std::move(node));
+        }
+    }
+
+    /// A source emitting the frame index @p count times.
+    static StreamStage source(int count)
+    {
+        return [count](StreamFrame& frame) {
+            frame.setOutput("out", Payload::make<FrameTag>(static_cast<int>(frame.index())));
+            if (frame.index() + 1 == static_cast<quint64>(count))
+                frame.finish();
+        };
+    }
+
+    /// A stage adding one to its input.
+    static StreamStage increment()
+    {
+        return [](StreamFrame& frame) {
+            Payload payload = frame.input("in");
+            if (int* value = payload.mutate<int>())
+                ++*value;
+            frame.setOutput("out", payload);
+        };
+    }
+
+    static void busyWait(std::chrono::microseconds duration)
+    {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+    }
+
+    std::unique_ptr<GraphScene> scene;
+    std::shared_ptr<NodeFactory> factory;
+    std::shared_ptr<GraphRegistry> registry;
+    std::vector<std::unique_ptr<NodeFactory::Node>> nodes;
+
+    static QApplication* app;
+};
+
+QApplication* StreamPipelineTest::app = nullptr;
+
+TEST_F(StreamPipelineTest, FramesFlowInOrder)
+{
+    chain({"Load Image", "Resize", "Normalize", "Sink"});
+
+    std::vector<int> received;
+    StreamPipeline pipeline(registry->snapshot());
+    ASSERT_TRUE(pipeline.setStage("Load Image", source(50)));
+    ASSERT_TRUE(pipeline.setStage("Resize", increment()));
+    ASSERT_TRUE(pipeline.setStage("Normalize", increment()));
+    ASSERT_TRUE(pipeline.setStage("Sink", [&received](StreamFrame& frame) {
+        received.push_back(*frame.input("in").get<int>());
+    }));
+
+    ASSERT_TRUE(pipeline.start());
+    pipeline.waitForFinished();
+
+    ASSERT_EQ(received.size(), 50u);
+    for (int i = 0; i < 50; ++i)
+        EXPECT_EQ(received[i], i + 2);
+    for (const EdgeQueueMetrics& metrics : pipeline.edgeMetrics())
+    {
+        EXPECT_EQ(metrics.frames, 50u);
+        EXPECT_EQ(metrics.depth, 0);
+    }
+}
+
+TEST_F(StreamPipelineTest, StagesWorkOnSuccessiveFramesConcurrently)
+{
+    chain({"Load Image", "Resize", "Normalize"});
+
+    std::atomic<int> active{0};
+    std::atomic<int> overlap{0};
+    auto work = [&active, &overlap](StreamFrame& frame) {
+        const int now = ++active;
+        int seen = overlap.load();
+        while (now > seen && !overlap.compare_exchange_weak(seen, now))
+        {
+        }
+        busyWait(std::chrono::milliseconds(2));
+        --active;
+        frame.setOutput("out", frame.input("in"));
+    };
+
+    auto profiler = std::make_shared<NodeProfiler>();
+    profiler->setEnabled(true);
+    StreamPipeline pipeline(registry->snapshot());
+    pipeline.setProfiler(profiler);
+    pipeline.setStage("Load Image", [work](StreamFrame& frame) {
+        work(frame);
+        if (frame.index() == 29)
+            frame.finish();
+    });
+    pipeline.setStage("Resize", work);
+    pipeline.setStage("Normalize", work);
+
+    ASSERT_TRUE(pipeline.start());
+    pipeline.waitForFinished();
+
+    EXPECT_GE(overlap.load(), 2);
+    for (const auto& node : nodes)
+    {
+        const qint64 uid = registry->getNode(node->item)->uid;
+        EXPECT_EQ(pipeline.frames(uid), 30u);
+        EXPECT_EQ(profiler->stats(uid).invocations, 30u);
+    }
+}
+
+TEST_F(StreamPipelineTest, BackpressureBoundsQueues)
+{
+    chain({"Camera", "Display"});
+
+    StreamPipeline pipeline(registry->snapshot(), 2);
+    pipeline.setStage("Camera", source(100));
+    pipeline.setStage("Display", [](StreamFrame&) { busyWait(std::chrono::microseconds(500)); });
+
+    ASSERT_TRUE(pipeline.start());
+    pipeline.waitForFinished();
+
+    const QVector<EdgeQueueMetrics> metrics = pipeline.edgeMetrics();
+    ASSERT_EQ(metrics.size(), 1);
+    EXPECT_EQ(metrics.front().capacity, 2);
+    EXPECT_LE(metrics.front().maxDepth, 2);
+    EXPECT_EQ(metrics.front().frames, 100u);
+    EXPECT_GT(metrics.front().blockedNs, 0);
+}
+
+TEST_F(StreamPipelineTest, StopEndsEndlessSources)
+{
+    chain({"Camera", "Display"});
+
+    StreamPipeline pipeline(registry->snapshot(), 2);
+    pipeline.setStage("Camera", [](StreamFrame& frame) { frame.setOutput("out", Payload()); });
+    pipeline.setStage("Display", [](StreamFrame&) { busyWait(std::chrono::microseconds(200)); });
+
+    ASSERT_TRUE(pipeline.start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_TRUE(pipeline.isRunning());
+    pipeline.stop();
+    EXPECT_FALSE(pipeline.isRunning());
+}
+
+TEST_F(StreamPipelineTest, UnevenSourcesEndTheJoin)
+{
+    // Given a join fed by a short and an endless source
+    auto join = factory->createNode(scene.get(), "Join");
+    for (const char* name : {"a", "b"})
+    {
+        factory->addInput(*join, name);
+        factory->addInputTag<FrameTag>(*join, name);
+    }
+    for (const char* name : {"Short", "Long"})
+    {
+        auto node = factory->createNode(scene.get(), name);
+        factory->addOutput(*node, "out");
+        factory->addOutputTag<FrameTag>(*node, "out");
+        ASSERT_NE(factory->createConnection(*scene,
+                                            *factory->getOutputPortByName(*node, "out"),
+                                            *factory->getInputPortByName(*join, name == QString("Short") ? "a" : "b"),
+                                            false),
+                  nullptr);
+        nodes.push_back(std::move(node));
+    }
+    const qint64 joinUid = registry->getNode(join->item)->uid;
+    nodes.push_back(std::move(join));
+
+    StreamPipeline pipeline(registry->snapshot(), 2);
+    pipeline.setStage("Short", source(3));
+    pipeline.setStage("Long", [](StreamFrame& frame) { frame.setOutput("out", Payload::make<FrameTag>(0)); });
+    pipeline.setStage("Join", [](StreamFrame&) {});
+
+    // Then the join ends with the short source and the endless one stops too
+    ASSERT_TRUE(pipeline.start());
+    pipeline.waitForFinished();
+    EXPECT_FALSE(pipeline.isRunning());
+    EXPECT_EQ(pipeline.frames(joinUid), 3u);
+}
+
+TEST_F(StreamPipelineTest, ThrowingSinkStopsItsProducers)
+{
+    chain({"Camera", "Resize", "Display"});
+
+    StreamPipeline pipeline(registry->snapshot(), 2);
+    pipeline.setStage("Camera", [](StreamFrame& frame) { frame.setOutput("out", Payload::make<FrameTag>(0)); });
+    pipeline.setStage("Resize", increment());
+    pipeline.setStage("Display", [](StreamFrame& frame) {
+        if (frame.index() == 5)
+            throw std::runtime_error("display lost");
+    });
+
+    ASSERT_TRUE(pipeline.start());
+    pipeline.waitForFinished();
+    EXPECT_FALSE(pipeline.isRunning());
+    EXPECT_EQ(pipeline.frames(registry->getNode(nodes.back()->item)->uid), 5u);
+}
+
+TEST_F(StreamPipelineTest, RefusesConnectedNodesWithoutStage)
+{
+    chain({"Camera", "Display"});
+
+    StreamPipeline pipeline(registry->snapshot());
+    pipeline.setStage("Camera", source(1));
+    EXPECT_FALSE(pipeline.start());
+    EXPECT_FALSE(pipeline.setStage("Missing", source(1)));
+}
@@ -0,0 +1,128 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/Symbol.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/NodeItem.hpp"
+#include "view/PortLabel.hpp"
+
+#include <QApplication>
+#include <gtest/gtest.h>
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Test Fixture
+// -----------------------------------------------------------------------------
+class SymbolTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* SymbolTest::app = nullptr;
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+TEST_F(SymbolTest, EqualTextInternsToTheSameId)
+{
+    const Symbol a(QStringLiteral("Multiply"));
+    const Symbol b("Multiply");
+    const Symbol c("Add");
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.id(), b.id());
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.toString(), QStringLiteral("Multiply"));
+}
+
+TEST_F(SymbolTest, EmptyTextIsTheNullSymbol)
+{
+    EXPECT_TRUE(Symbol().isEmpty());
+    EXPECT_TRUE(Symbol(QString()).isEmpty());
+    EXPECT_EQ(Symbol(""), Symbol());
+    EXPECT_TRUE(Symbol().toString().isEmpty());
+    EXPECT_FALSE(Symbol("x").isEmpty());
+}
+
+TEST_F(SymbolTest, NamesAreReleasedWithTheirLastSymbol)
+{
+    const int before = Symbol::internedCount();
+    quint32 id = 0;
+    {
+        const Symbol a(QStringLiteral("SymbolTest_Transient"));
+        const Symbol copy = a;
+        Symbol moved = Symbol(copy);
+        id = a.id();
+        EXPECT_EQ(Symbol::internedCount(), before + 1);
+        EXPECT_EQ(moved, a);
+    }
+    EXPECT_EQ(Symbol::internedCount(), before);
+
+    // A released index is handed to the next new name instead of growing the table.
+    const Symbol next("SymbolTest_Next");
+    EXPECT_EQ(next.id(), id);
+    EXPECT_EQ(next.toString(), QStringLiteral("SymbolTest_Next"));
+}
+
+TEST_F(SymbolTest, RenamesDoNotGrowTheTable)
+{
+    auto registry = std::make_shared<GraphRegistry>();
+    NodeItem node(registry, "Renamed0");
+    PortLabel* port = node.addInput("In");
+    const int before = Symbol::internedCount();
+
+    for (int i = 1; i <= 100; ++i)
+        port->setModuleName(QStringLiteral("Renamed%1").arg(i));
+    EXPECT_EQ(Symbol::internedCount(), before);
+}
+
+TEST_F(SymbolTest, PortLabelKeepsForwardedKeyInSync)
+{
+    auto registry = std::make_shared<GraphRegistry>();
+    NodeItem node(registry, "Node");
+    PortLabel* port = node.addInput("In");
+
+    EXPECT_EQ(port->nameSymbol(), Symbol("In"));
+    EXPECT_EQ(port->moduleSymbol(), Symbol("Node"));
+    EXPECT_EQ(port->forwardedNameSymbol(), Symbol("Node_In"));
+
+    port->setName("Renamed");
+    EXPECT_EQ(port->name(), QStringLiteral("Renamed"));
+    EXPECT_EQ(port->forwardedNameSymbol(), Symbol("Node_Renamed"));
+    EXPECT_EQ(port->getConnectionPortData().portName, Symbol("Renamed"));
+}
@@ -113,6 +113,30 @@ TEST(TagRegistryTest, UnregisterAllTags)
     EXPECT_LT(idx1, MaxTags);
 }
 
+// ----------------------------
+// Cached tag masks
+// ----------------------------
+
+TEST(TagRegistryTest, MaskOfFollowsRegistryResets)
+{
+    TagRegistry::unregisterAllTags();
+
+    const TagBitMask mask = TagRegistry::maskOf<Tag1, Tag3>();
+    EXPECT_EQ(mask.count(), 2u);
+    EXPECT_TRUE(mask.test(TagRegistry::getTagIndex<Tag1>()));
+    EXPECT_TRUE(mask.test(TagRegistry::getTagIndex<Tag3>()));
+    EXPECT_EQ((TagRegistry::maskOf<Tag1, Tag3>()), mask);
+
+    // Indices are handed out again after a reset; the cached mask must follow.
+    TagRegistry::unregisterAllTags();
+    TagRegistry::registerTags<Tag4, Tag5, Tag3, Tag1>();
+    const TagBitMask renumbered = TagRegistry::maskOf<Tag1, Tag3>();
+    EXPECT_TRUE(renumbered.test(TagRegistry::getTagIndex<Tag1>()));
+    EXPECT_TRUE(renumbered.test(TagRegistry::getTagIndex<Tag3>()));
+    EXPECT_EQ(renumbered.count(), 2u);
+    EXPECT_NE(renumbered, mask);
+}
+
 // ----------------------------
 // MaxTags enforcement (MSVC-safe)
 // ----------------------------
@@ -100,3 +100,58 @@ TEST_F(ConnectionItemTest, AddPortsAndUpdatePath)
     EXPECT_TRUE(item.isActivated());
     EXPECT_FALSE(item.path().isEmpty());
 }
+
+TEST_F(ConnectionItemTest, SceneIndexFollowsRedrawnPath)
+{
+    // Given a wire indexed by the scene
+    ConnectionPort inputPort = createPort(true, "in1");
+    inputPort.scenePos = QPointF(300, 200);
+    ConnectionPort outputPort = createPort(false, "out1");
+    outputPort.scenePos = QPointF(10, 10);
+    auto* item = new ConnectionItem(inputPort, outputPort);
+    scene->addItem(item);
+    const QPointF oldMiddle = item->path().pointAtPercent(0.5);
+    ASSERT_TRUE(scene->items(oldMiddle).contains(item));
+
+    // When its end points move far away
+    item->onNodeMoved(false, QPointF(5000, 5000), QRectF(0, 0, 10, 10));
+    item->onNodeMoved(true, QPointF(5300, 5200), QRectF(0, 0, 10, 10));
+
+    // Then the index no longer finds it at the old place, only at the new one
+    EXPECT_FALSE(scene->items(oldMiddle).contains(item));
+    EXPECT_TRUE(scene->items(item->path().pointAtPercent(0.5)).contains(item));
+}
+
+TEST_F(ConnectionItemTest, HitTestsFollowTheCurve)
+{
+    ConnectionPort inputPort = createPort(true, "in1");
+    inputPort.scenePos = QPointF(300, 200);
+    ConnectionPort outputPort = createPort(false, "out1");
+    outputPort.scenePos = QPointF(10, 10);
+    ConnectionItem item(inputPort, outputPort);
+
+    const QPointF middle = item.path().pointAtPercent(0.5);
+    EXPECT_TRUE(item.contains(middle));
+    EXPECT_TRUE(item.contains(middle + QPointF(0, 3)));
+    EXPECT_FALSE(item.contains(middle + QPointF(0, 20)));
+    EXPECT_TRUE(item.boundingRect().contains(item.path().controlPointRect()));
+
+    // Rubber bands are plain rectangles.
+    QPainterPath band;
+    band.addRect(QRectF(middle - QPointF(4, 4), QSizeF(8, 8)));
+    EXPECT_TRUE(item.collidesWithPath(band));
+    EXPECT_FALSE(item.collidesWithPath(band, Qt::ContainsItemShape));
+    QPainterPath away;
+    away.addRect(QRectF(middle + QPointF(40, -120), QSizeF(8, 8)));
+    EXPECT_FALSE(item.collidesWithPath(away));
+    QPainterPath all;
+    all.addRect(QRectF(0, 0, 400, 300));
+    EXPECT_TRUE(item.collidesWithPath(all, Qt::ContainsItemShape));
+
+    // The stroked shape is rebuilt only after the curve changes.
+    const QPainterPath before = item.shape();
+    EXPECT_EQ(item.shape(), before);
+    item.onNodeMoved(true, QPointF(300, 400), QRectF(0, 0, 10, 10));
+    EXPECT_NE(item.shape(), before);
+    EXPECT_TRUE(item.contains(item.path().pointAtPercent(0.5)));
+}
@@ -0,0 +1,223 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <gtest/gtest.h>
+
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/VirtualGraph.hpp"
+
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class VirtualGraphTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    void SetUp() override
+    {
+        scene = std::make_unique<GraphScene>();
+        graph = scene->enableVirtualization();
+        graph->setMargin(100);
+    }
+
+    void TearDown() override
+    {
+        scene.reset();
+    }
+
+    /// Adds a row of @p count chained nodes, @p spacing apart.
+    void addChain(int count, qreal spacing)
+    {
+        const QStringList inputs{"in"};
+        const QStringList outputs{"out"};
+        for (int i = 0; i < count; ++i)
+        {
+            graph->addNode(QString("N%1").arg(i), QString(), QPointF(i * spacing, 0), Qt::darkCyan, inputs, outputs);
+            if (i > 0)
+                graph->addConnection(i - 1, "out", i, "in");
+        }
+    }
+
+    void showArea(const QRectF& area, qreal scale = 1.0)
+    {
+        graph->setViewport(area, scale);
+        graph->sync();
+    }
+
+    std::unique_ptr<GraphScene> scene;
+    VirtualGraph* graph = nullptr;
+
+    static QApplication* app;
+};
+
+QApplication* VirtualGraphTest::app = nullptr;
+
+TEST_F(VirtualGraphTest, MaterializesOnlyNearTheViewport)
+{
+    addChain(1000, 1000);
+    EXPECT_EQ(graph->nodeCount(), 1000);
+    EXPECT_EQ(graph->connectionCount(), 999);
+    EXPECT_EQ(graph->materializedCount(), 0);
+
+    showArea(QRectF(4900, -200, 1300, 400));
+
+    EXPECT_EQ(graph->materializedCount(), 2);
+    ASSERT_NE(graph->item(5), nullptr);
+    ASSERT_NE(graph->item(6), nullptr);
+    EXPECT_EQ(graph->item(4), nullptr);
+    EXPECT_EQ(graph->item(5)->nodeName(), "N5");
+    EXPECT_EQ(scene->getGraphRegistry()->allNodes().size(), 2);
+
+    // Only the wire between the two real nodes is a real connection.
+    EXPECT_EQ(scene->getGraphRegistry()->allConnections().size(), 1);
+}
+
+TEST_F(VirtualGraphTest, ScrollingRecyclesPooledNodes)
+{
+    addChain(1000, 1000);
+    showArea(QRectF(4900, -200, 1300, 400));
+    const int created = graph->createdCount();
+
+    showArea(QRectF(400900, -200, 1300, 400));
+
+    EXPECT_EQ(graph->materializedCount(), 2);
+    EXPECT_EQ(graph->createdCount(), created);
+    EXPECT_EQ(graph->item(5), nullptr);
+    ASSERT_NE(graph->item(401), nullptr);
+    EXPECT_EQ(graph->item(401)->nodeName(), "N401");
+    EXPECT_EQ(graph->item(401)->pos(), QPointF(401000, 0));
+    for (PortLabel* port : graph->item(401)->getAllPorts())
+        EXPECT_EQ(port->moduleName(), "N401");
+    EXPECT_EQ(scene->getGraphRegistry()->allConnections().size(), 1);
+}
+
+TEST_F(VirtualGraphTest, PooledNodesLeaveTheRegistry)
+{
+    addChain(1000, 1000);
+    auto registry = scene->getGraphRegistry();
+    showArea(QRectF(4900, -200, 1300, 400));
+    ASSERT_EQ(registry->snapshot()->nodeCount(), 2);
+
+    // Nothing is left in view; the released nodes wait in the pool.
+    showArea(QRectF(400500, 5000, 100, 100));
+    EXPECT_EQ(graph->materializedCount(), 0);
+    EXPECT_GT(graph->pooledCount(), 0);
+    EXPECT_EQ(registry->allNodes().size(), graph->materializedCount());
+    EXPECT_EQ(registry->snapshot()->nodeCount(), 0);
+    EXPECT_TRUE(registry->executionPlan()->nodes().isEmpty());
+    EXPECT_TRUE(registry->search("N", 10).isEmpty());
+
+    // Reused nodes are part of the graph again.
+    showArea(QRectF(400900, -200, 1300, 400));
+    EXPECT_EQ(registry->allNodes().size(), graph->materializedCount());
+    EXPECT_EQ(registry->snapshot()->nodeCount(), 2);
+    ASSERT_NE(graph->item(401), nullptr);
+    EXPECT_EQ(registry->findNode("N401")->node, graph->item(401));
+}
+
+TEST_F(VirtualGraphTest, ReleasedNodesKeepTheirMoves)
+{
+    addChain(10, 1000);
+    showArea(QRectF(-100, -200, 400, 400));
+    ASSERT_NE(graph->item(0), nullptr);
+
+    graph->item(0)->setPos(50, 70);
+    showArea(QRectF(8000, -200, 400, 400));
+    ASSERT_EQ(graph->item(0), nullptr);
+
+    EXPECT_EQ(graph->bounds(0).topLeft(), QPointF(50, 70));
+}
+
+TEST_F(VirtualGraphTest, ZoomedOutDrawsRecordsOnly)
+{
+    addChain(100, 300);
+    showArea(QRectF(0, -200, 3000, 400));
+    EXPECT_GT(graph->materializedCount(), 0);
+
+    showArea(QRectF(0, -200, 30000, 4000), graph->minimumScale() / 2);
+
+    EXPECT_EQ(graph->materializedCount(), 0);
+    EXPECT_TRUE(scene->getGraphRegistry()->allConnections().isEmpty());
+}
+
+TEST_F(VirtualGraphTest, RespectsMaterializationBudget)
+{
+    addChain(100, 300);
+    graph->setMaxMaterialized(5);
+
+    showArea(QRectF(0, -200, 30000, 400));
+
+    EXPECT_EQ(graph->materializedCount(), 5);
+}
+
+TEST_F(VirtualGraphTest, DeletedWireStaysDeleted)
+{
+    addChain(10, 1000);
+    showArea(QRectF(-100, -200, 1300, 400));
+    auto connections = scene->getGraphRegistry()->allConnections();
+    ASSERT_EQ(connections.size(), 1);
+
+    scene->deleteItems({}, {connections.first()});
+    EXPECT_EQ(graph->connectionCount(), 8);
+
+    showArea(QRectF(8000, -200, 400, 400));
+    showArea(QRectF(-100, -200, 1300, 400));
+
+    ASSERT_NE(graph->item(0), nullptr);
+    ASSERT_NE(graph->item(1), nullptr);
+    EXPECT_TRUE(scene->getGraphRegistry()->allConnections().isEmpty());
+}
+
+TEST_F(VirtualGraphTest, DrawnWireSurvivesRelease)
+{
+    addChain(3, 1000);
+    showArea(QRectF(-100, -200, 2300, 400));
+    ASSERT_NE(graph->item(0), nullptr);
+    ASSERT_NE(graph->item(2), nullptr);
+
+    ASSERT_NE(scene->connectPorts(graph->item(0)->outputs().first(), graph->item(2)->inputs().first()), nullptr);
+    EXPECT_EQ(graph->connectionCount(), 3);
+
+    showArea(QRectF(8000, -200, 400, 400));
+    EXPECT_TRUE(scene->getGraphRegistry()->allConnections().isEmpty());
+    showArea(QRectF(-100, -200, 2300, 400));
+
+    EXPECT_EQ(scene->getGraphRegistry()->allConnections().size(), 3);
+}
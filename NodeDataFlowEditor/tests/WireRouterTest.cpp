@@ -0,0 +1,212 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include <QApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include <gtest/gtest.h>
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/WireRouter.hpp"
+#include "view/ConnectionItem.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+
+#include <algorithm>
+#include <memory>
+
+// -----------------------------------------------------------------------------
+// Fixture
+// -----------------------------------------------------------------------------
+class WireRouterTest : public ::testing::Test
+{
+public:
+    template <typename T>
+    struct ValueHolder
+    {};
+
+protected:
+    static void SetUpTestSuite()
+    {
+        int argc = 0;
+        app = new QApplication(argc, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete app;
+        app = nullptr;
+    }
+
+    /// True if every segment of @p route is horizontal or vertical.
+    static bool isOrthogonal(const QPolygonF& route)
+    {
+        for (int i = 1; i < route.size(); ++i)
+            if (route[i].x() != route[i - 1].x() && route[i].y() != route[i - 1].y())
+                return false;
+        return true;
+    }
+
+    /// True if a segment of @p route passes through the interior of @p rect.
+    static bool crosses(const QPolygonF& route, const QRectF& rect)
+    {
+        for (int i = 1; i < route.size(); ++i)
+        {
+            const qreal left = std::min(route[i].x(), route[i - 1].x());
+            const qreal right = std::max(route[i].x(), route[i - 1].x());
+            const qreal top = std::min(route[i].y(), route[i - 1].y());
+            const qreal bottom = std::max(route[i].y(), route[i - 1].y());
+            if (left < rect.right() && right > rect.left() && top < rect.bottom() && bottom > rect.top())
+                return true;
+        }
+        return false;
+    }
+
+    static QApplication* app;
+};
+
+QApplication* WireRouterTest::app = nullptr;
+
+TEST_F(WireRouterTest, RoutesAroundObstacle)
+{
+    const QRectF source(0, 0, 100, 60);
+    const QRectF blocker(160, -20, 80, 120);
+    const QRectF target(300, 0, 100, 60);
+    const WireRouter router({source, blocker, target});
+
+    const QPolygonF route = router.route(QPointF(100, 30), QPointF(300, 30));
+
+    ASSERT_GE(route.size(), 2);
+    EXPECT_EQ(route.first(), QPointF(100, 30));
+    EXPECT_EQ(route.last(), QPointF(300, 30));
+    EXPECT_TRUE(isOrthogonal(route));
+    EXPECT_FALSE(crosses(route, blocker));
+}
+
+TEST_F(WireRouterTest, BackwardWireLeavesRightAndEntersLeft)
+{
+    const QRectF source(300, 0, 100, 60);
+    const QRectF target(0, 0, 100, 60);
+    const WireRouter router({source, target});
+
+    const QPolygonF route = router.route(QPointF(400, 30), QPointF(0, 30));
+
+    ASSERT_GE(route.size(), 4);
+    EXPECT_GT(route[1].x(), 400);
+    EXPECT_LT(route[route.size() - 2].x(), 0);
+    EXPECT_FALSE(crosses(route, source));
+    EXPECT_FALSE(crosses(route, target));
+}
+
+TEST_F(WireRouterTest, ObstaclesOutOfReachDoNotChangeTheRoute)
+{
+    const QPointF source(100, 30);
+    const QPointF target(300, 30);
+    const QVector<QRectF> near{{0, 0, 100, 60}, {160, -20, 80, 120}, {300, 0, 100, 60}};
+    QVector<QRectF> all = near;
+    for (int i = 0; i < 50; ++i)
+        all.append(QRectF(5000 + 200 * i, 5000, 100, 60));
+
+    const QRectF reach = WireRouter::reach(source, target);
+    QVector<QRectF> reachable;
+    for (const QRectF& rect : all)
+        if (rect.intersects(reach))
+            reachable.append(rect);
+
+    EXPECT_EQ(reachable, near);
+    EXPECT_EQ(WireRouter(reachable).route(source, target), WireRouter(all).route(source, target));
+}
+
+TEST_F(WireRouterTest, MovedNodeReroutesTheWiresItCrosses)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+
+    auto src = factory->createNode(scene.get(), "RouteSrc", Qt::gray, QPointF(0, 0));
+    auto dst = factory->createNode(scene.get(), "RouteDst", Qt::gray, QPointF(600, 0));
+    auto bystander = factory->createNode(scene.get(), "Bystander", Qt::gray, QPointF(0, 1000));
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInputTag<ValueHolder<int>>(*dst, "in");
+    ConnectionItem* conn = factory->createConnection(*scene,
+                                                     *factory->getInputPortByName(*dst, "in"),
+                                                     *factory->getOutputPortByName(*src, "out"),
+                                                     false);
+    ASSERT_NE(conn, nullptr);
+
+    auto waitForRoutes = [&scene] {
+        QEventLoop loop;
+        QObject::connect(scene.get(), &GraphScene::sgnRoutesApplied, &loop, &QEventLoop::quit);
+        QTimer::singleShot(5000, &loop, &QEventLoop::quit);
+        loop.exec();
+    };
+    scene->setWireRouting(true);
+    waitForRoutes();
+    ASSERT_GE(conn->route().size(), 2);
+
+    // When an unconnected node is dropped onto the wire
+    const QPointF middle = conn->route().boundingRect().center();
+    const QRectF bounds = bystander->item->sceneBoundingRect();
+    bystander->item->setPos(middle - QPointF(bounds.width() / 2, bounds.height() / 2));
+    waitForRoutes();
+
+    // Then the wire goes around it
+    ASSERT_GE(conn->route().size(), 2);
+    EXPECT_FALSE(crosses(conn->route(), bystander->item->sceneBoundingRect()));
+}
+
+TEST_F(WireRouterTest, SceneCachesRoutesOnConnections)
+{
+    auto scene = std::make_unique<GraphScene>();
+    auto factory = scene->getNodeFactory();
+    auto registry = scene->getGraphRegistry();
+
+    auto src = factory->createNode(scene.get(), "RouteSrc", Qt::gray, QPointF(0, 0));
+    auto dst = factory->createNode(scene.get(), "RouteDst", Qt::gray, QPointF(600, 0));
+    factory->addOutput(*src, "out");
+    factory->addInput(*dst, "in");
+    factory->addOutputTag<ValueHolder<int>>(*src, "out");
+    factory->addInputTag<ValueHolder<int>>(*dst, "in");
+    ConnectionItem* conn = factory->createConnection(*scene,
+                                                     *factory->getInputPortByName(*dst, "in"),
+                                                     *factory->getOutputPortByName(*src, "out"),
+                                                     false);
+    ASSERT_NE(conn, nullptr);
+
+    QEventLoop loop;
+    QObject::connect(scene.get(), &GraphScene::sgnRoutesApplied, &loop, &QEventLoop::quit);
+    QTimer::singleShot(5000, &loop, &QEventLoop::quit);
+    scene->setWireRouting(true);
+    loop.exec();
+
+    const QPolygonF route = conn->route();
+    ASSERT_GE(route.size(), 2);
+    EXPECT_EQ(route.first(), conn->anchors().p1());
+    EXPECT_EQ(route.last(), conn->anchors().p2());
+
+    scene->setWireRouting(false);
+    EXPECT_TRUE(conn->route().isEmpty());
+}
@@ -0,0 +1,320 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "AsyncKernel.hpp needs C++20 coroutines; configure with -DENABLE_COROUTINES=ON"
+#endif
+
+#include "utility/Payload.hpp"
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QWaitCondition>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+class AsyncExecutor;
+class QThread;
+
+using KernelOutputs = QHash<QString, Payload>;
+
+/**
+ * @brief Thrown out of a co_await when the kernel's run was cancelled.
+ *
+ * Kernels need not catch it; the executor treats it as a normal cancellation.
+ */
+struct KernelCancelled
+{};
+
+/**
+ * @brief What a running kernel knows about its invocation.
+ */
+struct KernelContext
+{
+    qint64 uid = -1;                ///< Node the kernel runs for.
+    QHash<QString, Payload> inputs; ///< Payloads by input port name.
+
+    Payload input(const QString& port) const { return inputs.value(port); }
+};
+
+/**
+ * @brief Return type of coroutine node kernels.
+ *
+ * A kernel is a coroutine taking a KernelContext by value and co_returning
+ * KernelOutputs. It starts and resumes on the AsyncExecutor's worker thread
+ * and may co_await AsyncExecutor::sleepFor() and AsyncValue objects.
+ *
+ * @code
+ * KernelTask load(KernelContext ctx)
+ * {
+ *     QByteArray bytes = co_await disk.read(ctx.input("path"));
+ *     co_return KernelOutputs{{"image", Payload::make<data::ImageType>(decode(bytes))}};
+ * }
+ * @endcode
+ */
+class KernelTask
+{
+public:
+    struct promise_type
+    {
+        /// Hands the finished run back to the executor, which destroys the frame.
+        struct Final
+        {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> h) noexcept;
+            void await_resume() noexcept {}
+        };
+
+        KernelTask get_return_object();
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        Final final_suspend() noexcept { return {}; }
+        void return_value(KernelOutputs value) { outputs = std::move(value); }
+        void unhandled_exception() { error = std::current_exception(); }
+
+        AsyncExecutor* executor = nullptr;
+        quint64 task = 0;       ///< Executor-assigned id of this run.
+        quint64 suspension = 0; ///< Incremented on every resume; stale wake-ups are ignored.
+        bool cancelled = false; ///< Written and read on the worker thread only.
+        KernelOutputs outputs;
+        std::exception_ptr error;
+    };
+    using Handle = std::coroutine_handle<promise_type>;
+
+    KernelTask() = default;
+    explicit KernelTask(Handle handle)
+        : m_handle(handle)
+    {}
+    KernelTask(KernelTask&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, {}))
+    {}
+    KernelTask& operator=(KernelTask&& other) noexcept;
+    ~KernelTask();
+
+    /**
+     * @brief Give up ownership of the coroutine, which the executor then destroys.
+     */
+    Handle release() { return std::exchange(m_handle, {}); }
+
+private:
+    Handle m_handle;
+};
+
+/**
+ * @brief Runs many coroutine kernels on one worker thread.
+ *
+ * A kernel blocked on I/O or a timer is just a suspended coroutine frame,
+ * so one worker keeps hundreds of I/O-bound nodes in flight. Submitting a
+ * node whose previous run is still in flight cancels that run: its pending
+ * co_await throws KernelCancelled on the worker and its result is dropped.
+ */
+class AsyncExecutor
+{
+public:
+    using Kernel = std::function<KernelTask(KernelContext)>;
+    using Completion = std::function<void(qint64 uid, const KernelOutputs& outputs)>;
+
+    AsyncExecutor();
+    ~AsyncExecutor();
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    /**
+     * @brief Called on the worker thread with the outputs of every run that was not cancelled.
+     */
+    void setCompletionHandler(Completion completion);
+
+    /**
+     * @brief Run @p kernel for node @p uid on @p inputs, cancelling the node's run in flight. Any thread.
+     */
+    void submit(qint64 uid, Kernel kernel, QHash<QString, Payload> inputs);
+
+    /**
+     * @brief Cancel the run of node @p uid, if any. Any thread.
+     */
+    void cancel(qint64 uid);
+
+    /**
+     * @brief Block until no run is in flight.
+     * @return False if @p timeoutMs elapsed first.
+     */
+    bool waitForIdle(int timeoutMs = -1);
+
+    int inFlight() const;
+    quint64 completedRuns() const;
+    quint64 cancelledRuns() const;
+    quint64 failedRuns() const;
+
+    /**
+     * @brief Awaitable that resumes the kernel after @p duration.
+     */
+    auto sleepFor(std::chrono::milliseconds duration)
+    {
+        struct Sleep
+        {
+            AsyncExecutor* executor;
+            std::chrono::milliseconds duration;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(KernelTask::Handle h) { executor->wakeAt(h, Clock::now() + duration); }
+            void await_resume() const { AsyncExecutor::throwIfCancelled(); }
+        };
+        return Sleep{this, duration};
+    }
+
+private:
+    template <typename T>
+    friend class AsyncValue;
+    friend struct KernelTask::promise_type;
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Jobs for the worker; outlives the executor while an AsyncValue still posts to it.
+     */
+    struct Mailbox
+    {
+        void post(std::function<void(AsyncExecutor&)> job);
+
+        QMutex mutex;
+        QWaitCondition wakeUp;                                 ///< Jobs arrived or quit was set.
+        QWaitCondition idle;                                   ///< The last run finished.
+        std::vector<std::function<void(AsyncExecutor&)>> jobs; ///< Guarded by mutex.
+        int pending = 0;                                       ///< Submitted runs not finished yet.
+        bool quit = false;
+    };
+
+    struct Run
+    {
+        qint64 uid = -1;
+        KernelTask::Handle handle;
+        std::shared_ptr<const Kernel> kernel; ///< Kept alive for coroutine lambdas reading their captures.
+    };
+
+    void loop();
+    void start(qint64 uid, Kernel kernel, QHash<QString, Payload> inputs);
+    void cancelRun(qint64 uid);
+    void resume(quint64 task, quint64 suspension);
+    void finished(KernelTask::Handle handle);
+    void wakeAt(KernelTask::Handle handle, Clock::time_point when);
+    static void throwIfCancelled();
+
+    std::shared_ptr<Mailbox> m_mailbox;
+
+    // Worker thread only.
+    std::multimap<Clock::time_point, std::pair<quint64, quint64>> m_timers; ///< Task and suspension to wake.
+    QHash<quint64, Run> m_runs;                                             ///< Runs in flight by task id.
+    QHash<qint64, quint64> m_runOfNode;                                     ///< Task id of each node's run.
+    quint64 m_nextTask = 1;
+    Completion m_completion;
+
+    std::atomic<quint64> m_completed{0};
+    std::atomic<quint64> m_cancelled{0};
+    std::atomic<quint64> m_failed{0};
+    std::unique_ptr<QThread> m_thread;
+};
+
+/**
+ * @brief One value produced later by another thread, awaitable from a kernel.
+ *
+ * An I/O layer or service client hands one to the kernel and calls
+ * complete() from any thread when the result is there; the awaiting kernel
+ * then resumes on its executor. Copies share the same value.
+ */
+template <typename T>
+class AsyncValue
+{
+public:
+    AsyncValue()
+        : m_state(std::make_shared<State>())
+    {}
+
+    /**
+     * @brief Provide the value and resume the kernel awaiting it. Any thread; first call wins.
+     */
+    void complete(T value) const
+    {
+        std::weak_ptr<AsyncExecutor::Mailbox> waiter;
+        quint64 task = 0;
+        quint64 suspension = 0;
+        {
+            QMutexLocker lock(&m_state->mutex);
+            if (m_state->value)
+                return;
+            m_state->value = std::move(value);
+            waiter = std::exchange(m_state->waiter, {});
+            task = m_state->task;
+            suspension = m_state->suspension;
+        }
+        // Dropped if the executor is gone; a cancelled run ignores the stale suspension.
+        if (auto mailbox = waiter.lock())
+            mailbox->post([task, suspension](AsyncExecutor& executor) { executor.resume(task, suspension); });
+    }
+
+    bool isReady() const
+    {
+        QMutexLocker lock(&m_state->mutex);
+        return m_state->value.has_value();
+    }
+
+    bool await_ready() const { return isReady(); }
+
+    bool await_suspend(KernelTask::Handle h)
+    {
+        QMutexLocker lock(&m_state->mutex);
+        if (m_state->value)
+            return false;
+        m_state->waiter = h.promise().executor->m_mailbox;
+        m_state->task = h.promise().task;
+        m_state->suspension = h.promise().suspension;
+        return true;
+    }
+
+    T await_resume()
+    {
+        AsyncExecutor::throwIfCancelled();
+        QMutexLocker lock(&m_state->mutex);
+        return *m_state->value;
+    }
+
+private:
+    struct State
+    {
+        QMutex mutex;
+        std::optional<T> value;
+        std::weak_ptr<AsyncExecutor::Mailbox> waiter; ///< Mailbox of the suspended kernel's executor.
+        quint64 task = 0;
+        quint64 suspension = 0;
+    };
+    std::shared_ptr<State> m_state;
+};
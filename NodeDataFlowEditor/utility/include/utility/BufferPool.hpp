@@ -0,0 +1,114 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QMutex>
+#include <QVector>
+#include <cstddef>
+#include <memory>
+
+class BufferPool;
+
+/**
+ * @brief Byte buffer whose storage comes from, and returns to, a BufferPool.
+ *
+ * Copying allocates a second buffer from the same pool, so a copy-on-write
+ * clone of a pooled payload is pooled as well. The buffer keeps its pool
+ * alive.
+ */
+class PooledBuffer
+{
+public:
+    PooledBuffer() = default;
+    ~PooledBuffer();
+    PooledBuffer(const PooledBuffer& other);
+    PooledBuffer(PooledBuffer&& other) noexcept;
+    PooledBuffer& operator=(PooledBuffer other) noexcept;
+
+    std::byte* data() { return m_data; }
+    const std::byte* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+    bool isNull() const { return !m_data; }
+
+private:
+    friend class BufferPool;
+    PooledBuffer(std::shared_ptr<BufferPool> pool, std::byte* data, std::size_t size, std::size_t capacity);
+
+    std::shared_ptr<BufferPool> m_pool; ///< Pool the storage goes back to.
+    std::byte* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = 0;
+};
+
+/**
+ * @brief Thread-safe recycler of large byte buffers (images, tensors).
+ *
+ * Capacities are rounded up to a power of two, at least 4 KiB, and released
+ * buffers are kept per capacity until the cache would exceed its limit, so a
+ * graph that processes same-sized frames stops allocating after the first
+ * one.
+ */
+class BufferPool : public std::enable_shared_from_this<BufferPool>
+{
+    struct Token
+    {};
+
+public:
+    static std::shared_ptr<BufferPool> create(std::size_t maxCachedBytes = std::size_t(256) << 20);
+
+    BufferPool(Token, std::size_t maxCachedBytes);
+    ~BufferPool();
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /**
+     * @brief A buffer of @p size bytes; its content is unspecified.
+     */
+    PooledBuffer acquire(std::size_t size);
+
+    /**
+     * @brief Free every cached buffer.
+     */
+    void trim();
+
+    std::size_t cachedBytes() const;
+    std::size_t hits() const;   ///< acquire() calls served from the cache.
+    std::size_t misses() const; ///< acquire() calls that allocated.
+
+private:
+    friend class PooledBuffer;
+    void release(std::byte* data, std::size_t capacity);
+
+    static constexpr int minBucket = 12; ///< 4 KiB
+    static constexpr int bucketCount = 64;
+
+    mutable QMutex m_mutex;
+    QVector<QVector<std::byte*>> m_free; ///< Cached buffers by log2 capacity.
+    std::size_t m_maxCachedBytes;
+    std::size_t m_cachedBytes = 0;
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+};
@@ -0,0 +1,151 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "utility/GraphIds.hpp"
+
+#include <QHash>
+#include <QVector>
+#include <memory>
+
+/**
+ * @brief Graph compiled into flat arrays for evaluation.
+ *
+ * Nodes are stored in topological order and referred to by their index in
+ * that order. Every port gets a slot in one of three dense arrays (inputs,
+ * outputs, parameters); each node owns a contiguous range in each of them,
+ * so a run can keep its values in plain vectors indexed by slot. Edges are
+ * index pairs grouped by source node.
+ *
+ * Groups are flattened: a connection to or from a group port is replaced by
+ * one edge per actual member port it forwards to, so the plan only ever
+ * names real nodes. Group ports have no slot.
+ *
+ * Plans are immutable and are obtained from GraphRegistry::executionPlan(),
+ * which recompiles only after a topology change.
+ */
+class ExecutionPlan
+{
+public:
+    /**
+     * @brief A node and its slot ranges.
+     */
+    struct Node
+    {
+        qint64 uid = -1;
+        int firstInput = 0; ///< First slot in inputPorts().
+        int inputCount = 0;
+        int firstOutput = 0; ///< First slot in outputPorts().
+        int outputCount = 0;
+        int firstParameter = 0; ///< First slot in parameterPorts().
+        int parameterCount = 0;
+        int firstEdge = 0; ///< First outgoing edge in edges().
+        int edgeCount = 0;
+    };
+
+    /**
+     * @brief A connection between two real ports, by index.
+     */
+    struct Edge
+    {
+        int from = -1;                            ///< Index of the source node.
+        int to = -1;                              ///< Index of the target node.
+        int output = -1;                          ///< Slot of the source port in outputPorts().
+        int input = -1;                           ///< Slot of the target port in inputPorts() or parameterPorts().
+        bool toParameter = false;                 ///< True if @ref input is a parameter slot.
+        ConnectionId connection = invalidGraphId; ///< Connection the edge was flattened from.
+    };
+
+    /**
+     * @brief What the plan is compiled from, as gathered by the registry.
+     */
+    struct Source
+    {
+        struct Node
+        {
+            qint64 uid = -1;
+            QVector<PortId> inputs;
+            QVector<PortId> outputs;
+            QVector<PortId> parameters;
+        };
+
+        struct Connection
+        {
+            ConnectionId id = invalidGraphId;
+            PortId output = invalidGraphId;
+            PortId input = invalidGraphId;
+        };
+
+        QVector<Node> nodes;                     ///< In any order.
+        QVector<Connection> connections;         ///< Ends may be group ports.
+        QHash<PortId, QVector<PortId>> forwards; ///< Group port → ports it forwards to.
+    };
+
+    /**
+     * @brief Compile @p source in O((nodes + edges) log nodes).
+     *
+     * Among nodes whose inputs are all ready, the smallest uid is scheduled
+     * first, so the order does not depend on the order of @p source.
+     * Connections whose ends cannot be resolved to registered node ports are
+     * dropped. Nodes on a cycle cannot be ordered; they are appended after all
+     * the others in uid order and acyclic() is false.
+     */
+    static std::shared_ptr<const ExecutionPlan> compile(const Source& source, quint64 topologyRevision = 0);
+
+    /**
+     * @brief Registry topology revision the plan was compiled at.
+     */
+    quint64 topologyRevision() const { return m_topologyRevision; }
+
+    bool acyclic() const { return m_acyclic; }
+
+    const QVector<Node>& nodes() const { return m_nodes; }
+    const QVector<Edge>& edges() const { return m_edges; }
+    const QVector<PortId>& inputPorts() const { return m_inputPorts; }
+    const QVector<PortId>& outputPorts() const { return m_outputPorts; }
+    const QVector<PortId>& parameterPorts() const { return m_parameterPorts; }
+
+    /**
+     * @brief Index of node @p uid in nodes(), or -1.
+     */
+    int indexOf(qint64 uid) const { return m_indexOfUid.value(uid, -1); }
+
+    /**
+     * @brief Parameter slot of port @p port, or -1 if it is not a node parameter port.
+     */
+    int parameterSlot(PortId port) const { return m_parameterSlots.value(port, -1); }
+
+private:
+    QVector<Node> m_nodes;               ///< In topological order.
+    QVector<Edge> m_edges;               ///< Sorted by source node index.
+    QVector<PortId> m_inputPorts;        ///< Input slot → port.
+    QVector<PortId> m_outputPorts;       ///< Output slot → port.
+    QVector<PortId> m_parameterPorts;    ///< Parameter slot → port.
+    QHash<qint64, int> m_indexOfUid;     ///< Node uid → index in m_nodes.
+    QHash<PortId, int> m_parameterSlots; ///< Parameter port → slot.
+    quint64 m_topologyRevision = 0;
+    bool m_acyclic = true;
+};
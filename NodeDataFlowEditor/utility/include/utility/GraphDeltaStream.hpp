@@ -0,0 +1,213 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "utility/GraphIds.hpp"
+
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include <QTimer>
+#include <QVariant>
+#include <QVector>
+#include <atomic>
+#include <memory>
+
+class GraphRegistry;
+class GraphSnapshot;
+
+/**
+ * @brief One graph change, identified by registry ids that survive renames.
+ *
+ * Only the fields relevant to @ref type are meaningful.
+ */
+struct GraphDelta
+{
+    enum class Type : quint8
+    {
+        NodeAdded = 1,        ///< node, name
+        NodeRemoved,          ///< node
+        PortAdded,            ///< node, port, portKind, name
+        PortRemoved,          ///< node, port
+        ConnectionAdded,      ///< connection, node → port, toNode → toPort
+        ConnectionRemoved,    ///< connection
+        ParameterChanged,     ///< node, port, value
+        NodeActivation,       ///< node, active
+        ConnectionActivation, ///< connection, active
+    };
+
+    Type type = Type::NodeAdded;
+    qint64 node = -1;                         ///< Node uid; the source node of a connection.
+    PortId port = invalidGraphId;             ///< Port id; the output port of a connection.
+    qint64 toNode = -1;                       ///< Target node uid of a connection.
+    PortId toPort = invalidGraphId;           ///< Input or parameter port id of a connection.
+    ConnectionId connection = invalidGraphId; ///< Connection id.
+    quint8 portKind = 0;                      ///< PortRecord::Kind of an added port.
+    bool active = false;                      ///< New activation state.
+    QString name;                             ///< Node or port name.
+    QVariant value;                           ///< New parameter value.
+
+    bool operator==(const GraphDelta& other) const;
+};
+
+/**
+ * @brief Wire format of the graph delta stream.
+ *
+ * The editor sends frames; each frame is a big-endian quint32 payload size
+ * followed by a QDataStream (Qt 5.12 format) payload:
+ *
+ *     quint8 kind, quint64 revision, quint32 count, count × event
+ *
+ * where every event starts with its quint8 GraphDelta::Type followed by the
+ * fields listed for that type, in declaration order (qint64 uids, quint64
+ * ids, quint8 kinds, bool flags, QString names, QVariant values).
+ *
+ * A Snapshot frame describes the whole graph as additions and replaces
+ * whatever the receiver knew; a Delta frame applies on top of the previous
+ * frame. Within a frame, removals come first, then nodes and ports, then
+ * connections, then values and activation, so a frame can be applied in
+ * order. The receiver may send Command bytes back.
+ */
+class GraphDeltaCodec
+{
+public:
+    enum class FrameKind : quint8
+    {
+        Delta = 1,
+        Snapshot = 2
+    };
+
+    /**
+     * @brief Single-byte requests sent by the receiving runtime.
+     */
+    enum class Command : quint8
+    {
+        Resync = 'R' ///< Send a Snapshot frame next.
+    };
+
+    struct Frame
+    {
+        FrameKind kind = FrameKind::Delta;
+        quint64 revision = 0; ///< Revision of the snapshot the frame brings the receiver to.
+        QVector<GraphDelta> events;
+    };
+
+    /**
+     * @brief Changes turning @p older into @p newer; everything in @p newer when @p older is null.
+     *
+     * Proportional to the number of changed node records. Groups are not
+     * streamed, so connections ending on a group port are left out.
+     */
+    static QVector<GraphDelta> diff(const GraphSnapshot* older, const GraphSnapshot& newer);
+
+    /**
+     * @brief Serialize one frame, size prefix included.
+     */
+    static QByteArray encode(FrameKind kind, quint64 revision, const QVector<GraphDelta>& events);
+
+    /**
+     * @brief Remove the first complete frame from @p buffer into @p frame.
+     * @return False if @p buffer does not hold a complete frame yet, in which case it is left
+     * untouched, or if the frame was malformed, in which case it is dropped and reported.
+     */
+    static bool takeFrame(QByteArray& buffer, Frame& frame);
+};
+
+/**
+ * @brief Publishes graph changes to an external runtime over a QLocalSocket.
+ *
+ * Every frame interval the GUI thread takes a registry snapshot, which is
+ * cheap when nothing changed, and hands it to a worker thread. The worker
+ * diffs it against the last snapshot it sent, encodes the result as one
+ * Delta frame and writes it. Diffing, encoding and socket I/O never run on
+ * the GUI thread.
+ *
+ * Updates coalesce: whatever changed between two frames, however many
+ * times, goes out as one batch. When the socket falls behind, frames are
+ * skipped and the next one covers everything since the last one sent.
+ * A Snapshot frame is sent on every (re)connection and whenever the runtime
+ * sends GraphDeltaCodec::Command::Resync or requestResync() is called.
+ */
+class GraphDeltaPublisher final : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Construct a publisher of @p registry's changes; nothing is sent until connectToServer().
+     */
+    explicit GraphDeltaPublisher(std::shared_ptr<GraphRegistry> registry, QObject* parent = nullptr);
+    ~GraphDeltaPublisher() override;
+
+    /**
+     * @brief Connect to the local server @p serverName and start publishing.
+     */
+    void connectToServer(const QString& serverName);
+
+    /**
+     * @brief Stop publishing and close the connection.
+     */
+    void disconnectFromServer();
+
+    bool isConnected() const;
+
+    /**
+     * @brief Time between two registry polls, 16 ms (one frame) by default.
+     */
+    void setFrameInterval(int ms);
+    int frameInterval() const;
+
+    /**
+     * @brief Poll the registry now instead of waiting for the next frame.
+     */
+    void publishNow();
+
+    /**
+     * @brief Send a full Snapshot frame next.
+     */
+    void requestResync();
+
+    /**
+     * @brief Number of events written to the socket so far.
+     */
+    qint64 sentEvents() const;
+
+signals:
+    void sgnConnected();
+    void sgnDisconnected();
+
+private:
+    class Writer;
+
+    std::shared_ptr<GraphRegistry> m_registry;
+    std::shared_ptr<const GraphSnapshot> m_posted; ///< Last snapshot handed to the writer.
+    QTimer m_frameTimer;                           ///< Polls the registry while publishing.
+    QThread m_thread;                              ///< Runs the writer.
+    Writer* m_writer = nullptr;                    ///< Lives in m_thread; deleted when it finishes.
+
+    std::atomic<bool> m_connected{false}; ///< Written by the writer.
+    std::atomic<qint64> m_sentEvents{0};  ///< Written by the writer.
+};
@@ -24,17 +24,30 @@
 
 #pragma once
 
+#include "utility/ExecutionPlan.hpp"
+#include "utility/GraphIds.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "utility/GroupDescriptor.hpp"
+#include "utility/NodeDescriptor.hpp"
+#include "utility/ObjectPool.hpp"
+#include "utility/SearchIndex.hpp"
+#include "utility/Symbol.hpp"
+
+#include <QHash>
 #include <QMap>
 #include <QMutex>
 #include <QPointF>
+#include <QSet>
 #include <QVector>
+#include <memory>
 
 class NodeItem;
 class GroupItem;
 class PortLabel;
 class ConnectionItem;
-struct GroupDescriptor;
-struct NodeDescriptor;
+class ParameterBinder;
+class ParameterEditorPool;
+class ParameterStore;
 
 /**
  * @brief Global registry for all nodes, groups, ports, and their connections.
@@ -43,10 +56,11 @@ struct NodeDescriptor;
  * GroupItem, PortLabel, and ConnectionItem participating in the graph.
  *
  * Its responsibilities include:
- *  - Assigning unique IDs to nodes and groups.
+ *  - Assigning unique IDs to nodes, groups, ports and connections.
  *  - Tracking ports and connections.
  *  - Maintaining group membership and port forwarding rules.
  *  - Providing lookup utilities by name, port, or ownership.
+ *  - Publishing immutable GraphSnapshot copies for background readers.
  *
  */
 class GraphRegistry
@@ -69,6 +83,16 @@ public:
      */
     NodeDescriptor* getNode(NodeItem* n);
 
+    /**
+     * @brief Returns the registered port with the given id, or nullptr.
+     */
+    PortLabel* getPortById(PortId id) const;
+
+    /**
+     * @brief Returns the registered connection with the given id, or nullptr.
+     */
+    ConnectionItem* getConnectionById(ConnectionId id) const;
+
     /**
      * @brief Returns a PortLabel matching the given node name and port name.
      */
@@ -93,6 +117,21 @@ public:
      */
     QVector<GroupDescriptor*> allGroups() const;
 
+    /**
+     * @brief Returns every registered connection.
+     */
+    QVector<ConnectionItem*> allConnections() const;
+
+    /**
+     * @brief Number of registered nodes, groups included, without copying them.
+     */
+    int nodeCount() const;
+
+    /**
+     * @brief Number of registered connections, without copying them.
+     */
+    int connectionCount() const;
+
     // -------------------------------------------------------------------------
     // Find helpers
     // -------------------------------------------------------------------------
@@ -112,6 +151,16 @@ public:
      */
     NodeDescriptor* findNodeInGroup(const QString& name, GroupItem* g);
 
+    /**
+     * @brief Fuzzy search over node names, titles, port names and tag names.
+     * @param query Text to look for; one or two characters match name prefixes only.
+     * @param limit Maximum number of hits returned.
+     *
+     * The index follows snapshot(), so only nodes renamed, added or removed
+     * since the previous search are re-indexed. GUI thread only.
+     */
+    QVector<SearchHit> search(const QString& query, int limit = 20);
+
     // -------------------------------------------------------------------------
     // Port / connection helpers
     // -------------------------------------------------------------------------
@@ -144,12 +193,12 @@ public:
     /**
      * @brief Finds a connection leaving fromPort and ending at a port with the given name.
      */
-    ConnectionItem* findConnection(PortLabel& fromPort, QString portName, QString moduleName);
+    ConnectionItem* findConnection(PortLabel& fromPort, Symbol portName, Symbol moduleName);
 
     /**
      * @brief Checks whether fromPort is connected to a target port with the given name and module.
      */
-    bool hasConnectionTo(PortLabel& fromPort, QString toPortName, QString toPortModuleName);
+    bool hasConnectionTo(PortLabel& fromPort, Symbol toPortName, Symbol toPortModuleName);
 
     /**
      * @brief Checks whether fromPort is directly connected to toPort.
@@ -183,9 +232,106 @@ public:
      */
     PortLabel* getParameterPortByName(const NodeItem& node, const QString& portName);
 
+    // -------------------------------------------------------------------------
+    // Snapshots
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Publishes and returns an immutable snapshot of the current graph.
+     *
+     * Only the records of nodes and groups touched since the previous call are
+     * rebuilt; every other record is shared with the previous snapshot. Must be
+     * called from the thread owning the scene items (the GUI thread).
+     */
+    std::shared_ptr<const GraphSnapshot> snapshot();
+
+    /**
+     * @brief Returns the last published snapshot without rebuilding anything.
+     *
+     * Safe to call from any thread; never returns nullptr. Takes no registry
+     * lock: the pointer is published with the std::atomic_load/atomic_store
+     * overloads for shared_ptr, which the standard library may implement with
+     * a short internal spinlock rather than a lock-free instruction.
+     */
+    std::shared_ptr<const GraphSnapshot> latestSnapshot() const;
+
+    /**
+     * @brief Returns the graph compiled for execution, with groups flattened.
+     *
+     * The plan is cached and recompiled only after nodes, ports, connections
+     * or group forwarding changed; moves, renames and color changes keep it.
+     * Must be called from the GUI thread, like snapshot().
+     */
+    std::shared_ptr<const ExecutionPlan> executionPlan();
+
+    /**
+     * @brief Incremented by every change that invalidates executionPlan().
+     */
+    quint64 topologyRevision() const;
+
+    /**
+     * @brief Pre-sizes the registry indexes before a bulk load.
+     * @param nodes Expected number of nodes.
+     * @param connections Expected number of connections.
+     */
+    void reserve(int nodes, int connections);
+
+    // -------------------------------------------------------------------------
+    // Parameter values
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the typed value store shared by all parameter widgets of this graph.
+     */
+    ParameterStore& parameterStore();
+
+    /**
+     * @brief Returns the binder that keeps parameter widgets in sync with parameterStore().
+     */
+    ParameterBinder& parameterBinder();
+
+    /**
+     * @brief Returns the pool lazy nodes borrow live parameter editors from.
+     */
+    ParameterEditorPool& parameterEditorPool();
+
 private:
     NodeDescriptor* lookupNodeUnlocked(NodeItem* n) const;
     GroupDescriptor* lookupGroupUnlocked(GroupItem* g) const;
+
+    /// Flags a node or group whose record must be rebuilt by the next snapshot().
+    void markDirty(NodeItem* n);
+    void markDirtyUnlocked(NodeItem* n);
+
+    /// Gives @p p an id if it has none and indexes it; returns the id.
+    PortId registerPortIdUnlocked(PortLabel* p);
+    /// Drops @p p from the id and owner indexes; the port keeps its id.
+    void unregisterPortIdUnlocked(PortLabel const* p);
+    /// Returns the node or group owning @p port, or nullptr if the port is not registered.
+    NodeItem* portOwnerUnlocked(PortLabel const* port) const;
+    /// Returns the uid of the node owning @p port, or -1.
+    qint64 ownerUidUnlocked(PortLabel const* port) const;
+    /// Maps forwarding-index ids back to ports, skipping ports no longer registered.
+    QVector<PortLabel*> portsByIdUnlocked(const QVector<PortId>& ids) const;
+    /// Drops the bookkeeping of every connection attached to @p nd.
+    void forgetConnectionsUnlocked(const NodeDescriptor& nd);
+    /// Drops the bookkeeping of every connection ending at port @p port, about to be removed from @p nd.
+    void forgetPortConnectionsUnlocked(NodeDescriptor& nd, PortId port);
+    /// Removes @p c from the registry and returns the node or group it entered.
+    NodeItem* unregisterConnectionUnlocked(ConnectionItem* c);
+    /// Records @p forward → @p actual in both forwarding indices.
+    void indexForwardUnlocked(PortLabel* forward, PortLabel* actual);
+    /// Adds @p forward → @p actual to @p rules, one of @p g's forwarding tables, and indexes it.
+    void registerForwardUnlocked(GroupItem* g, QMap<PortLabel*, QVector<PortLabel*>>& rules, PortLabel* forward, PortLabel* actual);
+    /// Drops every forwarding index entry of the group port @p forward; never dereferences the port.
+    void unindexForwardUnlocked(PortId forward);
+    /// Marks the nodes and groups at both ends of every connection of port @p port dirty.
+    void markPortConnectionsDirtyUnlocked(PortId port);
+    /// Fills @p edge from the ends of connection @p id; false if an end is no longer registered.
+    bool buildEdgeRecordUnlocked(ConnectionId id, EdgeRecord& edge) const;
+    NodeRecord buildNodeRecordUnlocked(const NodeDescriptor& nd) const;
+    GroupRecord buildGroupRecordUnlocked(const GroupDescriptor& gd) const;
+    ExecutionPlan::Source buildPlanSourceUnlocked() const;
     // -------------------------------------------------------------------------
     // Node registration
     // -------------------------------------------------------------------------
@@ -201,6 +347,19 @@ private:
      * @brief Removes a previously registered node.
      */
     void unregisterNode(NodeItem* n);
+
+    /**
+     * @brief Hides a node kept alive for reuse from snapshots, plans, search and allNodes().
+     *
+     * The node keeps its uid and port ids; it is reported as removed until unparkNode().
+     * Parked nodes must not hold connections.
+     */
+    void parkNode(NodeItem* n);
+
+    /**
+     * @brief Makes a node hidden by parkNode() part of the graph again.
+     */
+    void unparkNode(NodeItem* n);
     /// Registers individual ports belonging to a node.
     void registerInput(NodeItem* n, PortLabel* p);
     void registerOutput(NodeItem* n, PortLabel* p);
@@ -220,6 +379,12 @@ private:
      */
     void unregisterConnection(ConnectionItem* c);
 
+    /**
+     * @brief Removes many connections under a single lock.
+     * @return The nodes and groups the removed connections entered.
+     */
+    QSet<NodeItem*> unregisterConnections(const QVector<ConnectionItem*>& connections);
+
     /**
      * @brief Should be called when a node is moved in the scene (used for updating connection paths).
      */
@@ -230,6 +395,14 @@ private:
     void registerForwardOutput(GroupItem* g, PortLabel* forward, PortLabel* actual);
     void registerForwardParameter(GroupItem* g, PortLabel* forward, PortLabel* actual);
 
+    /**
+     * @brief Registers many forwarding rules of @p g under a single lock.
+     *
+     * Each rule lands in the input, output or parameter table according to
+     * the orientation of its group port.
+     */
+    void registerForwardPorts(GroupItem* g, const QVector<ForwardRule>& rules);
+
     /// Removes all forwarding rules for a given forwarded port.
     void unregisterForwardPort(GroupItem* g, PortLabel* forward);
 
@@ -258,16 +431,65 @@ private:
     void removeNodeFromGroup(GroupItem* g, NodeItem const* n);
 
 private:
-    mutable QRecursiveMutex m_mutex;             ///< Protects all registry state.
-    QMap<NodeItem*, NodeDescriptor*> m_nodes;    ///< All registered nodes.
-    QMap<GroupItem*, GroupDescriptor*> m_groups; ///< All registered groups.
+    mutable QRecursiveMutex m_mutex;                 ///< Protects all registry state.
+    QMap<NodeItem*, NodeDescriptor*> m_nodes;        ///< All registered nodes.
+    QMap<GroupItem*, GroupDescriptor*> m_groups;     ///< All registered groups.
+    QHash<NodeItem*, NodeDescriptor*> m_parkedNodes; ///< Registered nodes hidden by parkNode().
+
+    ObjectPool<NodeDescriptor> m_nodePool;   ///< Storage for m_nodes descriptors.
+    ObjectPool<GroupDescriptor> m_groupPool; ///< Storage for m_groups descriptors.
 
     qint64 m_nextNodeId = 1;  ///< Auto-incrementing node ID counter.
     qint64 m_nextGroupId = 1; ///< Auto-incrementing group ID counter.
+    PortId m_nextPortId = 1;             ///< Auto-incrementing port ID counter, never reused.
+    ConnectionId m_nextConnectionId = 1; ///< Auto-incrementing connection ID counter, never reused.
+
+    /**
+     * @brief Both ends of a registered connection.
+     */
+    struct ConnectionEnds
+    {
+        PortLabel* output = nullptr;
+        PortLabel* input = nullptr;
+        NodeItem* outputNode = nullptr;
+        NodeItem* inputNode = nullptr;
+        PortId outputId = invalidGraphId; ///< Id of @ref output when it was registered.
+        PortId inputId = invalidGraphId;  ///< Id of @ref input when it was registered.
+    };
+    QHash<ConnectionId, ConnectionEnds> m_connectionEnds;      ///< Ends of every registered connection.
+    QHash<ConnectionId, ConnectionItem*> m_connections;        ///< Registered connections by id.
+    QHash<NodeItem*, QVector<ConnectionId>> m_nodeConnections; ///< Entries of m_connectionEnds per end node.
+    QHash<PortId, QVector<ConnectionId>> m_portConnections;    ///< Entries of m_connectionEnds per end port id.
+
+    /// Lists connection @p id under the nodes and ports of @p ends; call alongside every m_connectionEnds insert.
+    void indexEndsUnlocked(ConnectionId id, const ConnectionEnds& ends);
+    /// Reverses indexEndsUnlocked(); never dereferences the ends.
+    void unindexEndsUnlocked(ConnectionId id, const ConnectionEnds& ends);
+
+    QHash<PortId, PortLabel*> m_ports;                ///< Registered node and group ports by id.
+    QHash<PortId, NodeItem*> m_portOwners;            ///< Node port → owning node.
+    QHash<PortId, GroupItem*> m_forwardPortOwners;    ///< Group-forwarded port → owning group.
+    QHash<PortId, QVector<PortId>> m_forwardToActual; ///< Group port → actual ports it forwards to.
+    QHash<PortId, QVector<PortId>> m_actualToForward; ///< Actual port → group ports forwarding to it.
+
+    QSet<NodeItem*> m_dirtyNodes;   ///< Nodes whose record is stale.
+    QSet<GroupItem*> m_dirtyGroups; ///< Groups whose record is stale.
+    QSet<qint64> m_removedNodes;    ///< Uids of nodes unregistered since the last snapshot.
+    QSet<qint64> m_removedGroups;   ///< Uids of groups unregistered since the last snapshot.
+
+    quint64 m_topologyRevision = 1;              ///< Bumped by node, port, connection and forwarding changes.
+    std::shared_ptr<const ExecutionPlan> m_plan; ///< Compiled at m_plan->topologyRevision().
+
+    std::shared_ptr<const GraphSnapshot> m_published;   ///< Last published snapshot, accessed only through std::atomic_load/atomic_store.
+    std::unique_ptr<ParameterStore> m_parameterStore;   ///< Parameter values, GUI thread only.
+    std::unique_ptr<ParameterBinder> m_parameterBinder; ///< Widgets bound to m_parameterStore, GUI thread only.
+    std::unique_ptr<ParameterEditorPool> m_editorPool;  ///< Editors lent to lazy nodes, GUI thread only.
+    SearchIndex m_searchIndex;                          ///< Backs search(), GUI thread only.
     friend class NodeItem;
     friend class GroupItem;
     friend class NodeFactory;
     friend class GraphScene;
+    friend class VirtualGraph;
     friend struct WidgetVisitor;
     friend class GraphRegistryTest;
 };
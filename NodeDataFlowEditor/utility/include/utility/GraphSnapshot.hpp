@@ -0,0 +1,192 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "taggable/TagRegistry.hpp"
+#include "utility/GraphIds.hpp"
+#include "utility/PersistentVector.hpp"
+
+#include <QColor>
+#include <QPointF>
+#include <QSizeF>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Immutable copy of a single port taken when the snapshot was published.
+ */
+struct PortRecord
+{
+    /**
+     * @brief Kind of port, mirrors PortLabel::Orientation without depending on the view.
+     */
+    enum class Kind : uint8_t
+    {
+        Input,
+        Parameter,
+        Output
+    };
+
+    PortId id = invalidGraphId; ///< Registry id of the port.
+    QString name;               ///< Internal (stable) port name.
+    QString displayName;        ///< User-visible label.
+    Kind kind = Kind::Input;
+    TagBitMask tags{};        ///< Tags attached to the port.
+    QVariant value;           ///< Current parameter value, leaf 0 (parameter ports only).
+    QVector<QVariant> values; ///< Every leaf value in leaf order, one per editor of a container port.
+};
+
+/**
+ * @brief Immutable copy of a connection, stored on the record of the node or group that emits it.
+ *
+ * An end on a group port has its node uid set to -1 and its group uid set
+ * instead; the group's ForwardRecord entries resolve the port id to member ports.
+ */
+struct EdgeRecord
+{
+    ConnectionId id = invalidGraphId;   ///< Registry id of the connection.
+    qint64 fromNode = -1;               ///< Uid of the node owning the output port.
+    qint64 fromGroup = -1;              ///< Uid of the group owning the output port, if it is a group port.
+    PortId fromPortId = invalidGraphId; ///< Registry id of the output port.
+    QString fromPort;                   ///< Output port name.
+    qint64 toNode = -1;                 ///< Uid of the node owning the input or parameter port.
+    qint64 toGroup = -1;                ///< Uid of the group owning the input or parameter port, if it is a group port.
+    PortId toPortId = invalidGraphId;   ///< Registry id of the input or parameter port.
+    QString toPort;                     ///< Input or parameter port name.
+    bool active = false;                ///< Whether the connection is currently active.
+};
+
+/**
+ * @brief Immutable copy of a node and its outgoing connections.
+ */
+struct NodeRecord
+{
+    qint64 uid = -1;
+    QString name;          ///< Internal node name.
+    QString displayedName; ///< User-visible title.
+    QPointF position;      ///< Scene position.
+    QSizeF size;           ///< Size of the node body.
+    QColor titleColor;
+    bool active = false;
+    bool visible = true;
+
+    QVector<PortRecord> inputs;
+    QVector<PortRecord> outputs;
+    QVector<PortRecord> parameters;
+    QVector<EdgeRecord> outgoing; ///< Connections leaving this node's output ports.
+};
+
+/**
+ * @brief Forwarding rule of a group port to a member node port.
+ */
+struct ForwardRecord
+{
+    QString groupPort;                   ///< Name of the port exposed by the group.
+    qint64 node = -1;                    ///< Uid of the member node owning the actual port.
+    QString port;                        ///< Name of the actual port.
+    PortRecord::Kind kind = PortRecord::Kind::Input;
+    PortId groupPortId = invalidGraphId; ///< Registry id of the group port.
+    PortId portId = invalidGraphId;      ///< Registry id of the actual port.
+};
+
+/**
+ * @brief Immutable copy of a group, its members and forwarding rules.
+ */
+struct GroupRecord
+{
+    qint64 uid = -1;
+    QString name;
+    QString displayedName;
+    QPointF position;
+    QVector<qint64> members; ///< Uids of the member nodes.
+    QVector<ForwardRecord> forwards;
+    QVector<EdgeRecord> outgoing; ///< Connections leaving this group's output ports.
+};
+
+/**
+ * @brief Read-only view of the whole graph at a given revision.
+ *
+ * Snapshots are produced by GraphRegistry::snapshot() on the GUI thread and
+ * never change afterwards, so they can be handed to worker threads (layout,
+ * export, evaluation...) without holding the registry lock. Consecutive
+ * snapshots share every record that did not change between them.
+ */
+class GraphSnapshot
+{
+public:
+    /**
+     * @brief Monotonic revision, incremented every time a new snapshot is published.
+     */
+    quint64 revision() const { return m_revision; }
+
+    /**
+     * @brief Returns the record of node @p uid, or nullptr if it does not exist.
+     */
+    std::shared_ptr<const NodeRecord> node(qint64 uid) const;
+
+    /**
+     * @brief Returns the record of group @p uid, or nullptr if it does not exist.
+     */
+    std::shared_ptr<const GroupRecord> group(qint64 uid) const;
+
+    int nodeCount() const { return m_nodeCount; }
+    int groupCount() const { return m_groupCount; }
+
+    /**
+     * @brief Calls @p fn for every node, in uid order.
+     */
+    void forEachNode(const std::function<void(const NodeRecord&)>& fn) const;
+
+    /**
+     * @brief Calls @p fn for every group, in uid order.
+     */
+    void forEachGroup(const std::function<void(const GroupRecord&)>& fn) const;
+
+    /**
+     * @brief Collects every connection of the graph, including those ending on group ports.
+     */
+    QVector<EdgeRecord> edges() const;
+
+    /**
+     * @brief Calls @p fn(before, after) for every node record that differs from @p older.
+     *
+     * Unchanged subtrees are skipped, so this is proportional to the amount
+     * of change. @p before is nullptr for new nodes, @p after for removed ones.
+     */
+    void forEachNodeChange(const GraphSnapshot& older,
+                           const std::function<void(const NodeRecord* before, const NodeRecord* after)>& fn) const;
+
+private:
+    friend class GraphRegistry;
+
+    PersistentVector<NodeRecord> m_nodes;   ///< Node records indexed by uid.
+    PersistentVector<GroupRecord> m_groups; ///< Group records indexed by uid.
+    quint64 m_revision = 0;
+    int m_nodeCount = 0;
+    int m_groupCount = 0;
+};
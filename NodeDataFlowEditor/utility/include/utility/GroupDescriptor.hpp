@@ -31,6 +31,15 @@ struct NodeDescriptor;
 class GroupItem;
 class PortLabel;
 
+/**
+ * @brief One forwarding rule: a group port and the node port it stands for.
+ */
+struct ForwardRule
+{
+    PortLabel* forward = nullptr; ///< Port on the group.
+    PortLabel* actual = nullptr;  ///< Port on a member node.
+};
+
 /**
  * @brief Describes a group of nodes.
  *
@@ -22,15 +22,123 @@
     THE SOFTWARE.
 */
 
+
 #pragma once
 
-#include <QMap>
-#include <QVector>
+#include <QVarLengthArray>
+#include <QtGlobal>
 
 class NodeItem;
 class PortLabel;
 class ConnectionItem;
 
+/**
+ * @brief The ports of one node and the connections attached to each of them.
+ *
+ * Storage is flat: ports live in a small array in the order they were
+ * added, which is their declaration order, and the connections of every
+ * port are stored back to back in a second array, grouped in port order
+ * (compressed sparse row). Port @c i owns the edges in [edgeEnd of port
+ * i-1, edgeEnd of port i). A node with up to eight ports and eight
+ * connections needs no heap allocation, and both lookups and walking all
+ * of a node's connections are short linear scans. Iteration order never
+ * depends on where the ports were allocated, so snapshots and execution
+ * plans built from the table are the same from run to run.
+ */
+class PortTable
+{
+public:
+    enum class Kind : quint8
+    {
+        Input,
+        Output,
+        Parameter
+    };
+
+    struct Port
+    {
+        PortLabel* port = nullptr;
+        Kind kind = Kind::Input;
+        int edgeEnd = 0; ///< One past the port's last connection in the edge array.
+    };
+
+    /**
+     * @brief Connections of one port; invalidated by any change to the table.
+     */
+    class Connections
+    {
+    public:
+        Connections() = default;
+        Connections(ConnectionItem* const* first, ConnectionItem* const* last)
+            : m_first(first)
+            , m_last(last)
+        {}
+
+        ConnectionItem* const* begin() const { return m_first; }
+        ConnectionItem* const* end() const { return m_last; }
+        int size() const { return static_cast<int>(m_last - m_first); }
+        bool isEmpty() const { return m_first == m_last; }
+
+    private:
+        ConnectionItem* const* m_first = nullptr;
+        ConnectionItem* const* m_last = nullptr;
+    };
+
+    /**
+     * @brief Append @p port as a @p kind port; an existing port keeps its place and connections and takes the new kind.
+     */
+    void addPort(PortLabel* port, Kind kind);
+
+    /**
+     * @brief Remove @p port and its connections.
+     * @return False if @p port was not in the table.
+     */
+    bool removePort(PortLabel* port);
+
+    /**
+     * @brief Attach @p connection to @p port, adding @p port as a @p kind port if needed.
+     */
+    void addConnection(PortLabel* port, Kind kind, ConnectionItem* connection);
+
+    /**
+     * @brief Detach @p connection from every port; the item is never dereferenced.
+     * @return Number of entries removed.
+     */
+    int removeConnection(ConnectionItem* connection);
+
+    bool contains(PortLabel* port) const { return indexOf(port) >= 0; }
+
+    /**
+     * @brief Index of @p port, or -1.
+     */
+    int indexOf(PortLabel* port) const;
+
+    /**
+     * @brief Connections of @p port; empty if @p port is not in the table.
+     */
+    Connections connections(PortLabel* port) const;
+
+    /**
+     * @brief Connections of the port at @p index.
+     */
+    Connections connectionsAt(int index) const;
+
+    int portCount() const { return static_cast<int>(m_ports.size()); }
+    int connectionCount() const { return static_cast<int>(m_edges.size()); }
+    const Port& portAt(int index) const { return m_ports[index]; }
+
+    const Port* begin() const { return m_ports.constData(); }
+    const Port* end() const { return m_ports.constData() + m_ports.size(); }
+
+    void clear();
+
+private:
+    int edgeBegin(int index) const { return index == 0 ? 0 : m_ports[index - 1].edgeEnd; }
+
+    QVarLengthArray<Port, 8> m_ports;            ///< In the order the ports were added.
+    QVarLengthArray<ConnectionItem*, 8> m_edges; ///< Connections grouped by port, in m_ports order.
+};
+
 /**
  * @brief Describes a single node in the graph.
  *
@@ -42,13 +150,5 @@ struct NodeDescriptor
 {
     qint64 uid = -1;          ///< Globally unique node ID assigned by GraphRegistry.
     NodeItem* node = nullptr; ///< Pointer to the actual NodeItem in the scene.
-
-    /// Map of input ports to the connections entering the node.
-    QMap<PortLabel*, QVector<ConnectionItem*>> inputsDescriptor;
-
-    /// Map of output ports to the connections leaving the node.
-    QMap<PortLabel*, QVector<ConnectionItem*>> outputsDescriptor;
-
-    /// Map of parameter ports to connections feeding parameter inputs.
-    QMap<PortLabel*, QVector<ConnectionItem*>> parametersInputsDescriptor;
+    PortTable ports;          ///< Input, output and parameter ports with their connections.
 };
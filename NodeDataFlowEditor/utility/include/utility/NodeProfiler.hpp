@@ -0,0 +1,149 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <functional>
+
+/**
+ * @brief Cost of one node invocation.
+ */
+struct NodeProfileSample
+{
+    qint64 wallNs = 0;      ///< Elapsed time.
+    qint64 cpuNs = 0;       ///< CPU time of the executing thread.
+    qint64 bytesIn = 0;     ///< Payload bytes read from inputs.
+    qint64 bytesOut = 0;    ///< Payload bytes written to outputs.
+    qint64 queueWaitNs = 0; ///< Time the invocation waited before it started.
+};
+
+/**
+ * @brief Aggregated cost of one node since the last reset.
+ */
+struct NodeProfileStats
+{
+    qint64 uid = -1;
+    quint64 invocations = 0;
+    qint64 wallNs = 0;
+    qint64 cpuNs = 0;
+    qint64 maxWallNs = 0;
+    qint64 bytesIn = 0;
+    qint64 bytesOut = 0;
+    qint64 queueWaitNs = 0;
+    double percentile = 0; ///< Rank of wallNs among profiled nodes, 0 (cheapest) to 1 (costliest).
+
+    double meanWallMs() const { return invocations ? wallNs / 1e6 / invocations : 0.0; }
+};
+
+/**
+ * @brief Thread-safe per-node execution statistics, keyed by registry uid.
+ *
+ * Executors call record() (or use a Scope) from any thread. Recording is a
+ * no-op while the profiler is disabled, and a Scope does not even read the
+ * clocks then. Readers take aggregates with stats(); revision() tells them
+ * whether anything was recorded since they last looked.
+ */
+class NodeProfiler
+{
+public:
+    /**
+     * @brief Measures wall and thread CPU time from construction to destruction.
+     */
+    class Scope
+    {
+    public:
+        Scope(NodeProfiler& profiler, qint64 uid, qint64 queueWaitNs = 0);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        void addBytesIn(qint64 bytes) { m_sample.bytesIn += bytes; }
+        void addBytesOut(qint64 bytes) { m_sample.bytesOut += bytes; }
+
+    private:
+        NodeProfiler* m_profiler; ///< Null when the profiler was disabled at construction.
+        qint64 m_uid;
+        qint64 m_wallStart = 0;
+        qint64 m_cpuStart = 0;
+        NodeProfileSample m_sample;
+    };
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * @brief Add one invocation of node @p uid.
+     */
+    void record(qint64 uid, const NodeProfileSample& sample);
+
+    /**
+     * @brief Aggregates of every profiled node, percentiles filled in.
+     */
+    QVector<NodeProfileStats> stats() const;
+
+    /**
+     * @brief Aggregates of node @p uid; invocations is 0 if it never ran.
+     */
+    NodeProfileStats stats(qint64 uid) const;
+
+    /**
+     * @brief Forget node @p uid, e.g. after it was deleted.
+     */
+    void remove(qint64 uid);
+    void reset();
+
+    /**
+     * @brief Incremented by every record(), remove() and reset().
+     */
+    quint64 revision() const;
+
+    /**
+     * @brief Aggregates as CSV with a header row, costliest node first.
+     * @param nameOf Resolves a uid to a node name for the name column; uids are used if empty.
+     */
+    QString toCsv(const std::function<QString(qint64)>& nameOf = {}) const;
+
+    /**
+     * @brief Write toCsv() to @p path.
+     * @return False if the file could not be written.
+     */
+    bool exportCsv(const QString& path, const std::function<QString(qint64)>& nameOf = {}) const;
+
+    /**
+     * @brief Monotonic clock and CPU time of the calling thread, in nanoseconds.
+     */
+    static qint64 wallClockNs();
+    static qint64 threadCpuNs();
+
+private:
+    mutable QMutex m_mutex;
+    QHash<qint64, NodeProfileStats> m_stats; ///< Guarded by m_mutex.
+    std::atomic<bool> m_enabled{false};
+    std::atomic<quint64> m_revision{0};
+};
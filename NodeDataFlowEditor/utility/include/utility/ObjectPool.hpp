@@ -0,0 +1,116 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed-type slab allocator with an intrusive freelist.
+ *
+ * Objects are constructed in place inside chunks of @p ChunkSize slots.
+ * Destroyed slots go on a freelist and are reused by the next create(), so
+ * repeatedly building and tearing down graphs does not hit the global
+ * allocator once the pool has grown to its working size. Chunks are only
+ * released when the pool itself is destroyed.
+ *
+ * Not thread-safe: callers serialize access (GraphRegistry holds its mutex).
+ * Objects still alive when the pool is destroyed are not destructed; owners
+ * must destroy() them first.
+ */
+template <typename T, std::size_t ChunkSize = 256>
+class ObjectPool
+{
+public:
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @brief Construct a T in a pooled slot.
+     */
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+        if (!m_free)
+            grow();
+
+        Slot* slot = m_free;
+        m_free = slot->next;
+        T* object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        ++m_live;
+        return object;
+    }
+
+    /**
+     * @brief Destruct @p object and return its slot to the freelist.
+     */
+    void destroy(T* object)
+    {
+        if (!object)
+            return;
+
+        object->~T();
+        auto* slot = reinterpret_cast<Slot*>(object);
+        slot->next = m_free;
+        m_free = slot;
+        --m_live;
+    }
+
+    /**
+     * @brief Number of live objects.
+     */
+    std::size_t size() const { return m_live; }
+
+    /**
+     * @brief Number of slots allocated so far (live + free).
+     */
+    std::size_t capacity() const { return m_chunks.size() * ChunkSize; }
+
+private:
+    union Slot
+    {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void grow()
+    {
+        auto chunk = std::make_unique<Slot[]>(ChunkSize);
+        for (std::size_t i = ChunkSize; i-- > 0;)
+        {
+            chunk[i].next = m_free;
+            m_free = &chunk[i];
+        }
+        m_chunks.push_back(std::move(chunk));
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks; ///< Backing storage, never shrunk.
+    Slot* m_free = nullptr;                        ///< Head of the freelist.
+    std::size_t m_live = 0;                        ///< Objects currently constructed.
+};
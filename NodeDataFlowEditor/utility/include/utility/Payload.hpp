@@ -0,0 +1,146 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "taggable/TagRegistry.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+/**
+ * @brief Immutable, reference-counted value carried along connections.
+ *
+ * A payload holds one value of any copyable type together with the port tag
+ * describing it. Copies share the value, so fanning one output out to many
+ * inputs costs a reference count per input and no copy of the data. A
+ * consumer that needs to change the value calls mutate(), which copies it
+ * first if anyone else still holds it (copy-on-write).
+ *
+ * For large data, hold a PooledBuffer (or a type built on one): the clone a
+ * mutate() makes then comes from the same BufferPool.
+ *
+ * @code
+ * Payload image = Payload::make<data::ImageType>(pool->acquire(width * height * 4));
+ * router.publish(output->id(), image);            // shared by every consumer
+ *
+ * Payload mine = router.take(input->id());
+ * PooledBuffer* pixels = mine.mutate<PooledBuffer>(); // copied only if still shared
+ * @endcode
+ */
+class Payload
+{
+public:
+    Payload() = default;
+
+    /**
+     * @brief Wrap @p value, typed by port tag @p Tag.
+     */
+    template <typename Tag, typename T>
+    static Payload make(T&& value)
+    {
+        Payload payload;
+        payload.m_data = std::make_shared<Model<std::decay_t<T>>>(std::forward<T>(value));
+        payload.m_tag = TagRegistry::getTagIndex<Tag>();
+        return payload;
+    }
+
+    bool isNull() const { return !m_data; }
+
+    /**
+     * @brief Index of the payload's tag in TagRegistry.
+     */
+    std::size_t tag() const { return m_tag; }
+
+    /**
+     * @brief Whether a port carrying @p portTags may receive this payload.
+     */
+    bool acceptedBy(const TagBitMask& portTags) const { return m_data && m_tag < MaxTags && portTags.test(m_tag); }
+
+    /**
+     * @brief The value, or nullptr if the payload does not hold a T.
+     */
+    template <typename T>
+    const T* get() const
+    {
+        return holds<T>() ? &static_cast<const Model<T>*>(m_data.get())->value : nullptr;
+    }
+
+    /**
+     * @brief A writable value, copied first if other payloads share it.
+     * @return nullptr if the payload does not hold a T.
+     */
+    template <typename T>
+    T* mutate()
+    {
+        if (!holds<T>())
+            return nullptr;
+        if (m_data.use_count() > 1)
+            m_data = m_data->clone();
+        return &static_cast<Model<T>*>(m_data.get())->value;
+    }
+
+    template <typename T>
+    bool holds() const
+    {
+        return m_data && m_data->type() == typeid(T);
+    }
+
+    /**
+     * @brief Whether this payload and @p other share the same value.
+     */
+    bool sharesDataWith(const Payload& other) const { return m_data && m_data == other.m_data; }
+
+    /**
+     * @brief Number of payloads sharing the value.
+     */
+    long useCount() const { return m_data.use_count(); }
+
+private:
+    struct Holder
+    {
+        virtual ~Holder() = default;
+        virtual std::shared_ptr<Holder> clone() const = 0;
+        virtual const std::type_info& type() const = 0;
+    };
+
+    template <typename T>
+    struct Model final : Holder
+    {
+        template <typename U>
+        explicit Model(U&& v)
+            : value(std::forward<U>(v))
+        {}
+
+        std::shared_ptr<Holder> clone() const override { return std::make_shared<Model>(value); }
+        const std::type_info& type() const override { return typeid(T); }
+
+        T value;
+    };
+
+    std::shared_ptr<Holder> m_data; ///< Shared value; never written while shared.
+    std::size_t m_tag = MaxTags;    ///< TagRegistry index of the payload's type tag.
+};
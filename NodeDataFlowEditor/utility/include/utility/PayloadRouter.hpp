@@ -0,0 +1,92 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "taggable/TagRegistry.hpp"
+#include "utility/GraphIds.hpp"
+#include "utility/Payload.hpp"
+
+#include <QHash>
+#include <QMutex>
+#include <QVector>
+
+class GraphSnapshot;
+
+/**
+ * @brief Carries payloads from output ports to the inputs connected to them.
+ *
+ * The fan-out of every output is resolved once per snapshot. Publishing
+ * stores the same Payload in every connected input, so all consumers share
+ * one value. Connections whose ends have no port tag in common are not
+ * routed, and payloads whose tag the target port does not carry are not
+ * delivered; both are reported with a warning.
+ *
+ * Thread-safe: executors publish and take from worker threads.
+ */
+class PayloadRouter
+{
+public:
+    /**
+     * @brief Route along the connections of @p snapshot; payloads already delivered are kept.
+     */
+    void setSnapshot(const GraphSnapshot& snapshot);
+
+    /**
+     * @brief Deliver @p payload to every input connected to output @p output.
+     * @return Number of inputs that received it.
+     */
+    int publish(PortId output, const Payload& payload);
+
+    /**
+     * @brief The payload last delivered to @p input, shared; null if none.
+     */
+    Payload input(PortId input) const;
+
+    /**
+     * @brief Remove and return the payload last delivered to @p input.
+     *
+     * Taking drops the router's reference, so a consumer that is the last
+     * holder can mutate the value without a copy.
+     */
+    Payload take(PortId input);
+
+    /**
+     * @brief Number of inputs connected to @p output.
+     */
+    int fanOut(PortId output) const;
+
+    void clear();
+
+private:
+    struct Target
+    {
+        PortId port = invalidGraphId;
+        TagBitMask tags{}; ///< Tags of the input; a payload must carry one of them.
+    };
+
+    mutable QMutex m_mutex;
+    QHash<PortId, QVector<Target>> m_targets; ///< Inputs fed by each output.
+    QHash<PortId, Payload> m_inputs;          ///< Latest payload of each input.
+};
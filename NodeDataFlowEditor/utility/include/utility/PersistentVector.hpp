@@ -0,0 +1,242 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Immutable, index-addressed vector with structural sharing.
+ *
+ * PersistentVector is a 32-way radix trie whose nodes are never modified once
+ * published. Updating an index copies only the path from the root to the
+ * touched leaf (at most a handful of 32-slot nodes) and shares every other
+ * subtree with the previous version. Copies are therefore O(1), updates are
+ * O(log32 n), and any number of versions can be read concurrently from
+ * different threads without locking.
+ *
+ * Elements are stored as std::shared_ptr<const T>; an empty slot is nullptr.
+ * The vector is meant to be indexed by dense, monotonically allocated ids
+ * (e.g. node or group uids), so holes left by removed entries are cheap.
+ */
+template <typename T>
+class PersistentVector
+{
+public:
+    using value_type = std::shared_ptr<const T>;
+
+    static constexpr unsigned Bits = 5;
+    static constexpr std::size_t Width = std::size_t(1) << Bits;
+    static constexpr std::size_t Mask = Width - 1;
+
+    PersistentVector() = default;
+
+    /**
+     * @brief Number of addressable slots (highest assigned index + 1).
+     */
+    std::size_t size() const { return m_size; }
+
+    /**
+     * @brief Returns the element stored at @p index, or nullptr if the slot is empty.
+     */
+    value_type at(std::size_t index) const
+    {
+        if (index >= m_size || !m_root)
+            return nullptr;
+
+        const Node* node = m_root.get();
+        for (unsigned shift = m_shift; shift > 0; shift -= Bits)
+        {
+            node = static_cast<const Branch*>(node)->cells[(index >> shift) & Mask].get();
+            if (!node)
+                return nullptr;
+        }
+        return static_cast<const Leaf*>(node)->cells[index & Mask];
+    }
+
+    /**
+     * @brief Returns a new version with @p value stored at @p index.
+     *
+     * This instance is left untouched; the result shares every subtree that
+     * does not lie on the path to @p index.
+     */
+    PersistentVector set(std::size_t index, value_type value) const
+    {
+        PersistentVector out(*this);
+        while (index >= out.capacity())
+        {
+            auto branch = std::make_shared<Branch>();
+            branch->cells[0] = out.m_root;
+            out.m_root = std::move(branch);
+            out.m_shift += Bits;
+        }
+        out.m_root = assoc(out.m_root.get(), out.m_shift, index, std::move(value));
+        out.m_size = std::max(out.m_size, index + 1);
+        return out;
+    }
+
+    /**
+     * @brief Returns a new version with the slot at @p index cleared.
+     */
+    PersistentVector erase(std::size_t index) const
+    {
+        if (index >= m_size)
+            return *this;
+        return set(index, nullptr);
+    }
+
+    /**
+     * @brief Invokes @p fn(index, const T&) for every non-empty slot, in index order.
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        if (m_root)
+            visit(m_root.get(), m_shift, 0, fn);
+    }
+
+    /**
+     * @brief Invokes @p fn(index, before, after) for every slot that differs from @p older.
+     *
+     * Subtrees shared between both versions are skipped entirely, so the cost
+     * is proportional to the number of changed entries rather than the size
+     * of the vector. @p before or @p after may be nullptr for insertions and
+     * removals.
+     */
+    template <typename Fn>
+    void forEachChange(const PersistentVector& older, Fn&& fn) const
+    {
+        // Bring both tries to the same height so that cells line up.
+        PersistentVector lhs = older;
+        PersistentVector rhs = *this;
+        while (lhs.m_shift < rhs.m_shift)
+            lhs = lhs.grown();
+        while (rhs.m_shift < lhs.m_shift)
+            rhs = rhs.grown();
+        diff(lhs.m_root.get(), rhs.m_root.get(), rhs.m_shift, 0, fn);
+    }
+
+    /**
+     * @brief True when both versions share the same root (and are thus identical).
+     */
+    bool sharesRootWith(const PersistentVector& other) const
+    {
+        return m_root == other.m_root && m_size == other.m_size;
+    }
+
+private:
+    struct Node
+    {
+        virtual ~Node() = default;
+    };
+
+    struct Branch final : Node
+    {
+        std::array<std::shared_ptr<const Node>, Width> cells{};
+    };
+
+    struct Leaf final : Node
+    {
+        std::array<value_type, Width> cells{};
+    };
+
+    std::size_t capacity() const { return std::size_t(1) << (m_shift + Bits); }
+
+    PersistentVector grown() const
+    {
+        PersistentVector out(*this);
+        auto branch = std::make_shared<Branch>();
+        branch->cells[0] = out.m_root;
+        out.m_root = std::move(branch);
+        out.m_shift += Bits;
+        return out;
+    }
+
+    static std::shared_ptr<const Node> assoc(const Node* node, unsigned shift, std::size_t index, value_type value)
+    {
+        if (shift == 0)
+        {
+            auto leaf = node ? std::make_shared<Leaf>(*static_cast<const Leaf*>(node)) : std::make_shared<Leaf>();
+            leaf->cells[index & Mask] = std::move(value);
+            return leaf;
+        }
+
+        auto branch = node ? std::make_shared<Branch>(*static_cast<const Branch*>(node)) : std::make_shared<Branch>();
+        auto& child = branch->cells[(index >> shift) & Mask];
+        child = assoc(child.get(), shift - Bits, index, std::move(value));
+        return branch;
+    }
+
+    template <typename Fn>
+    static void visit(const Node* node, unsigned shift, std::size_t base, Fn& fn)
+    {
+        if (shift == 0)
+        {
+            const auto& cells = static_cast<const Leaf*>(node)->cells;
+            for (std::size_t i = 0; i < Width; ++i)
+                if (cells[i])
+                    fn(base + i, *cells[i]);
+            return;
+        }
+
+        const auto& cells = static_cast<const Branch*>(node)->cells;
+        for (std::size_t i = 0; i < Width; ++i)
+            if (cells[i])
+                visit(cells[i].get(), shift - Bits, base + (i << shift), fn);
+    }
+
+    template <typename Fn>
+    static void diff(const Node* before, const Node* after, unsigned shift, std::size_t base, Fn& fn)
+    {
+        if (before == after)
+            return;
+
+        if (shift == 0)
+        {
+            for (std::size_t i = 0; i < Width; ++i)
+            {
+                const T* b = before ? static_cast<const Leaf*>(before)->cells[i].get() : nullptr;
+                const T* a = after ? static_cast<const Leaf*>(after)->cells[i].get() : nullptr;
+                if (a != b)
+                    fn(base + i, b, a);
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < Width; ++i)
+        {
+            const Node* b = before ? static_cast<const Branch*>(before)->cells[i].get() : nullptr;
+            const Node* a = after ? static_cast<const Branch*>(after)->cells[i].get() : nullptr;
+            diff(b, a, shift - Bits, base + (i << shift), fn);
+        }
+    }
+
+    std::shared_ptr<const Node> m_root; ///< Root of the trie (Leaf when m_shift == 0).
+    unsigned m_shift = 0;               ///< Bit shift of the root level.
+    std::size_t m_size = 0;             ///< Highest assigned index + 1.
+};
@@ -0,0 +1,135 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "utility/GraphIds.hpp"
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <memory>
+#include <vector>
+
+class GraphSnapshot;
+struct NodeRecord;
+
+/**
+ * @brief One search result: a node, or one of its ports, whose text matched the query.
+ */
+struct SearchHit
+{
+    /**
+     * @brief What the matched text is.
+     */
+    enum class Field : uint8_t
+    {
+        Name,          ///< Internal node name.
+        DisplayedName, ///< User-visible node title.
+        Port,          ///< Port name or display name.
+        Tag            ///< Name of a tag carried by one of the node's ports.
+    };
+
+    qint64 node = -1;             ///< Uid of the node.
+    PortId port = invalidGraphId; ///< Matched port, for Field::Port.
+    Field field = Field::Name;    ///< What the matched text is.
+    QString text;                 ///< Matched text, as displayed.
+    int score = 0;                ///< Higher is better.
+};
+
+/**
+ * @brief Trigram index over node names, titles, port names and tag names.
+ *
+ * Every term is folded to lower case and split into trigrams, including two
+ * padded ones marking its start, so queries of one or two characters resolve
+ * as prefix lookups and longer ones as substring lookups. Candidates only come
+ * from the rarest posting lists of the query, which keeps lookups fast on large
+ * graphs; up to a third of the query trigrams may be missing, so small typos
+ * still match, ranked below exact, prefix and substring matches.
+ *
+ * update() follows registry snapshots and only re-indexes the nodes whose
+ * names, ports or tags changed. Not thread-safe.
+ */
+class SearchIndex
+{
+public:
+    /**
+     * @brief Bring the index up to date with @p snapshot.
+     *
+     * The first call indexes every node; later calls only visit records that
+     * differ from the previously indexed snapshot.
+     */
+    void update(std::shared_ptr<const GraphSnapshot> snapshot);
+
+    /**
+     * @brief Index @p text as @p field of @p node.
+     */
+    void addTerm(qint64 node, SearchHit::Field field, const QString& text, PortId port = invalidGraphId);
+
+    /**
+     * @brief Drop every term of @p node.
+     */
+    void removeNode(qint64 node);
+
+    /**
+     * @brief Drop every term.
+     */
+    void clear();
+
+    /**
+     * @brief Best matches for @p query, at most one per node or port, best first.
+     */
+    QVector<SearchHit> search(const QString& query, int limit = 20) const;
+
+    /**
+     * @brief Number of indexed terms.
+     */
+    int termCount() const;
+
+private:
+    struct Term
+    {
+        QString text;   ///< Original text.
+        QString folded; ///< Lower-cased text the trigrams come from.
+        qint64 node = -1;
+        PortId port = invalidGraphId;
+        SearchHit::Field field = SearchHit::Field::Name;
+        bool alive = true;
+    };
+
+    /// Score of @p term against @p query when it holds @p matched of its @p total trigrams.
+    static int rank(const Term& term, const QString& query, int matched, int total);
+    /// Adds the terms of @p record.
+    void indexRecord(const NodeRecord& record);
+    /// Drops dead terms and rebuilds the posting lists.
+    void compact();
+    /// Appends term @p id to the posting list of each of its trigrams.
+    void post(int id);
+
+    std::vector<Term> m_terms;                       ///< Terms by id; ids only grow until compact().
+    QHash<quint64, QVector<int>> m_postings;         ///< Trigram → ascending term ids.
+    QHash<qint64, QVector<int>> m_nodeTerms;         ///< Node uid → its term ids.
+    std::shared_ptr<const GraphSnapshot> m_snapshot; ///< Last indexed snapshot.
+    int m_dead = 0;                                  ///< Removed terms still present in posting lists.
+};
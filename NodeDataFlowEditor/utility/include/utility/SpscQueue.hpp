@@ -0,0 +1,96 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer and one consumer thread.
+ *
+ * A ring of capacity + 1 slots; head and tail live on separate cache lines
+ * so the two threads do not contend. tryPush() and tryPop() never block;
+ * callers decide how to wait.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : m_slots(capacity + 1)
+    {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Append @p value unless the queue is full. Producer thread only.
+     */
+    bool tryPush(T&& value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t next = increment(tail);
+        if (next == m_head.load(std::memory_order_acquire))
+            return false;
+        m_slots[tail] = std::move(value);
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Move the oldest value into @p value unless the queue is empty. Consumer thread only.
+     */
+    bool tryPop(T& value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+        value = std::move(m_slots[head]);
+        m_slots[head] = T();
+        m_head.store(increment(head), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Number of queued values; exact only when neither thread is active.
+     */
+    std::size_t size() const
+    {
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : tail + m_slots.size() - head;
+    }
+
+    std::size_t capacity() const { return m_slots.size() - 1; }
+
+private:
+    std::size_t increment(std::size_t index) const { return index + 1 == m_slots.size() ? 0 : index + 1; }
+
+    std::vector<T> m_slots;
+    alignas(64) std::atomic<std::size_t> m_head{0}; ///< Next slot to pop; written by the consumer.
+    alignas(64) std::atomic<std::size_t> m_tail{0}; ///< Next slot to fill; written by the producer.
+};
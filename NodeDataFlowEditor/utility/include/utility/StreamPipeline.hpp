@@ -0,0 +1,186 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "utility/GraphIds.hpp"
+#include "utility/Payload.hpp"
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class GraphSnapshot;
+class NodeProfiler;
+
+/**
+ * @brief Inputs and outputs of one stage invocation in a StreamPipeline.
+ */
+class StreamFrame
+{
+public:
+    /**
+     * @brief Sequence number of the frame, counted per stage from 0.
+     */
+    quint64 index() const { return m_index; }
+
+    /**
+     * @brief The payload that arrived on input or parameter port @p port; null if none.
+     */
+    Payload input(const QString& port) const { return m_inputs.value(port); }
+
+    /**
+     * @brief Send @p payload on output port @p port; outputs left unset send a null payload.
+     */
+    void setOutput(const QString& port, Payload payload) { m_outputs.insert(port, std::move(payload)); }
+
+    /**
+     * @brief End the stream after this frame. Meant for source stages, which run until they finish.
+     */
+    void finish() { m_finished = true; }
+
+private:
+    friend class StreamPipeline;
+
+    quint64 m_index = 0;
+    QHash<QString, Payload> m_inputs;
+    QHash<QString, Payload> m_outputs;
+    bool m_finished = false;
+};
+
+using StreamStage = std::function<void(StreamFrame&)>;
+
+/**
+ * @brief Queue statistics of one connection of a running StreamPipeline.
+ */
+struct EdgeQueueMetrics
+{
+    ConnectionId connection = invalidGraphId;
+    qint64 fromNode = -1;
+    QString fromPort;
+    qint64 toNode = -1;
+    QString toPort;
+    int capacity = 0;
+    int depth = 0;        ///< Frames queued right now.
+    int maxDepth = 0;     ///< Highest depth seen.
+    quint64 frames = 0;   ///< Frames that went through.
+    qint64 blockedNs = 0; ///< Time the producer waited on a full queue.
+};
+
+/**
+ * @brief Pushes a stream of frames through a graph with every node running concurrently.
+ *
+ * Every node with a stage runs on its own thread and every connection gets
+ * a bounded single-producer single-consumer queue, so a stage works on
+ * frame N + 1 while its consumers handle frame N and the throughput
+ * approaches that of the slowest stage. A producer that gets ahead waits on
+ * the full queue (backpressure), so memory stays bounded by the queue
+ * capacity. Payloads fanned out to several consumers are shared, not copied.
+ *
+ * Stages without connected inputs are sources: they are invoked until they
+ * call StreamFrame::finish() or the pipeline is stopped. A stage ends once
+ * one of its inputs is closed and drained, and then closes its outputs, so
+ * the end of the stream propagates downstream. A stage that stops, because
+ * an input ended or its function threw, also abandons its inputs, and a
+ * producer stops once every consumer has abandoned it, so the end
+ * propagates upstream as well.
+ *
+ * The topology is taken from the snapshot given at construction; editing
+ * the graph does not affect a running pipeline.
+ */
+class StreamPipeline
+{
+public:
+    /**
+     * @brief Prepare a pipeline over the connections of @p snapshot.
+     * @param queueCapacity Frames each connection buffers before its producer waits.
+     */
+    explicit StreamPipeline(std::shared_ptr<const GraphSnapshot> snapshot, int queueCapacity = 4);
+    ~StreamPipeline();
+    StreamPipeline(const StreamPipeline&) = delete;
+    StreamPipeline& operator=(const StreamPipeline&) = delete;
+
+    /**
+     * @brief Run @p stage for node @p uid.
+     * @return False if the node is not in the snapshot or the pipeline was started.
+     */
+    bool setStage(qint64 uid, StreamStage stage);
+
+    /**
+     * @brief Run @p stage for the node named @p nodeName.
+     */
+    bool setStage(const QString& nodeName, StreamStage stage);
+
+    /**
+     * @brief Record every stage invocation, with its queue wait, into @p profiler.
+     */
+    void setProfiler(std::shared_ptr<NodeProfiler> profiler);
+
+    /**
+     * @brief Start every stage.
+     * @return False, with a warning, if a connected node has no stage or the graph has a cycle.
+     */
+    bool start();
+
+    /**
+     * @brief Stop every stage, dropping queued frames, and wait for them.
+     */
+    void stop();
+
+    /**
+     * @brief Wait until the stream has ended on its own.
+     */
+    void waitForFinished();
+
+    bool isRunning() const;
+
+    /**
+     * @brief Number of frames stage @p uid has processed.
+     */
+    quint64 frames(qint64 uid) const;
+
+    QVector<EdgeQueueMetrics> edgeMetrics() const;
+
+private:
+    struct Edge;
+    struct Stage;
+
+    void run(Stage& stage);
+    bool push(Edge& edge, Payload payload);
+    bool pop(Edge& edge, Payload& payload);
+    bool hasCycle() const;
+
+    std::shared_ptr<const GraphSnapshot> m_snapshot;
+    std::shared_ptr<NodeProfiler> m_profiler;
+    std::vector<std::unique_ptr<Edge>> m_edges;
+    std::vector<std::unique_ptr<Stage>> m_stages;
+    QHash<qint64, Stage*> m_stageByUid;
+    int m_queueCapacity;
+    bool m_started = false;
+    std::atomic<bool> m_stopping{false};
+};
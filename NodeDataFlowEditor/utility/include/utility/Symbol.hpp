@@ -0,0 +1,86 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QString>
+
+/**
+ * @brief Interned identifier for node and port names.
+ *
+ * Every distinct string is stored once in a process-wide table and a Symbol is
+ * just its index, so equality is an integer comparison. Symbols convert
+ * implicitly from QString so existing name-based call sites keep compiling;
+ * hot paths should keep the Symbol instead of re-interning.
+ *
+ * Interning is thread-safe. Each entry counts the Symbols referring to it and
+ * is released, its index reused, when the last one goes away: renamed nodes,
+ * forwarded "<module>_<port>" keys and recycled node names would otherwise
+ * keep the table growing for the whole session. Copying a Symbol costs one
+ * relaxed atomic increment.
+ */
+class Symbol
+{
+public:
+    Symbol() = default;
+
+    /**
+     * @brief Interns @p text (the empty string maps to the null symbol).
+     */
+    Symbol(const QString& text); // NOLINT(google-explicit-constructor)
+    Symbol(const char* text);    // NOLINT(google-explicit-constructor)
+
+    Symbol(const Symbol& other) noexcept;
+    Symbol(Symbol&& other) noexcept;
+    Symbol& operator=(const Symbol& other) noexcept;
+    Symbol& operator=(Symbol&& other) noexcept;
+    ~Symbol();
+
+    /**
+     * @brief Returns the interned text; shares storage with the table.
+     */
+    QString toString() const;
+
+    quint32 id() const { return m_id; }
+    bool isEmpty() const { return m_id == 0; }
+
+    /**
+     * @brief Number of distinct strings currently interned.
+     */
+    static int internedCount();
+
+    friend bool operator==(const Symbol& a, const Symbol& b) { return a.m_id == b.m_id; }
+    friend bool operator!=(const Symbol& a, const Symbol& b) { return a.m_id != b.m_id; }
+    friend bool operator<(const Symbol& a, const Symbol& b) { return a.m_id < b.m_id; }
+
+private:
+    quint32 m_id = 0; ///< Index in the symbol table, 0 for the empty string.
+};
+
+inline size_t
+qHash(const Symbol& symbol, size_t seed = 0) noexcept
+{
+    return qHash(symbol.id(), seed);
+}
@@ -51,18 +51,22 @@
 #include <QTimeEdit>
 #include <QToolButton>
 #include <QTreeWidget>
+#include <QVector>
 #include <QWidget>
 
 class GroupItem;
 class PortLabel;
+struct ForwardRule;
 class NodeItem;
 class GraphRegistry;
 
 /**
  * @brief Visitor for cloning and synchronizing QWidget-based parameters.
  *
- * WidgetVisitor traverses a QWidget, clones it, and binds the cloned widget
- * to a group parameter so that all linked PortLabel widgets stay synchronized.
+ * WidgetVisitor traverses a QWidget, clones it, and binds each cloned editor
+ * to the same ParameterKey as the editor it was cloned from, through the
+ * registry's ParameterBinder, so that edits on either side reach only the
+ * widgets bound to that one value and never their siblings in a container.
  */
 struct WidgetVisitor
 {
@@ -74,6 +78,27 @@ struct WidgetVisitor
 
     void visit(QWidget* w);
 
+    /**
+     * @brief Clone @p w and bind both widgets to the port, without adding anything to the group.
+     * @return The clone, owned by the caller, or nullptr if @p w is not an editor widget.
+     */
+    QWidget* clone(QWidget* w);
+
+    /**
+     * @brief Whether visiting @p w yields exactly one group widget, a clone of @p w itself.
+     *
+     * True for editor widgets; false for containers and unknown widgets, which
+     * are mirrored through their children.
+     */
+    static bool isEditor(const QWidget* w);
+
+    /**
+     * @brief Append the forwarding of every group widget to @p forwards instead of registering it.
+     *
+     * Lets the group register all its forwards with one GraphRegistry::registerForwardPorts() call.
+     */
+    void collectForwards(QVector<ForwardRule>& forwards);
+
 private:
     // Input widgets
     void visitLineEdit(QLineEdit* w);
@@ -109,8 +134,12 @@ private:
     void visitUnknown(QWidget* w);
 
     // Utility
+    void bindToStore(QWidget* original, QWidget* clone);
     void addGroupWidget(QWidget* w);
 
 private:
     std::shared_ptr<GraphRegistry> m_registry;
+    bool m_capture = false;                     ///< clone() is running; keep the clone instead of adding it.
+    QWidget* m_clone = nullptr;                 ///< Clone kept by clone().
+    QVector<ForwardRule>* m_forwards = nullptr; ///< Set by collectForwards(); null registers each forward.
 };
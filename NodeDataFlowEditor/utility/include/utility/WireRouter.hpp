@@ -0,0 +1,82 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QVector>
+
+/**
+ * @brief Orthogonal, obstacle-avoiding router for connection wires.
+ *
+ * Holds a set of obstacle rectangles (node bounding rects, inflated by a
+ * clearance margin) in a uniform-grid spatial index. route() builds a sparse
+ * orthogonal visibility graph from the obstacle edges that lie around the two
+ * endpoints and searches it with A*, penalizing bends.
+ *
+ * Immutable after construction, so one router can serve any number of
+ * threads; GraphScene builds one per routing batch on its worker thread.
+ */
+class WireRouter
+{
+public:
+    /**
+     * @brief Index @p obstacles, inflated by @p margin on every side.
+     */
+    explicit WireRouter(const QVector<QRectF>& obstacles, qreal margin = 12.0);
+
+    /**
+     * @brief Route a wire leaving @p source to the right and entering @p target from the left.
+     * @return Polyline from @p source to @p target, or an empty polygon when no route was found.
+     *
+     * Obstacles containing an endpoint (the nodes owning the two ports) are ignored.
+     */
+    QPolygonF route(const QPointF& source, const QPointF& target) const;
+
+    /**
+     * @brief Area whose obstacles can affect route(@p source, @p target) on a router with clearance @p margin.
+     *
+     * Obstacles not intersecting it may be left out of the router without changing that route.
+     */
+    static QRectF reach(const QPointF& source, const QPointF& target, qreal margin = 12.0);
+
+    /**
+     * @brief Number of obstacles in the index.
+     */
+    int obstacleCount() const { return m_obstacles.size(); }
+
+private:
+    /// Indices of obstacles whose cells overlap @p area.
+    QVector<int> obstaclesIn(const QRectF& area) const;
+
+    /// Whether the axis-aligned segment @p a → @p b crosses an obstacle interior, @p ignored aside.
+    bool blocked(const QPointF& a, const QPointF& b, const QVector<int>& ignored) const;
+
+    QVector<QRectF> m_obstacles;          ///< Inflated obstacle rects.
+    QHash<quint64, QVector<int>> m_cells; ///< Spatial index: grid cell → obstacle indices.
+    qreal m_margin;                       ///< Clearance kept around obstacles.
+};
@@ -0,0 +1,350 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/AsyncKernel.hpp"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QThread>
+
+namespace
+{
+    // Promise of the kernel the worker is resuming right now.
+    thread_local KernelTask::promise_type* currentKernel = nullptr;
+
+    class CurrentKernel
+    {
+    public:
+        explicit CurrentKernel(KernelTask::promise_type& promise)
+            : m_previous(std::exchange(currentKernel, &promise))
+        {}
+        ~CurrentKernel() { currentKernel = m_previous; }
+
+    private:
+        KernelTask::promise_type* m_previous;
+    };
+}
+
+// ================================
+// KernelTask
+// ================================
+
+KernelTask
+KernelTask::promise_type::get_return_object()
+{
+    return KernelTask(Handle::from_promise(*this));
+}
+
+void
+KernelTask::promise_type::Final::await_suspend(std::coroutine_handle<promise_type> h) noexcept
+{
+    h.promise().executor->finished(h);
+}
+
+KernelTask&
+KernelTask::operator=(KernelTask&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_handle)
+            m_handle.destroy();
+        m_handle = std::exchange(other.m_handle, {});
+    }
+    return *this;
+}
+
+KernelTask::~KernelTask()
+{
+    if (m_handle)
+        m_handle.destroy();
+}
+
+// ================================
+// AsyncExecutor
+// ================================
+
+void
+AsyncExecutor::Mailbox::post(std::function<void(AsyncExecutor&)> job)
+{
+    QMutexLocker lock(&mutex);
+    jobs.push_back(std::move(job));
+    wakeUp.wakeOne();
+}
+
+AsyncExecutor::AsyncExecutor()
+    : m_mailbox(std::make_shared<Mailbox>())
+    , m_thread(QThread::create([this] { loop(); }))
+{
+    m_thread->start();
+}
+
+AsyncExecutor::~AsyncExecutor()
+{
+    {
+        QMutexLocker lock(&m_mailbox->mutex);
+        m_mailbox->quit = true;
+        m_mailbox->wakeUp.wakeOne();
+    }
+    m_thread->wait();
+}
+
+void
+AsyncExecutor::setCompletionHandler(Completion completion)
+{
+    m_mailbox->post([completion = std::move(completion)](AsyncExecutor& executor) {
+        executor.m_completion = completion;
+    });
+}
+
+void
+AsyncExecutor::submit(qint64 uid, Kernel kernel, QHash<QString, Payload> inputs)
+{
+    {
+        QMutexLocker lock(&m_mailbox->mutex);
+        ++m_mailbox->pending;
+    }
+    m_mailbox->post([uid, kernel = std::move(kernel), inputs = std::move(inputs)](AsyncExecutor& executor) mutable {
+        executor.start(uid, std::move(kernel), std::move(inputs));
+    });
+}
+
+void
+AsyncExecutor::cancel(qint64 uid)
+{
+    m_mailbox->post([uid](AsyncExecutor& executor) { executor.cancelRun(uid); });
+}
+
+bool
+AsyncExecutor::waitForIdle(int timeoutMs)
+{
+    QElapsedTimer elapsed;
+    elapsed.start();
+    QMutexLocker lock(&m_mailbox->mutex);
+    while (m_mailbox->pending > 0)
+    {
+        if (timeoutMs < 0)
+        {
+            m_mailbox->idle.wait(&m_mailbox->mutex);
+            continue;
+        }
+        const qint64 left = timeoutMs - elapsed.elapsed();
+        if (left <= 0 || !m_mailbox->idle.wait(&m_mailbox->mutex, static_cast<unsigned long>(left)))
+            return m_mailbox->pending == 0;
+    }
+    return true;
+}
+
+int
+AsyncExecutor::inFlight() const
+{
+    QMutexLocker lock(&m_mailbox->mutex);
+    return m_mailbox->pending;
+}
+
+quint64
+AsyncExecutor::completedRuns() const
+{
+    return m_completed;
+}
+
+quint64
+AsyncExecutor::cancelledRuns() const
+{
+    return m_cancelled;
+}
+
+quint64
+AsyncExecutor::failedRuns() const
+{
+    return m_failed;
+}
+
+void
+AsyncExecutor::loop()
+{
+    std::vector<std::function<void(AsyncExecutor&)>> jobs;
+    for (;;)
+    {
+        {
+            QMutexLocker lock(&m_mailbox->mutex);
+            while (m_mailbox->jobs.empty() && !m_mailbox->quit &&
+                   (m_timers.empty() || m_timers.begin()->first > Clock::now()))
+            {
+                if (m_timers.empty())
+                {
+                    m_mailbox->wakeUp.wait(&m_mailbox->mutex);
+                    continue;
+                }
+                const auto left =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(m_timers.begin()->first - Clock::now());
+                m_mailbox->wakeUp.wait(&m_mailbox->mutex, static_cast<unsigned long>(std::max<qint64>(left.count(), 1)));
+            }
+            if (m_mailbox->quit)
+                break;
+            std::swap(jobs, m_mailbox->jobs);
+        }
+
+        for (auto& job : jobs)
+            job(*this);
+        jobs.clear();
+
+        const auto now = Clock::now();
+        while (!m_timers.empty() && m_timers.begin()->first <= now)
+        {
+            const auto [task, suspension] = m_timers.begin()->second;
+            m_timers.erase(m_timers.begin());
+            resume(task, suspension);
+        }
+    }
+
+    // Unwind every suspended kernel so its frame is freed.
+    const QList<qint64> nodes = m_runOfNode.keys();
+    for (qint64 uid : nodes)
+        cancelRun(uid);
+
+    // Kernels that swallowed the cancellation and suspended again.
+    for (const Run& run : std::as_const(m_runs))
+        run.handle.destroy();
+    m_runs.clear();
+}
+
+void
+AsyncExecutor::start(qint64 uid, Kernel kernel, QHash<QString, Payload> inputs)
+{
+    cancelRun(uid);
+
+    KernelContext context;
+    context.uid = uid;
+    context.inputs = std::move(inputs);
+    auto callable = std::make_shared<const Kernel>(std::move(kernel));
+    KernelTask::Handle handle = (*callable)(std::move(context)).release();
+    if (!handle)
+    {
+        qWarning() << "AsyncExecutor: kernel of node" << uid << "returned no coroutine";
+        QMutexLocker lock(&m_mailbox->mutex);
+        if (--m_mailbox->pending == 0)
+            m_mailbox->idle.wakeAll();
+        return;
+    }
+
+    const quint64 task = m_nextTask++;
+    handle.promise().executor = this;
+    handle.promise().task = task;
+    m_runs.insert(task, {uid, handle, std::move(callable)});
+    m_runOfNode.insert(uid, task);
+    resume(task, 0);
+}
+
+void
+AsyncExecutor::cancelRun(qint64 uid)
+{
+    const auto it = m_runOfNode.constFind(uid);
+    if (it == m_runOfNode.constEnd())
+        return;
+    const quint64 task = it.value();
+    const auto run = m_runs.constFind(task);
+    if (run == m_runs.constEnd())
+        return;
+
+    // The pending co_await throws KernelCancelled; its timer or value wake-up goes stale.
+    KernelTask::promise_type& promise = run->handle.promise();
+    promise.cancelled = true;
+    resume(task, promise.suspension);
+}
+
+void
+AsyncExecutor::resume(quint64 task, quint64 suspension)
+{
+    const auto it = m_runs.constFind(task);
+    if (it == m_runs.constEnd())
+        return;
+    KernelTask::Handle handle = it->handle;
+    if (handle.promise().suspension != suspension)
+        return;
+
+    ++handle.promise().suspension;
+    CurrentKernel current(handle.promise());
+    handle.resume();
+}
+
+void
+AsyncExecutor::finished(KernelTask::Handle handle)
+{
+    KernelTask::promise_type& promise = handle.promise();
+    const Run run = m_runs.take(promise.task);
+    if (m_runOfNode.value(run.uid) == promise.task)
+        m_runOfNode.remove(run.uid);
+
+    bool cancelled = promise.cancelled;
+    if (promise.error)
+    {
+        try
+        {
+            std::rethrow_exception(promise.error);
+        }
+        catch (const KernelCancelled&)
+        {
+            cancelled = true;
+        }
+        catch (const std::exception& e)
+        {
+            qWarning() << "AsyncExecutor: kernel of node" << run.uid << "failed:" << e.what();
+            ++m_failed;
+        }
+        catch (...)
+        {
+            qWarning() << "AsyncExecutor: kernel of node" << run.uid << "failed";
+            ++m_failed;
+        }
+    }
+    else if (!cancelled)
+    {
+        ++m_completed;
+        if (m_completion)
+            m_completion(run.uid, promise.outputs);
+    }
+    if (cancelled)
+        ++m_cancelled;
+
+    // Final suspension point: the frame can go.
+    handle.destroy();
+
+    QMutexLocker lock(&m_mailbox->mutex);
+    if (--m_mailbox->pending == 0)
+        m_mailbox->idle.wakeAll();
+}
+
+void
+AsyncExecutor::wakeAt(KernelTask::Handle handle, Clock::time_point when)
+{
+    m_timers.emplace(when, std::make_pair(handle.promise().task, handle.promise().suspension));
+}
+
+void
+AsyncExecutor::throwIfCancelled()
+{
+    if (currentKernel && currentKernel->cancelled)
+        throw KernelCancelled{};
+}
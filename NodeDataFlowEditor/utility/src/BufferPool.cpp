@@ -0,0 +1,173 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/BufferPool.hpp"
+
+#include <QMutexLocker>
+#include <cstring>
+#include <utility>
+
+// ================================
+// PooledBuffer
+// ================================
+
+PooledBuffer::PooledBuffer(std::shared_ptr<BufferPool> pool, std::byte* data, std::size_t size, std::size_t capacity)
+    : m_pool(std::move(pool))
+    , m_data(data)
+    , m_size(size)
+    , m_capacity(capacity)
+{}
+
+PooledBuffer::~PooledBuffer()
+{
+    if (m_data)
+        m_pool->release(m_data, m_capacity);
+}
+
+PooledBuffer::PooledBuffer(const PooledBuffer& other)
+{
+    if (other.isNull())
+        return;
+    *this = other.m_pool->acquire(other.m_size);
+    std::memcpy(m_data, other.m_data, m_size);
+}
+
+PooledBuffer::PooledBuffer(PooledBuffer&& other) noexcept
+    : m_pool(std::move(other.m_pool))
+    , m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+    , m_capacity(std::exchange(other.m_capacity, 0))
+{}
+
+PooledBuffer&
+PooledBuffer::operator=(PooledBuffer other) noexcept
+{
+    std::swap(m_pool, other.m_pool);
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+    return *this;
+}
+
+// ================================
+// BufferPool
+// ================================
+
+std::shared_ptr<BufferPool>
+BufferPool::create(std::size_t maxCachedBytes)
+{
+    return std::make_shared<BufferPool>(Token{}, maxCachedBytes);
+}
+
+BufferPool::BufferPool(Token, std::size_t maxCachedBytes)
+    : m_free(bucketCount)
+    , m_maxCachedBytes(maxCachedBytes)
+{}
+
+BufferPool::~BufferPool()
+{
+    trim();
+}
+
+PooledBuffer
+BufferPool::acquire(std::size_t size)
+{
+    int bucket = minBucket;
+    while (bucket < bucketCount - 1 && (std::size_t(1) << bucket) < size)
+        ++bucket;
+    const std::size_t capacity = std::size_t(1) << bucket;
+
+    std::byte* data = nullptr;
+    {
+        QMutexLocker lock(&m_mutex);
+        QVector<std::byte*>& free = m_free[bucket];
+        if (!free.isEmpty())
+        {
+            data = free.takeLast();
+            m_cachedBytes -= capacity;
+            ++m_hits;
+        }
+        else
+        {
+            ++m_misses;
+        }
+    }
+    if (!data)
+        data = new std::byte[capacity];
+    return PooledBuffer(shared_from_this(), data, size, capacity);
+}
+
+void
+BufferPool::release(std::byte* data, std::size_t capacity)
+{
+    int bucket = minBucket;
+    while ((std::size_t(1) << bucket) < capacity)
+        ++bucket;
+
+    {
+        QMutexLocker lock(&m_mutex);
+        if (m_cachedBytes + capacity <= m_maxCachedBytes)
+        {
+            m_free[bucket].append(data);
+            m_cachedBytes += capacity;
+            return;
+        }
+    }
+    delete[] data;
+}
+
+void
+BufferPool::trim()
+{
+    QVector<QVector<std::byte*>> free(bucketCount);
+    {
+        QMutexLocker lock(&m_mutex);
+        std::swap(free, m_free);
+        m_cachedBytes = 0;
+    }
+    for (const QVector<std::byte*>& bucket : free)
+        for (std::byte* data : bucket)
+            delete[] data;
+}
+
+std::size_t
+BufferPool::cachedBytes() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_cachedBytes;
+}
+
+std::size_t
+BufferPool::hits() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_hits;
+}
+
+std::size_t
+BufferPool::misses() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_misses;
+}
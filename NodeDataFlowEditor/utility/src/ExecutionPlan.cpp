@@ -0,0 +1,235 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/ExecutionPlan.hpp"
+
+#include <QDebug>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+namespace
+{
+    enum class SlotKind : quint8
+    {
+        Input,
+        Output,
+        Parameter
+    };
+
+    /// Where a node port lives before nodes are reordered.
+    struct PortRef
+    {
+        int node = -1;  ///< Index in the uid-sorted source nodes.
+        int local = -1; ///< Index among the node's ports of that kind.
+        SlotKind kind = SlotKind::Input;
+    };
+
+    struct RawEdge
+    {
+        int from;
+        int to;
+        int output;
+        int input;
+        bool toParameter;
+        ConnectionId connection;
+    };
+
+    // Group ports can forward to ports of nested groups; deeper chains are malformed.
+    constexpr int maxForwardDepth = 16;
+
+    void
+    resolve(PortId port,
+            const QHash<PortId, PortRef>& ports,
+            const QHash<PortId, QVector<PortId>>& forwards,
+            QVector<PortRef>& out,
+            int depth = 0)
+    {
+        const auto it = ports.constFind(port);
+        if (it != ports.constEnd())
+        {
+            out.push_back(it.value());
+            return;
+        }
+        if (depth == maxForwardDepth)
+        {
+            qWarning() << "ExecutionPlan: forwarding chain of port" << port << "too deep";
+            return;
+        }
+        for (PortId actual : forwards.value(port))
+            resolve(actual, ports, forwards, out, depth + 1);
+    }
+}
+
+std::shared_ptr<const ExecutionPlan>
+ExecutionPlan::compile(const Source& source, quint64 topologyRevision)
+{
+    auto plan = std::make_shared<ExecutionPlan>();
+    plan->m_topologyRevision = topologyRevision;
+
+    const int nodeCount = source.nodes.size();
+    QVector<int> byUid(nodeCount);
+    std::iota(byUid.begin(), byUid.end(), 0);
+    std::sort(byUid.begin(), byUid.end(),
+              [&](int a, int b) { return source.nodes[a].uid < source.nodes[b].uid; });
+
+    // Node ports by id; indices below are positions in byUid.
+    QHash<PortId, PortRef> ports;
+    int portCount = 0;
+    for (const Source::Node& node : source.nodes)
+        portCount += node.inputs.size() + node.outputs.size() + node.parameters.size();
+    ports.reserve(portCount);
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        const Source::Node& node = source.nodes[byUid[i]];
+        for (int p = 0; p < node.inputs.size(); ++p)
+            ports.insert(node.inputs[p], {i, p, SlotKind::Input});
+        for (int p = 0; p < node.outputs.size(); ++p)
+            ports.insert(node.outputs[p], {i, p, SlotKind::Output});
+        for (int p = 0; p < node.parameters.size(); ++p)
+            ports.insert(node.parameters[p], {i, p, SlotKind::Parameter});
+    }
+
+    // Flatten group ports: one edge per pair of actual ports.
+    QVector<RawEdge> raw;
+    raw.reserve(source.connections.size());
+    QVector<PortRef> outputs;
+    QVector<PortRef> inputs;
+    for (const Source::Connection& c : source.connections)
+    {
+        outputs.clear();
+        inputs.clear();
+        resolve(c.output, ports, source.forwards, outputs);
+        resolve(c.input, ports, source.forwards, inputs);
+        for (const PortRef& out : std::as_const(outputs))
+        {
+            if (out.kind != SlotKind::Output)
+                continue;
+            for (const PortRef& in : std::as_const(inputs))
+            {
+                if (in.kind == SlotKind::Output)
+                    continue;
+                raw.push_back({out.node, in.node, out.local, in.local, in.kind == SlotKind::Parameter, c.id});
+            }
+        }
+    }
+
+    // Kahn's algorithm over a CSR adjacency; among ready nodes the smallest uid goes first.
+    QVector<int> adjacencyStart(nodeCount + 1, 0);
+    QVector<int> indegree(nodeCount, 0);
+    for (const RawEdge& e : std::as_const(raw))
+    {
+        ++adjacencyStart[e.from + 1];
+        ++indegree[e.to];
+    }
+    std::partial_sum(adjacencyStart.begin(), adjacencyStart.end(), adjacencyStart.begin());
+    QVector<int> adjacency(raw.size());
+    {
+        QVector<int> fill = adjacencyStart;
+        for (int e = 0; e < raw.size(); ++e)
+            adjacency[fill[raw[e].from]++] = e;
+    }
+
+    // Indices follow uid order, so a min-heap of indices hands out the smallest ready uid.
+    QVector<int> order;
+    order.reserve(nodeCount);
+    std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+    for (int i = 0; i < nodeCount; ++i)
+        if (indegree[i] == 0)
+            ready.push(i);
+    while (!ready.empty())
+    {
+        const int n = ready.top();
+        ready.pop();
+        order.push_back(n);
+        for (int a = adjacencyStart[n]; a < adjacencyStart[n + 1]; ++a)
+            if (--indegree[raw[adjacency[a]].to] == 0)
+                ready.push(raw[adjacency[a]].to);
+    }
+    plan->m_acyclic = order.size() == nodeCount;
+    if (!plan->m_acyclic)
+        for (int i = 0; i < nodeCount; ++i)
+            if (indegree[i] > 0)
+                order.push_back(i);
+
+    // Lay out nodes and their slot ranges in execution order.
+    QVector<int> position(nodeCount);
+    plan->m_nodes.resize(nodeCount);
+    plan->m_indexOfUid.reserve(nodeCount);
+    plan->m_inputPorts.reserve(portCount);
+    plan->m_outputPorts.reserve(portCount);
+    plan->m_parameterPorts.reserve(portCount);
+    for (int index = 0; index < nodeCount; ++index)
+    {
+        const int i = order[index];
+        const Source::Node& node = source.nodes[byUid[i]];
+        position[i] = index;
+
+        Node& planned = plan->m_nodes[index];
+        planned.uid = node.uid;
+        planned.firstInput = plan->m_inputPorts.size();
+        planned.inputCount = node.inputs.size();
+        planned.firstOutput = plan->m_outputPorts.size();
+        planned.outputCount = node.outputs.size();
+        planned.firstParameter = plan->m_parameterPorts.size();
+        planned.parameterCount = node.parameters.size();
+        planned.firstEdge = adjacencyStart[i];
+        planned.edgeCount = adjacencyStart[i + 1] - adjacencyStart[i];
+
+        plan->m_inputPorts += node.inputs;
+        plan->m_outputPorts += node.outputs;
+        for (PortId port : node.parameters)
+        {
+            plan->m_parameterSlots.insert(port, plan->m_parameterPorts.size());
+            plan->m_parameterPorts.push_back(port);
+        }
+        plan->m_indexOfUid.insert(node.uid, index);
+    }
+
+    // Edges grouped by source in execution order.
+    plan->m_edges.reserve(raw.size());
+    for (int index = 0; index < nodeCount; ++index)
+    {
+        Node& planned = plan->m_nodes[index];
+        const int first = planned.firstEdge;
+        const int last = first + planned.edgeCount;
+        planned.firstEdge = plan->m_edges.size();
+        for (int a = first; a < last; ++a)
+        {
+            const RawEdge& e = raw[adjacency[a]];
+            const Node& target = plan->m_nodes[position[e.to]];
+            Edge edge;
+            edge.from = index;
+            edge.to = position[e.to];
+            edge.output = planned.firstOutput + e.output;
+            edge.input = (e.toParameter ? target.firstParameter : target.firstInput) + e.input;
+            edge.toParameter = e.toParameter;
+            edge.connection = e.connection;
+            plan->m_edges.push_back(edge);
+        }
+    }
+    return plan;
+}
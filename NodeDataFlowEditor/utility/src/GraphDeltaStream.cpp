@@ -0,0 +1,601 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/GraphDeltaStream.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QLocalSocket>
+#include <QtEndian>
+#include <array>
+
+namespace
+{
+    // Past this much unsent data frames are skipped; the next one covers them.
+    constexpr qint64 maxBufferedBytes = 8 * 1024 * 1024;
+    constexpr int defaultFrameMs = 16;
+    constexpr int sizePrefix = sizeof(quint32);
+
+    // Order in which the events of a frame are emitted, so it can be applied front to back.
+    enum Phase
+    {
+        RemovedConnections,
+        RemovedNodesAndPorts,
+        AddedNodesAndPorts,
+        AddedConnections,
+        Updates,
+        PhaseCount
+    };
+    using Phases = std::array<QVector<GraphDelta>, PhaseCount>;
+
+    template <typename Fn>
+    void
+    forEachPort(const NodeRecord& record, Fn&& fn)
+    {
+        for (const PortRecord& port : record.inputs)
+            fn(port);
+        for (const PortRecord& port : record.parameters)
+            fn(port);
+        for (const PortRecord& port : record.outputs)
+            fn(port);
+    }
+
+    const PortRecord*
+    findPort(const NodeRecord& record, PortId id)
+    {
+        const PortRecord* found = nullptr;
+        forEachPort(record, [&found, id](const PortRecord& port) {
+            if (port.id == id)
+                found = &port;
+        });
+        return found;
+    }
+
+    /// Whether @p edge joins two nodes; the runtime knows nothing of group ports.
+    bool
+    isStreamed(const EdgeRecord& edge)
+    {
+        return edge.toGroup < 0;
+    }
+
+    const EdgeRecord*
+    findEdge(const NodeRecord& record, ConnectionId id)
+    {
+        for (const EdgeRecord& edge : record.outgoing)
+            if (edge.id == id && isStreamed(edge))
+                return &edge;
+        return nullptr;
+    }
+
+    GraphDelta
+    portAdded(qint64 node, const PortRecord& port)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::PortAdded;
+        d.node = node;
+        d.port = port.id;
+        d.portKind = static_cast<quint8>(port.kind);
+        d.name = port.name;
+        return d;
+    }
+
+    GraphDelta
+    parameterChanged(qint64 node, const PortRecord& port)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::ParameterChanged;
+        d.node = node;
+        d.port = port.id;
+        d.value = port.value;
+        return d;
+    }
+
+    GraphDelta
+    connectionAdded(const EdgeRecord& edge)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::ConnectionAdded;
+        d.connection = edge.id;
+        d.node = edge.fromNode;
+        d.port = edge.fromPortId;
+        d.toNode = edge.toNode;
+        d.toPort = edge.toPortId;
+        return d;
+    }
+
+    GraphDelta
+    connectionRemoved(const EdgeRecord& edge)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::ConnectionRemoved;
+        d.connection = edge.id;
+        return d;
+    }
+
+    GraphDelta
+    activation(const EdgeRecord& edge)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::ConnectionActivation;
+        d.connection = edge.id;
+        d.active = edge.active;
+        return d;
+    }
+
+    GraphDelta
+    activation(const NodeRecord& record)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::NodeActivation;
+        d.node = record.uid;
+        d.active = record.active;
+        return d;
+    }
+
+    void
+    addNode(const NodeRecord& record, Phases& out)
+    {
+        GraphDelta d;
+        d.type = GraphDelta::Type::NodeAdded;
+        d.node = record.uid;
+        d.name = record.name;
+        out[AddedNodesAndPorts].append(d);
+
+        forEachPort(record, [&out, &record](const PortRecord& port) {
+            out[AddedNodesAndPorts].append(portAdded(record.uid, port));
+            if (port.kind == PortRecord::Kind::Parameter && port.value.isValid())
+                out[Updates].append(parameterChanged(record.uid, port));
+        });
+        for (const EdgeRecord& edge : record.outgoing)
+        {
+            if (!isStreamed(edge))
+                continue;
+            out[AddedConnections].append(connectionAdded(edge));
+            if (edge.active)
+                out[Updates].append(activation(edge));
+        }
+        if (record.active)
+            out[Updates].append(activation(record));
+    }
+
+    void
+    removeNode(const NodeRecord& record, Phases& out)
+    {
+        for (const EdgeRecord& edge : record.outgoing)
+            if (isStreamed(edge))
+                out[RemovedConnections].append(connectionRemoved(edge));
+
+        // Removing a node removes its ports.
+        GraphDelta d;
+        d.type = GraphDelta::Type::NodeRemoved;
+        d.node = record.uid;
+        out[RemovedNodesAndPorts].append(d);
+    }
+
+    void
+    changeNode(const NodeRecord& before, const NodeRecord& after, Phases& out)
+    {
+        forEachPort(before, [&out, &after](const PortRecord& port) {
+            if (findPort(after, port.id))
+                return;
+            GraphDelta d;
+            d.type = GraphDelta::Type::PortRemoved;
+            d.node = after.uid;
+            d.port = port.id;
+            out[RemovedNodesAndPorts].append(d);
+        });
+        forEachPort(after, [&out, &before, &after](const PortRecord& port) {
+            const PortRecord* old = findPort(before, port.id);
+            if (!old)
+                out[AddedNodesAndPorts].append(portAdded(after.uid, port));
+            if (port.kind == PortRecord::Kind::Parameter && (old ? old->value != port.value : port.value.isValid()))
+                out[Updates].append(parameterChanged(after.uid, port));
+        });
+
+        for (const EdgeRecord& edge : before.outgoing)
+            if (isStreamed(edge) && !findEdge(after, edge.id))
+                out[RemovedConnections].append(connectionRemoved(edge));
+        for (const EdgeRecord& edge : after.outgoing)
+        {
+            if (!isStreamed(edge))
+                continue;
+            const EdgeRecord* old = findEdge(before, edge.id);
+            if (!old)
+                out[AddedConnections].append(connectionAdded(edge));
+            if (old ? old->active != edge.active : edge.active)
+                out[Updates].append(activation(edge));
+        }
+
+        if (before.active != after.active)
+            out[Updates].append(activation(after));
+    }
+
+    void
+    write(QDataStream& s, const GraphDelta& d)
+    {
+        s << static_cast<quint8>(d.type);
+        switch (d.type)
+        {
+            case GraphDelta::Type::NodeAdded:
+                s << d.node << d.name;
+                break;
+            case GraphDelta::Type::NodeRemoved:
+                s << d.node;
+                break;
+            case GraphDelta::Type::PortAdded:
+                s << d.node << d.port << d.portKind << d.name;
+                break;
+            case GraphDelta::Type::PortRemoved:
+                s << d.node << d.port;
+                break;
+            case GraphDelta::Type::ConnectionAdded:
+                s << d.connection << d.node << d.port << d.toNode << d.toPort;
+                break;
+            case GraphDelta::Type::ConnectionRemoved:
+                s << d.connection;
+                break;
+            case GraphDelta::Type::ParameterChanged:
+                s << d.node << d.port << d.value;
+                break;
+            case GraphDelta::Type::NodeActivation:
+                s << d.node << d.active;
+                break;
+            case GraphDelta::Type::ConnectionActivation:
+                s << d.connection << d.active;
+                break;
+        }
+    }
+
+    bool
+    read(QDataStream& s, GraphDelta& d)
+    {
+        quint8 type = 0;
+        s >> type;
+        d.type = static_cast<GraphDelta::Type>(type);
+        switch (d.type)
+        {
+            case GraphDelta::Type::NodeAdded:
+                s >> d.node >> d.name;
+                break;
+            case GraphDelta::Type::NodeRemoved:
+                s >> d.node;
+                break;
+            case GraphDelta::Type::PortAdded:
+                s >> d.node >> d.port >> d.portKind >> d.name;
+                break;
+            case GraphDelta::Type::PortRemoved:
+                s >> d.node >> d.port;
+                break;
+            case GraphDelta::Type::ConnectionAdded:
+                s >> d.connection >> d.node >> d.port >> d.toNode >> d.toPort;
+                break;
+            case GraphDelta::Type::ConnectionRemoved:
+                s >> d.connection;
+                break;
+            case GraphDelta::Type::ParameterChanged:
+                s >> d.node >> d.port >> d.value;
+                break;
+            case GraphDelta::Type::NodeActivation:
+                s >> d.node >> d.active;
+                break;
+            case GraphDelta::Type::ConnectionActivation:
+                s >> d.connection >> d.active;
+                break;
+            default:
+                return false;
+        }
+        return s.status() == QDataStream::Ok;
+    }
+}
+
+bool
+GraphDelta::operator==(const GraphDelta& other) const
+{
+    return type == other.type && node == other.node && port == other.port && toNode == other.toNode &&
+           toPort == other.toPort && connection == other.connection && portKind == other.portKind &&
+           active == other.active && name == other.name && value == other.value;
+}
+
+// ================================
+// GraphDeltaCodec
+// ================================
+
+QVector<GraphDelta>
+GraphDeltaCodec::diff(const GraphSnapshot* older, const GraphSnapshot& newer)
+{
+    Phases phases;
+    if (older)
+    {
+        newer.forEachNodeChange(*older, [&phases](const NodeRecord* before, const NodeRecord* after) {
+            if (before && after)
+                changeNode(*before, *after, phases);
+            else if (after)
+                addNode(*after, phases);
+            else
+                removeNode(*before, phases);
+        });
+    }
+    else
+    {
+        newer.forEachNode([&phases](const NodeRecord& record) { addNode(record, phases); });
+    }
+
+    QVector<GraphDelta> events;
+    int total = 0;
+    for (const auto& phase : phases)
+        total += phase.size();
+    events.reserve(total);
+    for (const auto& phase : phases)
+        events += phase;
+    return events;
+}
+
+QByteArray
+GraphDeltaCodec::encode(FrameKind kind, quint64 revision, const QVector<GraphDelta>& events)
+{
+    QByteArray frame;
+    {
+        QDataStream s(&frame, QIODevice::WriteOnly);
+        s.setVersion(QDataStream::Qt_5_12);
+        s << quint32(0) << static_cast<quint8>(kind) << revision << static_cast<quint32>(events.size());
+        for (const GraphDelta& d : events)
+            write(s, d);
+    }
+    qToBigEndian<quint32>(static_cast<quint32>(frame.size() - sizePrefix), frame.data());
+    return frame;
+}
+
+bool
+GraphDeltaCodec::takeFrame(QByteArray& buffer, Frame& frame)
+{
+    if (buffer.size() < sizePrefix)
+        return false;
+    const quint32 size = qFromBigEndian<quint32>(buffer.constData());
+    if (static_cast<quint64>(buffer.size()) < sizePrefix + quint64(size))
+        return false;
+
+    const QByteArray payload = buffer.mid(sizePrefix, static_cast<int>(size));
+    buffer.remove(0, sizePrefix + static_cast<int>(size));
+
+    QDataStream s(payload);
+    s.setVersion(QDataStream::Qt_5_12);
+    quint8 kind = 0;
+    quint32 count = 0;
+    s >> kind >> frame.revision >> count;
+    frame.kind = static_cast<FrameKind>(kind);
+    frame.events.clear();
+    // Every event takes at least its type byte.
+    frame.events.reserve(static_cast<int>(std::min<quint64>(count, size)));
+    for (quint32 i = 0; i < count; ++i)
+    {
+        GraphDelta d;
+        if (!read(s, d))
+        {
+            qWarning() << "GraphDeltaCodec: dropping malformed frame at event" << i;
+            frame.events.clear();
+            return false;
+        }
+        frame.events.append(std::move(d));
+    }
+    return true;
+}
+
+// ================================
+// GraphDeltaPublisher
+// ================================
+
+/**
+ * @brief Owns the socket; diffs, encodes and writes on the publisher's worker thread.
+ */
+class GraphDeltaPublisher::Writer final : public QObject
+{
+public:
+    explicit Writer(GraphDeltaPublisher* owner)
+        : m_owner(owner)
+    {}
+
+    void
+    open(const QString& serverName)
+    {
+        if (!m_socket)
+        {
+            m_socket = new QLocalSocket(this);
+            connect(m_socket, &QLocalSocket::connected, this, [this] {
+                m_owner->m_connected = true;
+                m_resync = true;
+                emit m_owner->sgnConnected();
+                flush();
+            });
+            connect(m_socket, &QLocalSocket::disconnected, this, [this] {
+                m_owner->m_connected = false;
+                m_sent.reset();
+                emit m_owner->sgnDisconnected();
+            });
+            connect(m_socket, &QLocalSocket::bytesWritten, this, [this] { flush(); });
+            connect(m_socket, &QLocalSocket::readyRead, this, [this] { readCommands(); });
+        }
+        m_socket->abort();
+        m_socket->connectToServer(serverName);
+    }
+
+    void
+    close()
+    {
+        if (m_socket)
+            m_socket->disconnectFromServer();
+    }
+
+    void
+    push(std::shared_ptr<const GraphSnapshot> snapshot)
+    {
+        m_pending = std::move(snapshot);
+        flush();
+    }
+
+    void
+    resync()
+    {
+        m_resync = true;
+        flush();
+    }
+
+private:
+    void
+    flush()
+    {
+        if (!m_socket || m_socket->state() != QLocalSocket::ConnectedState || !m_pending)
+            return;
+        // bytesWritten() calls back once the runtime has caught up.
+        if (m_socket->bytesToWrite() > maxBufferedBytes)
+            return;
+
+        FrameKind kind = FrameKind::Delta;
+        QVector<GraphDelta> events;
+        if (m_resync || !m_sent)
+        {
+            kind = FrameKind::Snapshot;
+            events = GraphDeltaCodec::diff(nullptr, *m_pending);
+            m_resync = false;
+        }
+        else if (m_pending != m_sent)
+        {
+            events = GraphDeltaCodec::diff(m_sent.get(), *m_pending);
+        }
+        else
+        {
+            return;
+        }
+
+        if (kind == FrameKind::Snapshot || !events.isEmpty())
+        {
+            m_socket->write(GraphDeltaCodec::encode(kind, m_pending->revision(), events));
+            m_owner->m_sentEvents += events.size();
+        }
+        m_sent = m_pending;
+    }
+
+    void
+    readCommands()
+    {
+        const QByteArray bytes = m_socket->readAll();
+        for (char c : bytes)
+        {
+            if (static_cast<quint8>(c) == static_cast<quint8>(Command::Resync))
+                m_resync = true;
+            else
+                qWarning() << "GraphDeltaPublisher: unknown command" << int(static_cast<quint8>(c));
+        }
+        flush();
+    }
+
+    using Command = GraphDeltaCodec::Command;
+    using FrameKind = GraphDeltaCodec::FrameKind;
+
+    GraphDeltaPublisher* m_owner;                   ///< Publisher whose state and signals are updated.
+    QLocalSocket* m_socket = nullptr;               ///< Created on first open().
+    std::shared_ptr<const GraphSnapshot> m_pending; ///< Latest snapshot from the GUI thread.
+    std::shared_ptr<const GraphSnapshot> m_sent;    ///< Snapshot the runtime is known to have.
+    bool m_resync = true;                           ///< Whether the next frame is a Snapshot.
+};
+
+GraphDeltaPublisher::GraphDeltaPublisher(std::shared_ptr<GraphRegistry> registry, QObject* parent)
+    : QObject(parent)
+    , m_registry(std::move(registry))
+    , m_writer(new Writer(this))
+{
+    m_frameTimer.setInterval(defaultFrameMs);
+    connect(&m_frameTimer, &QTimer::timeout, this, &GraphDeltaPublisher::publishNow);
+
+    m_writer->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_writer, &QObject::deleteLater);
+    m_thread.start();
+}
+
+GraphDeltaPublisher::~GraphDeltaPublisher()
+{
+    m_frameTimer.stop();
+    m_thread.quit();
+    m_thread.wait();
+}
+
+void
+GraphDeltaPublisher::connectToServer(const QString& serverName)
+{
+    QMetaObject::invokeMethod(m_writer, [w = m_writer, serverName] { w->open(serverName); });
+    m_frameTimer.start();
+    publishNow();
+}
+
+void
+GraphDeltaPublisher::disconnectFromServer()
+{
+    m_frameTimer.stop();
+    QMetaObject::invokeMethod(m_writer, [w = m_writer] { w->close(); });
+}
+
+bool
+GraphDeltaPublisher::isConnected() const
+{
+    return m_connected;
+}
+
+void
+GraphDeltaPublisher::setFrameInterval(int ms)
+{
+    m_frameTimer.setInterval(std::max(ms, 1));
+}
+
+int
+GraphDeltaPublisher::frameInterval() const
+{
+    return m_frameTimer.interval();
+}
+
+void
+GraphDeltaPublisher::publishNow()
+{
+    if (!m_registry)
+        return;
+
+    // Cheap when nothing changed: the registry hands back the published snapshot.
+    auto snapshot = m_registry->snapshot();
+    if (!snapshot || snapshot == m_posted)
+        return;
+    m_posted = snapshot;
+    QMetaObject::invokeMethod(m_writer, [w = m_writer, snapshot] { w->push(snapshot); });
+}
+
+void
+GraphDeltaPublisher::requestResync()
+{
+    QMetaObject::invokeMethod(m_writer, [w = m_writer] { w->resync(); });
+}
+
+qint64
+GraphDeltaPublisher::sentEvents() const
+{
+    return m_sentEvents;
+}
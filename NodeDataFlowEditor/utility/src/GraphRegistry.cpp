@@ -23,16 +23,47 @@
 */
 
 #include "utility/GraphRegistry.hpp"
+#include "model/ParameterStore.hpp"
 #include "utility/GroupDescriptor.hpp"
 #include "utility/NodeDescriptor.hpp"
 #include "view/ConnectionItem.hpp"
 #include "view/GroupItem.hpp"
 #include "view/NodeItem.hpp"
+#include "view/ParameterBinder.hpp"
+#include "view/ParameterEditorPool.hpp"
 #include "view/PortLabel.hpp"
 
 #include <QDebug>
 #include <algorithm>
 
+namespace
+{
+    PortRecord::Kind recordKind(PortLabel const* port)
+    {
+        switch (port->getOrientation())
+        {
+            case PortLabel::Orientation::Input:
+                return PortRecord::Kind::Input;
+            case PortLabel::Orientation::Parameter:
+                return PortRecord::Kind::Parameter;
+            case PortLabel::Orientation::Output:
+            default:
+                return PortRecord::Kind::Output;
+        }
+    }
+
+    PortRecord makePortRecord(PortLabel const* port)
+    {
+        PortRecord record;
+        record.id = port->id();
+        record.name = port->name();
+        record.displayName = port->displayName();
+        record.kind = recordKind(port);
+        record.tags = port->getTagBitMask();
+        return record;
+    }
+} // namespace
+
 qint64
 GraphRegistry::registerNode(NodeItem* n)
 {
@@ -41,12 +72,16 @@ GraphRegistry::registerNode(NodeItem* n)
         return -1;
     if (m_nodes.contains(n))
         return m_nodes[n]->uid;
+    if (NodeDescriptor* parked = m_parkedNodes.value(n))
+        return parked->uid;
 
-    auto* d = new NodeDescriptor();
+    auto* d = m_nodePool.create();
     d->uid = m_nextNodeId++;
     d->node = n;
 
     m_nodes[n] = d;
+    m_dirtyNodes.insert(n);
+    ++m_topologyRevision;
     return d->uid;
 }
 
@@ -56,11 +91,44 @@ GraphRegistry::unregisterNode(NodeItem* n)
     QMutexLocker lock(&m_mutex);
     if (dynamic_cast<GroupItem*>(n))
         return;
-    auto it = m_nodes.find(n);
-    if (it == m_nodes.end())
+    NodeDescriptor* d = m_nodes.take(n);
+    if (!d)
+        d = m_parkedNodes.take(n);
+    if (!d)
         return;
-    delete it.value();
-    m_nodes.erase(it);
+    m_removedNodes.insert(d->uid);
+    m_dirtyNodes.remove(n);
+    forgetConnectionsUnlocked(*d);
+    for (const PortTable::Port& p : d->ports)
+        unregisterPortIdUnlocked(p.port);
+    m_nodePool.destroy(d);
+    ++m_topologyRevision;
+}
+
+void
+GraphRegistry::parkNode(NodeItem* n)
+{
+    QMutexLocker lock(&m_mutex);
+    NodeDescriptor* d = m_nodes.take(n);
+    if (!d)
+        return;
+    m_parkedNodes.insert(n, d);
+    m_removedNodes.insert(d->uid);
+    m_dirtyNodes.remove(n);
+    ++m_topologyRevision;
+}
+
+void
+GraphRegistry::unparkNode(NodeItem* n)
+{
+    QMutexLocker lock(&m_mutex);
+    NodeDescriptor* d = m_parkedNodes.take(n);
+    if (!d)
+        return;
+    // The next snapshot drops the removal first, then rebuilds the record under the same uid.
+    m_nodes.insert(n, d);
+    m_dirtyNodes.insert(n);
+    ++m_topologyRevision;
 }
 
 NodeDescriptor*
@@ -77,7 +145,11 @@ GraphRegistry::registerInput(NodeItem* n, PortLabel* p)
     if (p->isInputPort())
     {
         if (auto* d = lookupNodeUnlocked(n))
-            d->inputsDescriptor[p] = {};
+        {
+            d->ports.addPort(p, PortTable::Kind::Input);
+            m_portOwners.insert(registerPortIdUnlocked(p), n);
+            m_dirtyNodes.insert(n);
+        }
     }
     else
         qWarning() << "port " << p->name() << "in " << n->nodeName() << "is not an input port";
@@ -90,7 +162,11 @@ GraphRegistry::registerOutput(NodeItem* n, PortLabel* p)
     if (p->isOutputPort())
     {
         if (auto* d = lookupNodeUnlocked(n))
-            d->outputsDescriptor[p] = {};
+        {
+            d->ports.addPort(p, PortTable::Kind::Output);
+            m_portOwners.insert(registerPortIdUnlocked(p), n);
+            m_dirtyNodes.insert(n);
+        }
     }
     else
         qWarning() << "port " << p->name() << " in " << n->nodeName() << "is not an output port";
@@ -103,7 +179,11 @@ GraphRegistry::registerParameter(NodeItem* n, PortLabel* p)
     if (p->isParameterPort())
     {
         if (auto* d = lookupNodeUnlocked(n))
-            d->parametersInputsDescriptor[p] = {};
+        {
+            d->ports.addPort(p, PortTable::Kind::Parameter);
+            m_portOwners.insert(registerPortIdUnlocked(p), n);
+            m_dirtyNodes.insert(n);
+        }
     }
     else
         qWarning() << "port " << p->name() << " in " << n->nodeName() << "is not an parameter port";
@@ -116,7 +196,12 @@ GraphRegistry::unregisterInput(NodeItem* n, PortLabel* p)
     if (p->isInputPort())
     {
         if (auto* d = lookupNodeUnlocked(n))
-            d->inputsDescriptor.remove(p);
+        {
+            forgetPortConnectionsUnlocked(*d, p->id());
+            d->ports.removePort(p);
+            unregisterPortIdUnlocked(p);
+            m_dirtyNodes.insert(n);
+        }
     }
 }
 
@@ -127,41 +212,45 @@ GraphRegistry::unregisterOutput(NodeItem* n, PortLabel* p)
     if (p->isOutputPort())
     {
         if (auto* d = lookupNodeUnlocked(n))
-            d->outputsDescriptor.remove(p);
+        {
+            forgetPortConnectionsUnlocked(*d, p->id());
+            d->ports.removePort(p);
+            unregisterPortIdUnlocked(p);
+            m_dirtyNodes.insert(n);
+        }
     }
 }
 
 void
 GraphRegistry::unregisterParameter(NodeItem* n, PortLabel* p)
 {
-    QMutexLocker lock(&m_mutex);
-    if (auto* d = lookupNodeUnlocked(n))
-        d->parametersInputsDescriptor.remove(p);
+    {
+        QMutexLocker lock(&m_mutex);
+        if (auto* d = lookupNodeUnlocked(n))
+        {
+            forgetPortConnectionsUnlocked(*d, p->id());
+            d->ports.removePort(p);
+            unregisterPortIdUnlocked(p);
+            m_dirtyNodes.insert(n);
+        }
+    }
+    m_parameterStore->removePort(p->id());
 }
 
 PortLabel*
 GraphRegistry::resolvePort(const QString& nodeName,
                            const QString& portName)
 {
+    const Symbol node(nodeName);
+    const Symbol port(portName);
     for (NodeDescriptor* nd : std::as_const(m_nodes))
     {
         if (!nd->node || nd->node->nodeName() != nodeName)
             continue;
 
-        auto scan = [&](const QMap<PortLabel*, QVector<ConnectionItem*>>& mp) {
-            for (PortLabel* p : mp.keys())
-                if (p->name() == portName &&
-                    p->moduleName() == nodeName)
-                    return p;
-            return (PortLabel*)nullptr;
-        };
-
-        if (auto p = scan(nd->inputsDescriptor))
-            return p;
-        if (auto p = scan(nd->outputsDescriptor))
-            return p;
-        if (auto p = scan(nd->parametersInputsDescriptor))
-            return p;
+        for (const PortTable::Port& p : nd->ports)
+            if (p.port->nameSymbol() == port && p.port->moduleSymbol() == node)
+                return p.port;
     }
 
     return nullptr;
@@ -190,17 +279,23 @@ GraphRegistry::registerConnection(PortLabel* from, PortLabel* to, ConnectionItem
         qWarning() << "cant register connection to ports  [incorrect types] " << from->name() << " in " << from->moduleName() << " to " << to->name() << " in " << to->moduleName();
         return;
     }
-    NodeItem* outNode = nullptr;
-    NodeItem* inNode = nullptr;
-    if (auto desc = findNode(outPort->moduleName()))
-        outNode = desc->node;
-    else if (auto gDesc = findGroup(outPort->moduleName()))
-        outNode = gDesc->group;
-
-    if (auto desc = findNode(inPort->moduleName()))
-        inNode = desc->node;
-    else if (auto gDesc = findGroup(inPort->moduleName()))
-        inNode = gDesc->group;
+    NodeItem* outNode = portOwnerUnlocked(outPort);
+    NodeItem* inNode = portOwnerUnlocked(inPort);
+    // Ports created outside the registry have no id; fall back to the module name.
+    if (!outNode)
+    {
+        if (auto desc = findNode(outPort->moduleName()))
+            outNode = desc->node;
+        else if (auto gDesc = findGroup(outPort->moduleName()))
+            outNode = gDesc->group;
+    }
+    if (!inNode)
+    {
+        if (auto desc = findNode(inPort->moduleName()))
+            inNode = desc->node;
+        else if (auto gDesc = findGroup(inPort->moduleName()))
+            inNode = gDesc->group;
+    }
     if (!inNode || !outNode)
     {
         qWarning() << "cant register connection to ports " << from->name() << " in " << from->moduleName() << " to " << to->name() << " in " << to->moduleName();
@@ -208,14 +303,23 @@ GraphRegistry::registerConnection(PortLabel* from, PortLabel* to, ConnectionItem
         return;
     }
     if (auto* d = lookupNodeUnlocked(outNode))
-    {
-        d->outputsDescriptor[outPort].push_back(c);
-    }
+        d->ports.addConnection(outPort, PortTable::Kind::Output, c);
+    // Group ports have no port table; the group record lists their connections instead.
+    markDirtyUnlocked(outNode);
 
     if (auto* d = lookupNodeUnlocked(inNode))
     {
-        d->inputsDescriptor[inPort].push_back(c);
+        d->ports.addConnection(inPort, inPort->isParameterPort() ? PortTable::Kind::Parameter : PortTable::Kind::Input, c);
     }
+    if (c->m_id == invalidGraphId)
+        c->m_id = m_nextConnectionId++;
+    m_connections.insert(c->m_id, c);
+    if (auto old = m_connectionEnds.constFind(c->m_id); old != m_connectionEnds.cend())
+        unindexEndsUnlocked(c->m_id, *old);
+    const ConnectionEnds ends{outPort, inPort, outNode, inNode, outPort->id(), inPort->id()};
+    m_connectionEnds.insert(c->m_id, ends);
+    indexEndsUnlocked(c->m_id, ends);
+    ++m_topologyRevision;
 }
 
 PortLabel*
@@ -255,35 +359,58 @@ void
 GraphRegistry::unregisterConnection(ConnectionItem* c)
 {
     QMutexLocker lock(&m_mutex);
-    for (auto* nd : std::as_const(m_nodes))
-    {
-        for (auto& vec : nd->inputsDescriptor)
-        {
-            vec.removeAll(c);
-        }
+    unregisterConnectionUnlocked(c);
+}
 
-        for (auto& vec : nd->outputsDescriptor)
-        {
-            vec.removeAll(c);
-        }
+QSet<NodeItem*>
+GraphRegistry::unregisterConnections(const QVector<ConnectionItem*>& connections)
+{
+    QMutexLocker lock(&m_mutex);
+    QSet<NodeItem*> entered;
+    for (ConnectionItem* c : connections)
+        if (NodeItem* n = unregisterConnectionUnlocked(c))
+            entered.insert(n);
+    return entered;
+}
 
-        for (auto& vec : nd->parametersInputsDescriptor)
-        {
-            vec.removeAll(c);
-        }
+NodeItem*
+GraphRegistry::unregisterConnectionUnlocked(ConnectionItem* c)
+{
+    m_connections.remove(c->id());
+    const ConnectionEnds ends = m_connectionEnds.take(c->id());
+    unindexEndsUnlocked(c->id(), ends);
+    markDirtyUnlocked(ends.outputNode);
+    ++m_topologyRevision;
+
+    // Only the two end nodes can hold the connection; scan everything for connections never registered by id.
+    if (ends.outputNode || ends.inputNode)
+    {
+        if (auto* nd = lookupNodeUnlocked(ends.outputNode))
+            nd->ports.removeConnection(c);
+        if (auto* nd = lookupNodeUnlocked(ends.inputNode))
+            nd->ports.removeConnection(c);
+        return ends.inputNode;
     }
+    for (auto* nd : std::as_const(m_nodes))
+        nd->ports.removeConnection(c);
+    return nullptr;
 }
 
 void
 GraphRegistry::nodeMoved(NodeItem* node)
 {
+    QMutexLocker lock(&m_mutex);
+    markDirtyUnlocked(node);
+
     // Lambda for NodeItem m_port
-    auto refreshNodePorts = [&](const QMap<PortLabel*, QVector<ConnectionItem*>>& mp) {
-        for (auto it = mp.begin(); it != mp.end(); ++it)
+    auto refreshNodePorts = [&](const PortTable& ports) {
+        for (int i = 0; i < ports.portCount(); ++i)
         {
-            PortLabel const* port = it.key();
-            const QVector<ConnectionItem*>& connections = it.value();
+            const PortTable::Connections connections = ports.connectionsAt(i);
+            if (connections.isEmpty())
+                continue;
 
+            PortLabel const* port = ports.portAt(i).port;
             for (ConnectionItem* connection : connections)
             {
                 if (!connection)
@@ -343,9 +470,7 @@ GraphRegistry::nodeMoved(NodeItem* node)
     {
         if (!nd->node->isVisible())
             return;
-        refreshNodePorts(nd->inputsDescriptor);
-        refreshNodePorts(nd->outputsDescriptor);
-        refreshNodePorts(nd->parametersInputsDescriptor);
+        refreshNodePorts(nd->ports);
     }
 }
 
@@ -357,17 +482,20 @@ GraphRegistry::registerGroup(GroupItem* g)
     if (m_groups.contains(g))
         return m_groups[g]->uid;
 
-    auto* d = new GroupDescriptor();
+    auto* d = m_groupPool.create();
     d->uid = m_nextGroupId++;
     d->group = g;
 
     m_groups[g] = d;
+    m_dirtyGroups.insert(g);
 
     // Workaround, remove from nodes
     auto it = m_nodes.find(g);
     if (it == m_nodes.end())
         return d->uid;
-    delete it.value();
+    m_removedNodes.insert(it.value()->uid);
+    m_dirtyNodes.remove(g);
+    m_nodePool.destroy(it.value());
     m_nodes.erase(it);
 
     return d->uid;
@@ -382,7 +510,22 @@ GraphRegistry::unregisterGroup(GroupItem* g)
     if (it == m_groups.end())
         return;
 
-    delete it.value();
+    m_removedGroups.insert(it.value()->uid);
+    m_dirtyGroups.remove(g);
+    // The group's ports may already be deleted; only their ids are used.
+    for (auto p = m_forwardPortOwners.begin(); p != m_forwardPortOwners.end();)
+    {
+        if (p.value() == g)
+        {
+            markPortConnectionsDirtyUnlocked(p.key());
+            unindexForwardUnlocked(p.key());
+            m_ports.remove(p.key());
+            p = m_forwardPortOwners.erase(p);
+        }
+        else
+            ++p;
+    }
+    m_groupPool.destroy(it.value());
     m_groups.erase(it);
 }
 
@@ -393,7 +536,10 @@ GraphRegistry::addNodeToGroup(GroupItem* g, NodeItem* n)
     GroupDescriptor* gd = lookupGroupUnlocked(g);
     NodeDescriptor* nd = lookupNodeUnlocked(n);
     if (gd && nd)
+    {
         gd->memberNodes.push_back(nd);
+        m_dirtyGroups.insert(g);
+    }
 }
 
 void
@@ -408,6 +554,7 @@ GraphRegistry::removeNodeFromGroup(GroupItem* g, NodeItem const* n)
         std::remove_if(gd->memberNodes.begin(), gd->memberNodes.end(),
                        [&](auto const* nd) { return nd && nd->node == n; }),
         gd->memberNodes.end());
+    m_dirtyGroups.insert(g);
 }
 
 QVector<GroupDescriptor*>
@@ -435,10 +582,7 @@ GraphRegistry::registerForwardInput(GroupItem* g, PortLabel* forward, PortLabel*
 {
     QMutexLocker lock(&m_mutex);
     if (auto* gd = lookupGroupUnlocked(g))
-    {
-        gd->forwardInputsDescriptor[forward].push_back(actual);
-        forward->copyTagsFrom(*actual);
-    }
+        registerForwardUnlocked(g, gd->forwardInputsDescriptor, forward, actual);
 }
 
 void
@@ -446,10 +590,7 @@ GraphRegistry::registerForwardOutput(GroupItem* g, PortLabel* forward, PortLabel
 {
     QMutexLocker lock(&m_mutex);
     if (auto* gd = lookupGroupUnlocked(g))
-    {
-        gd->forwardOutputsDescriptor[forward].push_back(actual);
-        forward->copyTagsFrom(*actual);
-    }
+        registerForwardUnlocked(g, gd->forwardOutputsDescriptor, forward, actual);
 }
 
 void
@@ -457,9 +598,27 @@ GraphRegistry::registerForwardParameter(GroupItem* g, PortLabel* forward, PortLa
 {
     QMutexLocker lock(&m_mutex);
     if (auto* gd = lookupGroupUnlocked(g))
+        registerForwardUnlocked(g, gd->forwardParametersInputsDescriptor, forward, actual);
+}
+
+void
+GraphRegistry::registerForwardPorts(GroupItem* g, const QVector<ForwardRule>& rules)
+{
+    QMutexLocker lock(&m_mutex);
+    auto* gd = lookupGroupUnlocked(g);
+    if (!gd)
+        return;
+
+    for (const ForwardRule& rule : rules)
     {
-        gd->forwardParametersInputsDescriptor[forward].push_back(actual);
-        forward->copyTagsFrom(*actual);
+        if (!rule.forward || !rule.actual)
+            continue;
+        if (rule.forward->isInputPort())
+            registerForwardUnlocked(g, gd->forwardInputsDescriptor, rule.forward, rule.actual);
+        else if (rule.forward->isOutputPort())
+            registerForwardUnlocked(g, gd->forwardOutputsDescriptor, rule.forward, rule.actual);
+        else
+            registerForwardUnlocked(g, gd->forwardParametersInputsDescriptor, rule.forward, rule.actual);
     }
 }
 
@@ -472,6 +631,10 @@ GraphRegistry::unregisterForwardPort(GroupItem* g, PortLabel* forward)
         gd->forwardInputsDescriptor.remove(forward);
         gd->forwardOutputsDescriptor.remove(forward);
         gd->forwardParametersInputsDescriptor.remove(forward);
+        markPortConnectionsDirtyUnlocked(forward->id());
+        unindexForwardUnlocked(forward->id());
+        unregisterPortIdUnlocked(forward);
+        m_dirtyGroups.insert(g);
     }
 }
 
@@ -489,9 +652,62 @@ GraphRegistry::allGroups() const
     return m_groups.values().toVector();
 }
 
-GraphRegistry::GraphRegistry() = default;
+QVector<ConnectionItem*>
+GraphRegistry::allConnections() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_connections.values().toVector();
+}
 
-GraphRegistry::~GraphRegistry() = default;
+int
+GraphRegistry::nodeCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return static_cast<int>(m_nodes.size());
+}
+
+int
+GraphRegistry::connectionCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return static_cast<int>(m_connections.size());
+}
+
+GraphRegistry::GraphRegistry()
+    : m_published(std::make_shared<const GraphSnapshot>())
+    , m_parameterStore(std::make_unique<ParameterStore>())
+    , m_parameterBinder(std::make_unique<ParameterBinder>(*m_parameterStore))
+    , m_editorPool(std::make_unique<ParameterEditorPool>(*m_parameterBinder))
+{
+    // Records carry every leaf, including editors inside containers whose widget never notifies the node.
+    QObject::connect(m_parameterStore.get(),
+                     &ParameterStore::sgnValueChanged,
+                     m_parameterStore.get(),
+                     [this](ParameterKey key, const QVariant&, QObject*) {
+                         QMutexLocker lock(&m_mutex);
+                         if (NodeItem* node = m_portOwners.value(key.port))
+                             markDirtyUnlocked(node);
+                     });
+}
+
+GraphRegistry::~GraphRegistry()
+{
+    for (NodeDescriptor* d : std::as_const(m_nodes))
+        m_nodePool.destroy(d);
+    for (NodeDescriptor* d : std::as_const(m_parkedNodes))
+        m_nodePool.destroy(d);
+    for (GroupDescriptor* d : std::as_const(m_groups))
+        m_groupPool.destroy(d);
+}
+
+void
+GraphRegistry::reserve(int nodes, int connections)
+{
+    QMutexLocker lock(&m_mutex);
+    m_connectionEnds.reserve(connections);
+    m_connections.reserve(connections);
+    m_dirtyNodes.reserve(nodes);
+}
 
 NodeDescriptor*
 GraphRegistry::lookupNodeUnlocked(NodeItem* n) const
@@ -499,6 +715,24 @@ GraphRegistry::lookupNodeUnlocked(NodeItem* n) const
     return m_nodes.value(n, nullptr);
 }
 
+ParameterStore&
+GraphRegistry::parameterStore()
+{
+    return *m_parameterStore;
+}
+
+ParameterBinder&
+GraphRegistry::parameterBinder()
+{
+    return *m_parameterBinder;
+}
+
+ParameterEditorPool&
+GraphRegistry::parameterEditorPool()
+{
+    return *m_editorPool;
+}
+
 GroupDescriptor*
 GraphRegistry::lookupGroupUnlocked(GroupItem* g) const
 {
@@ -515,6 +749,13 @@ GraphRegistry::findNode(const QString& name)
     return nullptr;
 }
 
+QVector<SearchHit>
+GraphRegistry::search(const QString& query, int limit)
+{
+    m_searchIndex.update(snapshot());
+    return m_searchIndex.search(query, limit);
+}
+
 GroupDescriptor*
 GraphRegistry::findGroup(const QString& name)
 {
@@ -543,49 +784,19 @@ GraphRegistry::findNodeInGroup(const QString& name, GroupItem* g)
 QVector<PortLabel*>
 GraphRegistry::getAllPortsForwardedToAPort(PortLabel* actual)
 {
+    if (!actual)
+        return {};
     QMutexLocker lock(&m_mutex);
-    QVector<PortLabel*> result;
-
-    for (GroupDescriptor const* gd : std::as_const(m_groups))
-    {
-        auto check = [&](const QMap<PortLabel*, QVector<PortLabel*>>& mp) {
-            for (auto it = mp.begin(); it != mp.end(); ++it)
-            {
-                PortLabel* forward = it.key();
-                const QVector<PortLabel*>& targets = it.value();
-
-                if (targets.contains(actual))
-                    result.push_back(forward);
-            }
-        };
-
-        check(gd->forwardInputsDescriptor);
-        check(gd->forwardOutputsDescriptor);
-        check(gd->forwardParametersInputsDescriptor);
-    }
-
-    return result;
+    return portsByIdUnlocked(m_actualToForward.value(actual->id()));
 }
 
 QVector<PortLabel*>
 GraphRegistry::getAllForwardedPortsFromAPort(PortLabel* forwardPort)
 {
+    if (!forwardPort)
+        return {};
     QMutexLocker lock(&m_mutex);
-    QVector<PortLabel*> result;
-
-    for (GroupDescriptor const* gd : std::as_const(m_groups))
-    {
-        auto appendIfExists = [&](const QMap<PortLabel*, QVector<PortLabel*>>& mp) {
-            if (mp.contains(forwardPort))
-                result += mp[forwardPort];
-        };
-
-        appendIfExists(gd->forwardInputsDescriptor);
-        appendIfExists(gd->forwardOutputsDescriptor);
-        appendIfExists(gd->forwardParametersInputsDescriptor);
-    }
-
-    return result;
+    return portsByIdUnlocked(m_forwardToActual.value(forwardPort->id()));
 }
 
 QVector<ConnectionItem*>
@@ -599,9 +810,7 @@ GraphRegistry::getConnections(PortLabel* port)
     QMutexLocker lock(&m_mutex);
 
     // Find the NodeDescriptor that owns this port
-    NodeItem* ownerNode = nullptr;
-    if (findNode(port->moduleName()))
-        ownerNode = findNode(port->moduleName())->node;
+    NodeItem* ownerNode = m_portOwners.value(port->id());
 
     if (!ownerNode)
     {
@@ -613,35 +822,38 @@ GraphRegistry::getConnections(PortLabel* port)
     if (!nd)
         return result;
 
-    // Look in inputs
-    if (nd->inputsDescriptor.contains(port))
-        result += nd->inputsDescriptor[port];
-
-    // Look in outputs
-    if (nd->outputsDescriptor.contains(port))
-        result += nd->outputsDescriptor[port];
-
-    // Look in parameters
-    if (nd->parametersInputsDescriptor.contains(port))
-        result += nd->parametersInputsDescriptor[port];
-
+    const PortTable::Connections connections = nd->ports.connections(port);
+    result.reserve(connections.size());
+    for (ConnectionItem* c : connections)
+        result.push_back(c);
     return result;
 }
 
 bool
 GraphRegistry::hasConnection(PortLabel* port)
 {
-    if (auto forwardsPorts = getAllForwardedPortsFromAPort(port); !forwardsPorts.isEmpty())
+    if (!port)
+        return false;
+
+    QMutexLocker lock(&m_mutex);
+    const auto forwardsPorts = m_forwardToActual.constFind(port->id());
+    if (forwardsPorts != m_forwardToActual.constEnd())
     {
-        for (auto p : std::as_const(forwardsPorts))
+        for (PortId actual : forwardsPorts.value())
         {
-            if (hasConnection(p))
+            if (hasConnection(m_ports.value(actual)))
             {
                 return true;
             }
         }
+        return false;
     }
-    return !getConnections(port).empty();
+
+    NodeDescriptor const* nd = lookupNodeUnlocked(m_portOwners.value(port->id()));
+    if (!nd)
+        return false;
+
+    return !nd->ports.connections(port).isEmpty();
 }
 
 QVector<ConnectionItem*>
@@ -654,33 +866,15 @@ GraphRegistry::getConnectionsFromGroupPort(PortLabel* forwardPort)
 
     QMutexLocker lock(&m_mutex);
 
-    // Iterate all groups to find which group owns this forwarded port
-    for (auto const* gd : std::as_const(m_groups))
-    {
-        auto checkMap = [&](const QMap<PortLabel*, QVector<PortLabel*>>& mp) {
-            if (!mp.contains(forwardPort))
-                return;
-
-            const QVector<PortLabel*>& actualPorts = mp[forwardPort];
-
-            for (PortLabel* actual : actualPorts)
-            {
-                // Get all connections from this actual port
-                QVector<ConnectionItem*> conns = getConnections(actual);
-                result += conns;
-            }
-        };
-
-        checkMap(gd->forwardInputsDescriptor);
-        checkMap(gd->forwardOutputsDescriptor);
-        checkMap(gd->forwardParametersInputsDescriptor);
-    }
+    // Collect the connections of every actual port behind this forwarded port
+    for (PortLabel* actual : portsByIdUnlocked(m_forwardToActual.value(forwardPort->id())))
+        result += getConnections(actual);
 
     return result;
 }
 
 ConnectionItem*
-GraphRegistry::findConnection(PortLabel& fromPort, QString portName, QString moduleName)
+GraphRegistry::findConnection(PortLabel& fromPort, Symbol portName, Symbol moduleName)
 {
     for (ConnectionItem* conn : getConnections(&fromPort))
     {
@@ -700,7 +894,7 @@ GraphRegistry::findConnection(PortLabel& fromPort, QString portName, QString mod
 }
 
 bool
-GraphRegistry::hasConnectionTo(PortLabel& fromPort, QString toPortName, QString toPortModuleName)
+GraphRegistry::hasConnectionTo(PortLabel& fromPort, Symbol toPortName, Symbol toPortModuleName)
 {
     return (findConnection(fromPort, toPortName, toPortModuleName) != nullptr);
 }
@@ -729,13 +923,21 @@ GraphRegistry::hasConnectionTo(PortLabel& fromPort, PortLabel& toPort)
     if (!in || !out)
         return false;
 
-    return hasConnectionTo(*in, out->name(), out->moduleName());
+    if (out->id() == invalidGraphId)
+        return hasConnectionTo(*in, out->nameSymbol(), out->moduleSymbol());
+
+    // Compare ids so the answer does not depend on node or port names.
+    for (ConnectionItem* conn : getConnections(in))
+        if (conn->outputPort().portId == out->id())
+            return true;
+    return false;
 }
 
 void
 GraphRegistry::activateNode(NodeItem* node)
 {
     node->setActive(true);
+    markDirty(node);
     for (auto port : node->outputs())
     {
         for (ConnectionItem* conn : getConnections(port))
@@ -749,6 +951,7 @@ void
 GraphRegistry::deactivateNode(NodeItem* node)
 {
     node->setActive(false);
+    markDirty(node);
     for (auto port : node->outputs())
     {
         for (ConnectionItem* conn : getConnections(port))
@@ -763,3 +966,447 @@ GraphRegistry::isNodeActive(NodeItem* node)
 {
     return node->isActivated();
 }
+
+void
+GraphRegistry::markDirty(NodeItem* n)
+{
+    QMutexLocker lock(&m_mutex);
+    markDirtyUnlocked(n);
+}
+
+void
+GraphRegistry::markDirtyUnlocked(NodeItem* n)
+{
+    if (!n)
+        return;
+    if (auto* g = dynamic_cast<GroupItem*>(n); g && m_groups.contains(g))
+        m_dirtyGroups.insert(g);
+    else if (m_nodes.contains(n))
+        m_dirtyNodes.insert(n);
+}
+
+void
+GraphRegistry::indexForwardUnlocked(PortLabel* forward, PortLabel* actual)
+{
+    if (forward->id() == invalidGraphId || actual->id() == invalidGraphId)
+    {
+        qWarning() << "cant index forward port " << forward->name() << " to unregistered port " << actual->name();
+        return;
+    }
+    m_forwardToActual[forward->id()].push_back(actual->id());
+    m_actualToForward[actual->id()].push_back(forward->id());
+    ++m_topologyRevision;
+}
+
+void
+GraphRegistry::registerForwardUnlocked(GroupItem* g,
+                                       QMap<PortLabel*, QVector<PortLabel*>>& rules,
+                                       PortLabel* forward,
+                                       PortLabel* actual)
+{
+    rules[forward].push_back(actual);
+    m_forwardPortOwners.insert(registerPortIdUnlocked(forward), g);
+    indexForwardUnlocked(forward, actual);
+    forward->copyTagsFrom(*actual);
+    m_dirtyGroups.insert(g);
+}
+
+void
+GraphRegistry::unindexForwardUnlocked(PortId forward)
+{
+    for (PortId actual : m_forwardToActual.take(forward))
+    {
+        auto it = m_actualToForward.find(actual);
+        if (it == m_actualToForward.end())
+            continue;
+        it.value().removeAll(forward);
+        if (it.value().isEmpty())
+            m_actualToForward.erase(it);
+    }
+    ++m_topologyRevision;
+}
+
+PortId
+GraphRegistry::registerPortIdUnlocked(PortLabel* p)
+{
+    if (p->m_id == invalidGraphId)
+        p->m_id = m_nextPortId++;
+    m_ports.insert(p->m_id, p);
+    ++m_topologyRevision;
+    return p->m_id;
+}
+
+void
+GraphRegistry::unregisterPortIdUnlocked(PortLabel const* p)
+{
+    m_ports.remove(p->id());
+    m_portOwners.remove(p->id());
+    m_forwardPortOwners.remove(p->id());
+    ++m_topologyRevision;
+}
+
+NodeItem*
+GraphRegistry::portOwnerUnlocked(PortLabel const* port) const
+{
+    if (NodeItem* node = m_portOwners.value(port->id()))
+        return node;
+    return m_forwardPortOwners.value(port->id());
+}
+
+qint64
+GraphRegistry::ownerUidUnlocked(PortLabel const* port) const
+{
+    if (!port)
+        return -1;
+    if (auto const* nd = lookupNodeUnlocked(m_portOwners.value(port->id())))
+        return nd->uid;
+    return -1;
+}
+
+QVector<PortLabel*>
+GraphRegistry::portsByIdUnlocked(const QVector<PortId>& ids) const
+{
+    QVector<PortLabel*> ports;
+    ports.reserve(ids.size());
+    for (PortId id : ids)
+        if (PortLabel* p = m_ports.value(id))
+            ports.push_back(p);
+    return ports;
+}
+
+PortLabel*
+GraphRegistry::getPortById(PortId id) const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_ports.value(id);
+}
+
+ConnectionItem*
+GraphRegistry::getConnectionById(ConnectionId id) const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_connections.value(id);
+}
+
+void
+GraphRegistry::forgetConnectionsUnlocked(const NodeDescriptor& nd)
+{
+    // Connection items may already be gone here, so walk the ids listed for the
+    // node instead of asking each item for its id.
+    const QVector<ConnectionId> ids = m_nodeConnections.take(nd.node);
+    for (ConnectionId id : ids)
+    {
+        const auto it = m_connectionEnds.constFind(id);
+        if (it == m_connectionEnds.cend())
+            continue;
+        const ConnectionEnds ends = *it;
+        m_connectionEnds.erase(it);
+        unindexEndsUnlocked(id, ends);
+
+        // The other end keeps no entry for a connection the registry no longer knows.
+        ConnectionItem* c = m_connections.take(id);
+        NodeItem* other = ends.outputNode == nd.node ? ends.inputNode : ends.outputNode;
+        if (auto* od = lookupNodeUnlocked(other))
+            od->ports.removeConnection(c);
+        // Its record, node or group, still lists the connection to the node going away.
+        markDirtyUnlocked(other);
+    }
+}
+
+void
+GraphRegistry::indexEndsUnlocked(ConnectionId id, const ConnectionEnds& ends)
+{
+    if (ends.outputNode)
+        m_nodeConnections[ends.outputNode].append(id);
+    if (ends.inputNode && ends.inputNode != ends.outputNode)
+        m_nodeConnections[ends.inputNode].append(id);
+    if (ends.outputId != invalidGraphId)
+        m_portConnections[ends.outputId].append(id);
+    if (ends.inputId != invalidGraphId && ends.inputId != ends.outputId)
+        m_portConnections[ends.inputId].append(id);
+}
+
+void
+GraphRegistry::unindexEndsUnlocked(ConnectionId id, const ConnectionEnds& ends)
+{
+    // Lists hold one entry per connection and end, so removing is linear in the degree.
+    const auto drop = [id](auto& index, auto key) {
+        auto it = index.find(key);
+        if (it == index.end())
+            return;
+        it->removeOne(id);
+        if (it->isEmpty())
+            index.erase(it);
+    };
+    drop(m_nodeConnections, ends.outputNode);
+    drop(m_nodeConnections, ends.inputNode);
+    drop(m_portConnections, ends.outputId);
+    drop(m_portConnections, ends.inputId);
+}
+
+void
+GraphRegistry::forgetPortConnectionsUnlocked(NodeDescriptor& nd, PortId port)
+{
+    // As in forgetConnectionsUnlocked, the items may be gone; walk the ids listed for the port.
+    const QVector<ConnectionId> ids = m_portConnections.value(port);
+    for (ConnectionId id : ids)
+    {
+        const auto it = m_connectionEnds.constFind(id);
+        if (it == m_connectionEnds.cend())
+            continue;
+        const ConnectionEnds ends = *it;
+        m_connectionEnds.erase(it);
+        unindexEndsUnlocked(id, ends);
+
+        ConnectionItem* c = m_connections.take(id);
+        NodeItem* other = ends.outputId == port ? ends.inputNode : ends.outputNode;
+        if (auto* od = lookupNodeUnlocked(other); od && od != &nd)
+            od->ports.removeConnection(c);
+        if (other != nd.node)
+            markDirtyUnlocked(other);
+        ++m_topologyRevision;
+    }
+}
+
+void
+GraphRegistry::markPortConnectionsDirtyUnlocked(PortId port)
+{
+    for (ConnectionId id : m_portConnections.value(port))
+    {
+        const ConnectionEnds ends = m_connectionEnds.value(id);
+        markDirtyUnlocked(ends.outputNode);
+        markDirtyUnlocked(ends.inputNode);
+    }
+}
+
+bool
+GraphRegistry::buildEdgeRecordUnlocked(ConnectionId id, EdgeRecord& edge) const
+{
+    const auto it = m_connectionEnds.constFind(id);
+    if (it == m_connectionEnds.cend())
+        return false;
+    PortLabel const* output = m_ports.value(it->outputId);
+    PortLabel const* input = m_ports.value(it->inputId);
+    if (!output || !input)
+        return false;
+
+    // Each end is owned by a registered node or, for a group port, by a registered group.
+    const auto owner = [this](NodeItem* item, qint64& node, qint64& group) {
+        if (NodeDescriptor const* nd = lookupNodeUnlocked(item))
+            node = nd->uid;
+        else if (GroupDescriptor const* gd = lookupGroupUnlocked(dynamic_cast<GroupItem*>(item)))
+            group = gd->uid;
+        return node >= 0 || group >= 0;
+    };
+    if (!owner(it->outputNode, edge.fromNode, edge.fromGroup) || !owner(it->inputNode, edge.toNode, edge.toGroup))
+        return false;
+
+    edge.id = id;
+    edge.fromPortId = it->outputId;
+    edge.fromPort = output->name();
+    edge.toPortId = it->inputId;
+    edge.toPort = input->name();
+    if (ConnectionItem const* c = m_connections.value(id))
+        edge.active = c->isActivated();
+    return true;
+}
+
+NodeRecord
+GraphRegistry::buildNodeRecordUnlocked(const NodeDescriptor& nd) const
+{
+    NodeItem const* node = nd.node;
+
+    NodeRecord record;
+    record.uid = nd.uid;
+    record.name = node->nodeName();
+    record.displayedName = node->displayedNodeName();
+    record.position = node->pos();
+    record.size = node->boundingRect().size();
+    record.titleColor = node->nodeNameColor();
+    record.active = node->isActivated();
+    record.visible = node->isVisible();
+
+    for (auto const* port : node->inputs())
+        record.inputs.push_back(makePortRecord(port));
+    for (auto const* port : node->outputs())
+        record.outputs.push_back(makePortRecord(port));
+    // Values come from the store, never from the widgets, which belong to the GUI thread.
+    for (auto const* port : node->paramsInputs())
+    {
+        PortRecord param = makePortRecord(port);
+        const int leaves = m_parameterStore->leafCount(port->id());
+        param.values.reserve(leaves);
+        for (int leaf = 0; leaf < leaves; ++leaf)
+            param.values.push_back(m_parameterStore->value({port->id(), leaf}));
+        if (!param.values.isEmpty())
+            param.value = param.values.front();
+        record.parameters.push_back(param);
+    }
+
+    for (int i = 0; i < nd.ports.portCount(); ++i)
+    {
+        if (nd.ports.portAt(i).kind != PortTable::Kind::Output)
+            continue;
+        for (ConnectionItem* c : nd.ports.connectionsAt(i))
+        {
+            EdgeRecord edge;
+            if (c && buildEdgeRecordUnlocked(c->id(), edge))
+                record.outgoing.push_back(edge);
+        }
+    }
+    return record;
+}
+
+GroupRecord
+GraphRegistry::buildGroupRecordUnlocked(const GroupDescriptor& gd) const
+{
+    GroupItem const* group = gd.group;
+
+    GroupRecord record;
+    record.uid = gd.uid;
+    record.name = group->nodeName();
+    record.displayedName = group->displayedNodeName();
+    record.position = group->pos();
+
+    for (NodeDescriptor const* nd : gd.memberNodes)
+        if (nd)
+            record.members.push_back(nd->uid);
+
+    auto addForwards = [&](const QMap<PortLabel*, QVector<PortLabel*>>& mp, PortRecord::Kind kind) {
+        for (auto it = mp.cbegin(); it != mp.cend(); ++it)
+        {
+            for (PortLabel const* actual : it.value())
+            {
+                if (!actual)
+                    continue;
+                record.forwards.push_back({it.key()->name(), ownerUidUnlocked(actual), actual->name(), kind, it.key()->id(), actual->id()});
+            }
+        }
+    };
+
+    addForwards(gd.forwardInputsDescriptor, PortRecord::Kind::Input);
+    addForwards(gd.forwardOutputsDescriptor, PortRecord::Kind::Output);
+    addForwards(gd.forwardParametersInputsDescriptor, PortRecord::Kind::Parameter);
+
+    for (auto it = gd.forwardOutputsDescriptor.cbegin(); it != gd.forwardOutputsDescriptor.cend(); ++it)
+    {
+        const PortId port = it.key()->id();
+        for (ConnectionId id : m_portConnections.value(port))
+        {
+            EdgeRecord edge;
+            if (m_connectionEnds.value(id).outputId == port && buildEdgeRecordUnlocked(id, edge))
+                record.outgoing.push_back(edge);
+        }
+    }
+    return record;
+}
+
+std::shared_ptr<const GraphSnapshot>
+GraphRegistry::snapshot()
+{
+    QMutexLocker lock(&m_mutex);
+    auto current = latestSnapshot();
+    if (m_dirtyNodes.isEmpty() && m_dirtyGroups.isEmpty() && m_removedNodes.isEmpty() && m_removedGroups.isEmpty())
+        return current;
+
+    auto next = std::make_shared<GraphSnapshot>(*current);
+
+    for (qint64 uid : std::as_const(m_removedNodes))
+    {
+        if (!next->node(uid))
+            continue;
+        next->m_nodes = next->m_nodes.erase(static_cast<std::size_t>(uid));
+        --next->m_nodeCount;
+    }
+
+    for (qint64 uid : std::as_const(m_removedGroups))
+    {
+        if (!next->group(uid))
+            continue;
+        next->m_groups = next->m_groups.erase(static_cast<std::size_t>(uid));
+        --next->m_groupCount;
+    }
+
+    for (NodeItem* n : std::as_const(m_dirtyNodes))
+    {
+        NodeDescriptor const* nd = lookupNodeUnlocked(n);
+        if (!nd)
+            continue;
+        if (!next->node(nd->uid))
+            ++next->m_nodeCount;
+        next->m_nodes = next->m_nodes.set(static_cast<std::size_t>(nd->uid),
+                                          std::make_shared<const NodeRecord>(buildNodeRecordUnlocked(*nd)));
+    }
+
+    for (GroupItem* g : std::as_const(m_dirtyGroups))
+    {
+        GroupDescriptor const* gd = lookupGroupUnlocked(g);
+        if (!gd)
+            continue;
+        if (!next->group(gd->uid))
+            ++next->m_groupCount;
+        next->m_groups = next->m_groups.set(static_cast<std::size_t>(gd->uid),
+                                            std::make_shared<const GroupRecord>(buildGroupRecordUnlocked(*gd)));
+    }
+
+    next->m_revision = current->m_revision + 1;
+    m_dirtyNodes.clear();
+    m_dirtyGroups.clear();
+    m_removedNodes.clear();
+    m_removedGroups.clear();
+
+    std::shared_ptr<const GraphSnapshot> published = std::move(next);
+    std::atomic_store(&m_published, published);
+    return published;
+}
+
+std::shared_ptr<const GraphSnapshot>
+GraphRegistry::latestSnapshot() const
+{
+    return std::atomic_load(&m_published);
+}
+
+ExecutionPlan::Source
+GraphRegistry::buildPlanSourceUnlocked() const
+{
+    auto ids = [](const auto& ports) {
+        QVector<PortId> result;
+        result.reserve(ports.size());
+        for (PortLabel const* p : ports)
+            if (p && p->id() != invalidGraphId)
+                result.push_back(p->id());
+        return result;
+    };
+
+    ExecutionPlan::Source source;
+    source.nodes.reserve(m_nodes.size());
+    for (NodeDescriptor const* nd : std::as_const(m_nodes))
+        source.nodes.push_back({nd->uid, ids(nd->node->inputs()), ids(nd->node->outputs()), ids(nd->node->paramsInputs())});
+
+    source.connections.reserve(m_connectionEnds.size());
+    for (auto it = m_connectionEnds.cbegin(); it != m_connectionEnds.cend(); ++it)
+        if (it->outputId != invalidGraphId && it->inputId != invalidGraphId)
+            source.connections.push_back({it.key(), it->outputId, it->inputId});
+    // Hash order changes from run to run; edges keep the order the connections were made in.
+    std::sort(source.connections.begin(), source.connections.end(),
+              [](const ExecutionPlan::Source::Connection& a, const ExecutionPlan::Source::Connection& b) { return a.id < b.id; });
+
+    source.forwards = m_forwardToActual;
+    return source;
+}
+
+std::shared_ptr<const ExecutionPlan>
+GraphRegistry::executionPlan()
+{
+    QMutexLocker lock(&m_mutex);
+    if (!m_plan || m_plan->topologyRevision() != m_topologyRevision)
+        m_plan = ExecutionPlan::compile(buildPlanSourceUnlocked(), m_topologyRevision);
+    return m_plan;
+}
+
+quint64
+GraphRegistry::topologyRevision() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_topologyRevision;
+}
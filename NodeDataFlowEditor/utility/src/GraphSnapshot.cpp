@@ -0,0 +1,71 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/GraphSnapshot.hpp"
+
+std::shared_ptr<const NodeRecord>
+GraphSnapshot::node(qint64 uid) const
+{
+    if (uid < 0)
+        return nullptr;
+    return m_nodes.at(static_cast<std::size_t>(uid));
+}
+
+std::shared_ptr<const GroupRecord>
+GraphSnapshot::group(qint64 uid) const
+{
+    if (uid < 0)
+        return nullptr;
+    return m_groups.at(static_cast<std::size_t>(uid));
+}
+
+void
+GraphSnapshot::forEachNode(const std::function<void(const NodeRecord&)>& fn) const
+{
+    m_nodes.forEach([&](std::size_t, const NodeRecord& record) { fn(record); });
+}
+
+void
+GraphSnapshot::forEachGroup(const std::function<void(const GroupRecord&)>& fn) const
+{
+    m_groups.forEach([&](std::size_t, const GroupRecord& record) { fn(record); });
+}
+
+QVector<EdgeRecord>
+GraphSnapshot::edges() const
+{
+    QVector<EdgeRecord> result;
+    m_nodes.forEach([&](std::size_t, const NodeRecord& record) { result += record.outgoing; });
+    m_groups.forEach([&](std::size_t, const GroupRecord& record) { result += record.outgoing; });
+    return result;
+}
+
+void
+GraphSnapshot::forEachNodeChange(const GraphSnapshot& older,
+                                 const std::function<void(const NodeRecord*, const NodeRecord*)>& fn) const
+{
+    m_nodes.forEachChange(older.m_nodes, [&](std::size_t, const NodeRecord* before, const NodeRecord* after) {
+        fn(before, after);
+    });
+}
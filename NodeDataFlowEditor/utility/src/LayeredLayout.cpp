@@ -0,0 +1,266 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/LayeredLayout.hpp"
+
+#include <QVector>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace
+{
+    /**
+     * @brief Dense, index-based copy of the part of the snapshot being laid out.
+     */
+    struct LayoutGraph
+    {
+        QVector<NodeRecord const*> records; ///< Laid-out node records, indexed densely.
+        QVector<QVector<int>> successors;   ///< Acyclic edges, reversed back edges included.
+        QVector<QVector<int>> predecessors; ///< Reverse of successors.
+    };
+
+    LayoutGraph buildGraph(const GraphSnapshot& snapshot, const QSet<qint64>& subset)
+    {
+        LayoutGraph graph;
+        QHash<qint64, int> index;
+        snapshot.forEachNode([&](const NodeRecord& record) {
+            if (!record.visible || (!subset.isEmpty() && !subset.contains(record.uid)))
+                return;
+            index.insert(record.uid, graph.records.size());
+            graph.records.push_back(&record);
+        });
+
+        const int n = graph.records.size();
+        QVector<QVector<int>> out(n);
+        for (int i = 0; i < n; ++i)
+        {
+            for (const EdgeRecord& edge : graph.records[i]->outgoing)
+            {
+                const int j = index.value(edge.toNode, -1);
+                if (j >= 0 && j != i)
+                    out[i].push_back(j);
+            }
+            std::sort(out[i].begin(), out[i].end());
+            out[i].erase(std::unique(out[i].begin(), out[i].end()), out[i].end());
+        }
+
+        // Break cycles: an edge reaching a node still on the DFS stack is reversed.
+        enum : char
+        {
+            Unvisited,
+            OnStack,
+            Done
+        };
+        QVector<char> state(n, Unvisited);
+        graph.successors.resize(n);
+        graph.predecessors.resize(n);
+        QVector<std::pair<int, int>> stack;
+        for (int root = 0; root < n; ++root)
+        {
+            if (state[root] != Unvisited)
+                continue;
+            state[root] = OnStack;
+            stack.push_back({root, 0});
+            while (!stack.isEmpty())
+            {
+                auto& [v, next] = stack.last();
+                if (next == out[v].size())
+                {
+                    state[v] = Done;
+                    stack.removeLast();
+                    continue;
+                }
+                const int w = out[v][next++];
+                const int from = v;
+                if (state[w] == OnStack)
+                {
+                    graph.successors[w].push_back(from);
+                    graph.predecessors[from].push_back(w);
+                    continue;
+                }
+                graph.successors[from].push_back(w);
+                graph.predecessors[w].push_back(from);
+                if (state[w] == Unvisited)
+                {
+                    state[w] = OnStack;
+                    stack.push_back({w, 0});
+                }
+            }
+        }
+        return graph;
+    }
+
+    /// Longest-path layering; returns the nodes of each layer in topological order.
+    QVector<QVector<int>> assignLayers(const LayoutGraph& graph, QVector<int>& layerOf)
+    {
+        const int n = graph.records.size();
+        QVector<int> inDegree(n);
+        for (int v = 0; v < n; ++v)
+            inDegree[v] = graph.predecessors[v].size();
+
+        QVector<int> queue;
+        queue.reserve(n);
+        for (int v = 0; v < n; ++v)
+            if (inDegree[v] == 0)
+                queue.push_back(v);
+
+        layerOf.fill(0, n);
+        int layerCount = 1;
+        for (int head = 0; head < queue.size(); ++head)
+        {
+            const int v = queue[head];
+            for (int w : graph.successors[v])
+            {
+                layerOf[w] = std::max(layerOf[w], layerOf[v] + 1);
+                layerCount = std::max(layerCount, layerOf[w] + 1);
+                if (--inDegree[w] == 0)
+                    queue.push_back(w);
+            }
+        }
+
+        QVector<QVector<int>> layers(layerCount);
+        for (int v : std::as_const(queue))
+            layers[layerOf[v]].push_back(v);
+        return layers;
+    }
+
+    /// Barycenter ordering of @p layer against the normalized positions of @p neighbours.
+    void orderLayer(QVector<int>& layer, const QVector<QVector<int>>& neighbours, QVector<double>& rank)
+    {
+        QVector<double> key(layer.size());
+        for (int i = 0; i < layer.size(); ++i)
+        {
+            const QVector<int>& adj = neighbours[layer[i]];
+            if (adj.isEmpty())
+            {
+                key[i] = rank[layer[i]];
+                continue;
+            }
+            double sum = 0.0;
+            for (int u : adj)
+                sum += rank[u];
+            key[i] = sum / adj.size();
+        }
+
+        QVector<int> order(layer.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return key[a] < key[b]; });
+
+        QVector<int> sorted(layer.size());
+        for (int i = 0; i < order.size(); ++i)
+        {
+            sorted[i] = layer[order[i]];
+            rank[sorted[i]] = (i + 0.5) / layer.size();
+        }
+        layer = std::move(sorted);
+    }
+} // namespace
+
+LayeredLayout::LayeredLayout(const Options& options)
+    : m_options(options)
+{}
+
+QHash<qint64, QPointF>
+LayeredLayout::run(const GraphSnapshot& snapshot, const QSet<qint64>& subset) const
+{
+    const LayoutGraph graph = buildGraph(snapshot, subset);
+    const int n = graph.records.size();
+    if (n == 0)
+        return {};
+
+    QVector<int> layerOf;
+    QVector<QVector<int>> layers = assignLayers(graph, layerOf);
+
+    // Crossing reduction. Long edges compare normalized ranks, so no dummy nodes are needed.
+    QVector<double> rank(n);
+    for (const QVector<int>& layer : std::as_const(layers))
+        for (int i = 0; i < layer.size(); ++i)
+            rank[layer[i]] = (i + 0.5) / layer.size();
+
+    for (int sweep = 0; sweep < m_options.sweeps; ++sweep)
+    {
+        for (int l = 1; l < layers.size(); ++l)
+            orderLayer(layers[l], graph.predecessors, rank);
+        for (int l = layers.size() - 2; l >= 0; --l)
+            orderLayer(layers[l], graph.successors, rank);
+    }
+
+    // Coordinate assignment: one column per layer, nodes pulled towards their predecessors.
+    QVector<QPointF> local(n);
+    qreal x = 0.0;
+    qreal minY = std::numeric_limits<qreal>::max();
+    for (const QVector<int>& layer : std::as_const(layers))
+    {
+        qreal columnWidth = 0.0;
+        for (int v : layer)
+            columnWidth = std::max(columnWidth, graph.records[v]->size.width());
+
+        qreal bottom = -std::numeric_limits<qreal>::max();
+        qreal drift = 0.0;
+        int pulled = 0;
+        for (int v : layer)
+        {
+            const qreal height = graph.records[v]->size.height();
+            qreal top = bottom == -std::numeric_limits<qreal>::max() ? 0.0 : bottom + m_options.nodeSpacing;
+            const QVector<int>& preds = graph.predecessors[v];
+            if (!preds.isEmpty())
+            {
+                qreal centre = 0.0;
+                for (int u : preds)
+                    centre += local[u].y() + graph.records[u]->size.height() / 2;
+                const qreal desired = centre / preds.size() - height / 2;
+                if (bottom == -std::numeric_limits<qreal>::max() || desired > top)
+                    top = desired;
+                drift += top - desired;
+                ++pulled;
+            }
+            local[v] = QPointF(x, top);
+            bottom = top + height;
+        }
+
+        // Overlap resolution only pushes nodes down; lift the column by the mean push.
+        const qreal lift = pulled ? drift / pulled : 0.0;
+        for (int v : layer)
+        {
+            local[v].ry() -= lift;
+            minY = std::min(minY, local[v].y());
+        }
+        x += columnWidth + m_options.layerSpacing;
+    }
+
+    QPointF origin(std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::max());
+    for (NodeRecord const* record : graph.records)
+    {
+        origin.setX(std::min(origin.x(), record->position.x()));
+        origin.setY(std::min(origin.y(), record->position.y()));
+    }
+
+    QHash<qint64, QPointF> positions;
+    positions.reserve(n);
+    for (int v = 0; v < n; ++v)
+        positions.insert(graph.records[v]->uid, origin + QPointF(local[v].x(), local[v].y() - minY));
+    return positions;
+}
@@ -0,0 +1,115 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/NodeDescriptor.hpp"
+
+int
+PortTable::indexOf(PortLabel* port) const
+{
+    for (int i = 0; i < portCount(); ++i)
+        if (m_ports[i].port == port)
+            return i;
+    return -1;
+}
+
+void
+PortTable::addPort(PortLabel* port, Kind kind)
+{
+    const int index = indexOf(port);
+    if (index >= 0)
+    {
+        m_ports[index].kind = kind;
+        return;
+    }
+    m_ports.append(Port{port, kind, connectionCount()});
+}
+
+bool
+PortTable::removePort(PortLabel* port)
+{
+    const int index = indexOf(port);
+    if (index < 0)
+        return false;
+
+    const int first = edgeBegin(index);
+    const int removed = m_ports[index].edgeEnd - first;
+    m_edges.erase(m_edges.begin() + first, m_edges.begin() + first + removed);
+    m_ports.erase(m_ports.begin() + index);
+    for (int i = index; i < portCount(); ++i)
+        m_ports[i].edgeEnd -= removed;
+    return true;
+}
+
+void
+PortTable::addConnection(PortLabel* port, Kind kind, ConnectionItem* connection)
+{
+    int index = indexOf(port);
+    if (index < 0)
+    {
+        addPort(port, kind);
+        index = indexOf(port);
+    }
+
+    m_edges.insert(m_ports[index].edgeEnd, connection);
+    for (int i = index; i < portCount(); ++i)
+        ++m_ports[i].edgeEnd;
+}
+
+int
+PortTable::removeConnection(ConnectionItem* connection)
+{
+    // Compact the edge array in place, shifting each port's end by what was dropped before it.
+    int kept = 0;
+    int read = 0;
+    for (Port& entry : m_ports)
+    {
+        for (; read < entry.edgeEnd; ++read)
+            if (m_edges[read] != connection)
+                m_edges[kept++] = m_edges[read];
+        entry.edgeEnd = kept;
+    }
+    const int removed = connectionCount() - kept;
+    m_edges.resize(kept);
+    return removed;
+}
+
+PortTable::Connections
+PortTable::connections(PortLabel* port) const
+{
+    const int index = indexOf(port);
+    return index < 0 ? Connections() : connectionsAt(index);
+}
+
+PortTable::Connections
+PortTable::connectionsAt(int index) const
+{
+    return Connections(m_edges.constData() + edgeBegin(index), m_edges.constData() + m_ports[index].edgeEnd);
+}
+
+void
+PortTable::clear()
+{
+    m_ports.clear();
+    m_edges.clear();
+}
@@ -0,0 +1,222 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/NodeProfiler.hpp"
+
+#include <QDebug>
+#include <QFile>
+#include <QMutexLocker>
+#include <QTextStream>
+#include <algorithm>
+#include <chrono>
+
+#if defined(Q_OS_UNIX)
+#include <time.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#endif
+
+// ================================
+// Scope
+// ================================
+
+NodeProfiler::Scope::Scope(NodeProfiler& profiler, qint64 uid, qint64 queueWaitNs)
+    : m_profiler(profiler.isEnabled() ? &profiler : nullptr)
+    , m_uid(uid)
+{
+    if (!m_profiler)
+        return;
+    m_sample.queueWaitNs = queueWaitNs;
+    m_wallStart = wallClockNs();
+    m_cpuStart = threadCpuNs();
+}
+
+NodeProfiler::Scope::~Scope()
+{
+    if (!m_profiler)
+        return;
+    m_sample.wallNs = wallClockNs() - m_wallStart;
+    m_sample.cpuNs = threadCpuNs() - m_cpuStart;
+    m_profiler->record(m_uid, m_sample);
+}
+
+// ================================
+// NodeProfiler
+// ================================
+
+void
+NodeProfiler::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+bool
+NodeProfiler::isEnabled() const
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+void
+NodeProfiler::record(qint64 uid, const NodeProfileSample& sample)
+{
+    if (!isEnabled())
+        return;
+
+    {
+        QMutexLocker lock(&m_mutex);
+        NodeProfileStats& s = m_stats[uid];
+        s.uid = uid;
+        ++s.invocations;
+        s.wallNs += sample.wallNs;
+        s.cpuNs += sample.cpuNs;
+        s.maxWallNs = std::max(s.maxWallNs, sample.wallNs);
+        s.bytesIn += sample.bytesIn;
+        s.bytesOut += sample.bytesOut;
+        s.queueWaitNs += sample.queueWaitNs;
+    }
+    m_revision.fetch_add(1, std::memory_order_release);
+}
+
+QVector<NodeProfileStats>
+NodeProfiler::stats() const
+{
+    QVector<NodeProfileStats> all;
+    {
+        QMutexLocker lock(&m_mutex);
+        all.reserve(m_stats.size());
+        for (const NodeProfileStats& s : m_stats)
+            all.append(s);
+    }
+
+    std::sort(all.begin(), all.end(), [](const NodeProfileStats& a, const NodeProfileStats& b) {
+        return a.wallNs != b.wallNs ? a.wallNs > b.wallNs : a.uid < b.uid;
+    });
+    // Ties share the rank of the first of them.
+    const int last = all.size() - 1;
+    for (int i = 0, rank = 0; i <= last; ++i)
+    {
+        if (i > 0 && all[i].wallNs != all[i - 1].wallNs)
+            rank = i;
+        all[i].percentile = last > 0 ? 1.0 - static_cast<double>(rank) / last : 1.0;
+    }
+    return all;
+}
+
+NodeProfileStats
+NodeProfiler::stats(qint64 uid) const
+{
+    QMutexLocker lock(&m_mutex);
+    NodeProfileStats s = m_stats.value(uid);
+    s.uid = uid;
+    return s;
+}
+
+void
+NodeProfiler::remove(qint64 uid)
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        if (!m_stats.remove(uid))
+            return;
+    }
+    m_revision.fetch_add(1, std::memory_order_release);
+}
+
+void
+NodeProfiler::reset()
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        m_stats.clear();
+    }
+    m_revision.fetch_add(1, std::memory_order_release);
+}
+
+quint64
+NodeProfiler::revision() const
+{
+    return m_revision.load(std::memory_order_acquire);
+}
+
+QString
+NodeProfiler::toCsv(const std::function<QString(qint64)>& nameOf) const
+{
+    QString csv;
+    QTextStream out(&csv);
+    out << "uid,name,invocations,wall_ms,cpu_ms,mean_wall_ms,max_wall_ms,bytes_in,bytes_out,queue_wait_ms,"
+           "percentile\n";
+    for (const NodeProfileStats& s : stats())
+    {
+        QString name = nameOf ? nameOf(s.uid) : QString::number(s.uid);
+        if (name.contains(',') || name.contains('"') || name.contains('\n'))
+            name = '"' + name.replace(QStringLiteral("\""), QStringLiteral("\"\"")) + '"';
+        out << s.uid << ',' << name << ',' << s.invocations << ',' << s.wallNs / 1e6 << ',' << s.cpuNs / 1e6 << ','
+            << s.meanWallMs() << ',' << s.maxWallNs / 1e6 << ',' << s.bytesIn << ',' << s.bytesOut << ','
+            << s.queueWaitNs / 1e6 << ',' << s.percentile << '\n';
+    }
+    out.flush();
+    return csv;
+}
+
+bool
+NodeProfiler::exportCsv(const QString& path, const std::function<QString(qint64)>& nameOf) const
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+        qWarning() << "NodeProfiler: cannot write" << path << ':' << file.errorString();
+        return false;
+    }
+    file.write(toCsv(nameOf).toUtf8());
+    return true;
+}
+
+qint64
+NodeProfiler::wallClockNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+qint64
+NodeProfiler::threadCpuNs()
+{
+#if defined(Q_OS_UNIX)
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<qint64>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#elif defined(Q_OS_WIN)
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        return 0;
+    const auto ticks = [](const FILETIME& t) {
+        return (static_cast<qint64>(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+    };
+    // FILETIME counts 100 ns ticks.
+    return (ticks(kernel) + ticks(user)) * 100;
+#else
+    return 0;
+#endif
+}
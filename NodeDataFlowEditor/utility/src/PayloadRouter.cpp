@@ -0,0 +1,123 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/PayloadRouter.hpp"
+#include "utility/GraphSnapshot.hpp"
+
+#include <QDebug>
+#include <QMutexLocker>
+
+namespace
+{
+    const PortRecord*
+    findPort(const QVector<PortRecord>& ports, PortId id)
+    {
+        for (const PortRecord& port : ports)
+            if (port.id == id)
+                return &port;
+        return nullptr;
+    }
+}
+
+void
+PayloadRouter::setSnapshot(const GraphSnapshot& snapshot)
+{
+    QHash<PortId, QVector<Target>> targets;
+    snapshot.forEachNode([&snapshot, &targets](const NodeRecord& record) {
+        for (const EdgeRecord& edge : record.outgoing)
+        {
+            const PortRecord* from = findPort(record.outputs, edge.fromPortId);
+            const auto to = snapshot.node(edge.toNode);
+            if (!from || !to)
+                continue;
+            const PortRecord* input = findPort(to->inputs, edge.toPortId);
+            if (!input)
+                input = findPort(to->parameters, edge.toPortId);
+            if (!input)
+                continue;
+
+            if ((from->tags & input->tags).none())
+            {
+                qWarning() << "PayloadRouter: ports" << record.name + "." + edge.fromPort << "and"
+                           << to->name + "." + edge.toPort << "share no tag; connection not routed";
+                continue;
+            }
+            targets[edge.fromPortId].append({input->id, input->tags});
+        }
+    });
+
+    QMutexLocker lock(&m_mutex);
+    m_targets = std::move(targets);
+}
+
+int
+PayloadRouter::publish(PortId output, const Payload& payload)
+{
+    QMutexLocker lock(&m_mutex);
+    const auto it = m_targets.constFind(output);
+    if (it == m_targets.constEnd())
+        return 0;
+
+    int delivered = 0;
+    for (const Target& target : it.value())
+    {
+        if (!payload.acceptedBy(target.tags))
+        {
+            qWarning() << "PayloadRouter: payload tag" << TagRegistry::getTagNameByIndex(payload.tag()).data()
+                       << "not accepted by port" << target.port;
+            continue;
+        }
+        m_inputs.insert(target.port, payload);
+        ++delivered;
+    }
+    return delivered;
+}
+
+Payload
+PayloadRouter::input(PortId input) const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_inputs.value(input);
+}
+
+Payload
+PayloadRouter::take(PortId input)
+{
+    QMutexLocker lock(&m_mutex);
+    return m_inputs.take(input);
+}
+
+int
+PayloadRouter::fanOut(PortId output) const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_targets.value(output).size();
+}
+
+void
+PayloadRouter::clear()
+{
+    QMutexLocker lock(&m_mutex);
+    m_inputs.clear();
+}
@@ -0,0 +1,404 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/SearchIndex.hpp"
+#include "taggable/TagRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+
+#include <QSet>
+#include <algorithm>
+
+namespace
+{
+    // Dead terms are only swept once there are more of them than live ones.
+    constexpr int minDeadToCompact = 1024;
+    // Padding before a term, so its first one or two characters form trigrams of their own.
+    const QChar padding(0x1);
+
+    quint64
+    trigramKey(QChar a, QChar b, QChar c)
+    {
+        return (quint64(a.unicode()) << 32) | (quint64(b.unicode()) << 16) | quint64(c.unicode());
+    }
+
+    /// Distinct trigrams of @p text; @p padded adds the two start-of-term trigrams.
+    QVector<quint64>
+    trigramsOf(const QString& text, bool padded)
+    {
+        const QString s = padded ? QString(2, padding) + text : text;
+        QVector<quint64> grams;
+        grams.reserve(std::max(0, int(s.size()) - 2));
+        for (int i = 0; i + 2 < s.size(); ++i)
+            grams.append(trigramKey(s[i], s[i + 1], s[i + 2]));
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    bool
+    samePorts(const QVector<PortRecord>& a, const QVector<PortRecord>& b)
+    {
+        return std::equal(a.cbegin(), a.cend(), b.cbegin(), b.cend(), [](const PortRecord& x, const PortRecord& y) {
+            return x.id == y.id && x.name == y.name && x.displayName == y.displayName && x.tags == y.tags;
+        });
+    }
+
+    /// Whether the two records carry the same searchable text.
+    bool
+    sameText(const NodeRecord& a, const NodeRecord& b)
+    {
+        return a.name == b.name && a.displayedName == b.displayedName && samePorts(a.inputs, b.inputs) &&
+               samePorts(a.outputs, b.outputs) && samePorts(a.parameters, b.parameters);
+    }
+
+    /// Calls @p fn(i) for every i such that ids[i] is in @p list; both are ascending.
+    template <typename Fn>
+    void
+    forEachShared(const std::vector<int>& ids, const QVector<int>& list, Fn&& fn)
+    {
+        // Merge lists of similar size; gallop through a much longer one.
+        const bool merge = std::size_t(list.size()) <= 16 * ids.size();
+        auto pos = list.cbegin();
+        for (std::size_t i = 0; i < ids.size() && pos != list.cend(); ++i)
+        {
+            if (merge)
+                while (pos != list.cend() && *pos < ids[i])
+                    ++pos;
+            else
+                pos = std::lower_bound(pos, list.cend(), ids[i]);
+            if (pos != list.cend() && *pos == ids[i])
+                fn(i);
+        }
+    }
+
+    int
+    lengthPenalty(qsizetype termLength, qsizetype queryLength)
+    {
+        return int(std::clamp<qsizetype>(termLength - queryLength, 0, 50));
+    }
+
+    int
+    fieldBonus(SearchHit::Field field)
+    {
+        switch (field)
+        {
+        case SearchHit::Field::DisplayedName:
+            return 30;
+        case SearchHit::Field::Name:
+            return 20;
+        case SearchHit::Field::Port:
+            return 10;
+        case SearchHit::Field::Tag:
+            return 0;
+        }
+        return 0;
+    }
+
+    /// Highest score SearchIndex::rank() can give a term holding every query trigram.
+    int
+    scoreBound(qsizetype termLength, qsizetype queryLength, SearchHit::Field field, bool prefix)
+    {
+        const int base = !prefix ? 600 : termLength == queryLength ? 1000 : 800;
+        return base + fieldBonus(field) - lengthPenalty(termLength, queryLength);
+    }
+}
+
+void
+SearchIndex::update(std::shared_ptr<const GraphSnapshot> snapshot)
+{
+    if (!snapshot || snapshot == m_snapshot)
+        return;
+
+    if (!m_snapshot)
+    {
+        clear();
+        snapshot->forEachNode([this](const NodeRecord& r) { indexRecord(r); });
+    }
+    else
+    {
+        // Moves and value edits also produce new records; only text changes need re-indexing.
+        snapshot->forEachNodeChange(*m_snapshot, [this](const NodeRecord* before, const NodeRecord* after) {
+            if (before && after && sameText(*before, *after))
+                return;
+            if (before)
+                removeNode(before->uid);
+            if (after)
+                indexRecord(*after);
+        });
+    }
+    m_snapshot = std::move(snapshot);
+
+    if (m_dead >= minDeadToCompact && m_dead > termCount())
+        compact();
+}
+
+void
+SearchIndex::addTerm(qint64 node, SearchHit::Field field, const QString& text, PortId port)
+{
+    if (text.isEmpty())
+        return;
+
+    const int id = int(m_terms.size());
+    m_terms.push_back({text, text.toLower(), node, port, field, true});
+    m_nodeTerms[node].append(id);
+    post(id);
+}
+
+void
+SearchIndex::removeNode(qint64 node)
+{
+    // Posting lists keep the ids; search() skips dead terms until the next compact().
+    const QVector<int> ids = m_nodeTerms.take(node);
+    for (int id : ids)
+    {
+        Term& term = m_terms[id];
+        term.alive = false;
+        term.text.clear();
+        term.folded.clear();
+    }
+    m_dead += ids.size();
+}
+
+void
+SearchIndex::clear()
+{
+    m_terms.clear();
+    m_postings.clear();
+    m_nodeTerms.clear();
+    m_snapshot.reset();
+    m_dead = 0;
+}
+
+int
+SearchIndex::termCount() const
+{
+    return int(m_terms.size()) - m_dead;
+}
+
+QVector<SearchHit>
+SearchIndex::search(const QString& query, int limit) const
+{
+    const QString q = query.trimmed().toLower();
+    if (q.isEmpty() || limit <= 0)
+        return {};
+
+    // One or two characters: the padded start-of-term trigram, i.e. a prefix lookup.
+    QVector<quint64> grams;
+    if (q.size() < 3)
+        grams.append(q.size() == 1 ? trigramKey(padding, padding, q[0]) : trigramKey(padding, q[0], q[1]));
+    else
+        grams = trigramsOf(q, false);
+
+    auto postings = [this](quint64 gram) {
+        static const QVector<int> none;
+        auto it = m_postings.constFind(gram);
+        return it == m_postings.constEnd() ? &none : &*it;
+    };
+
+    std::vector<const QVector<int>*> lists;
+    lists.reserve(grams.size());
+    for (quint64 gram : std::as_const(grams))
+        lists.push_back(postings(gram));
+    std::sort(lists.begin(), lists.end(), [](auto* a, auto* b) { return a->size() < b->size(); });
+    const int n = int(lists.size());
+
+    QVector<SearchHit> results;
+    QSet<qint64> seenNodes;
+    QSet<qint64> seenPorts;
+    std::vector<std::pair<int, int>> scored; // (-score, term id), so the natural order is best first.
+
+    // Rescores scored[from, to) exactly; their current scores are upper bounds.
+    auto rescore = [&](std::size_t from, std::size_t to) {
+        for (std::size_t i = from; i < to; ++i)
+            scored[i].first = -rank(m_terms[scored[i].second], q, n, n);
+    };
+
+    // Moves the best of scored into the results, one hit per port and one per node for
+    // its name, title and tags. Only the head is ordered unless duplicates thin it out.
+    // With @p bounded scores, the head is rescored first, and the tail too if one of its
+    // bounds beats the weakest exact score of the head.
+    auto take = [&](bool bounded) {
+        std::size_t head = std::min<std::size_t>(scored.size(), std::size_t(limit) * 4);
+        std::partial_sort(scored.begin(), scored.begin() + head, scored.end());
+        if (bounded)
+        {
+            rescore(0, head);
+            std::sort(scored.begin(), scored.begin() + head);
+            if (head < scored.size() &&
+                std::min_element(scored.begin() + head, scored.end())->first < scored[head - 1].first)
+            {
+                rescore(head, scored.size());
+                std::sort(scored.begin(), scored.end());
+                head = scored.size();
+            }
+        }
+
+        for (std::size_t i = 0; i < scored.size() && results.size() < limit; ++i)
+        {
+            if (i == head)
+            {
+                if (bounded)
+                    rescore(head, scored.size());
+                std::sort(scored.begin() + head, scored.end());
+            }
+            const Term& term = m_terms[scored[i].second];
+            QSet<qint64>& seen = term.port != invalidGraphId ? seenPorts : seenNodes;
+            const qint64 key = term.port != invalidGraphId ? qint64(term.port) : term.node;
+            if (seen.contains(key))
+                continue;
+            seen.insert(key);
+            results.append({term.node, term.port, term.field, term.text, -scored[i].first});
+        }
+    };
+
+    // Terms holding every trigram, intersected from the rarest list up.
+    std::vector<int> exact(lists[0]->cbegin(), lists[0]->cend());
+    for (int i = 1; i < n && !exact.empty(); ++i)
+    {
+        std::size_t kept = 0;
+        forEachShared(exact, *lists[i], [&](std::size_t k) { exact[kept++] = exact[k]; });
+        exact.resize(kept);
+    }
+
+    // Scoring a full match reads its text, which is slow for thousands of terms, so
+    // they are ranked on an upper bound first. Prefix matches also hold the padded
+    // start trigrams of the query, which the posting lists answer without the text.
+    std::vector<char> prefix(exact.size(), 1);
+    if (q.size() >= 3)
+    {
+        for (quint64 gram : {trigramKey(padding, padding, q[0]), trigramKey(padding, q[0], q[1])})
+        {
+            std::vector<char> starts(exact.size(), 0);
+            forEachShared(exact, *postings(gram), [&starts](std::size_t k) { starts[k] = 1; });
+            for (std::size_t k = 0; k < exact.size(); ++k)
+                prefix[k] &= starts[k];
+        }
+    }
+    for (std::size_t k = 0; k < exact.size(); ++k)
+    {
+        const Term& term = m_terms[exact[k]];
+        if (term.alive)
+            scored.emplace_back(-scoreBound(term.folded.size(), q.size(), term.field, prefix[k]), exact[k]);
+    }
+    take(true);
+
+    // Fuzzy matches always rank below the full ones, so they are only needed to fill up.
+    // A term missing at most maxMissing trigrams is in one of the maxMissing + 1 rarest lists.
+    const int maxMissing = n / 3;
+    if (results.size() >= limit || maxMissing == 0)
+        return results;
+
+    std::vector<int> candidates;
+    for (int i = 0; i <= maxMissing; ++i)
+        candidates.insert(candidates.end(), lists[i]->cbegin(), lists[i]->cend());
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    std::vector<int> matched(candidates.size(), 0);
+    for (int i = 0; i < n; ++i)
+        forEachShared(candidates, *lists[i], [&matched](std::size_t k) { ++matched[k]; });
+
+    scored.clear();
+    for (std::size_t k = 0; k < candidates.size(); ++k)
+    {
+        const Term& term = m_terms[candidates[k]];
+        if (term.alive && matched[k] >= n - maxMissing && matched[k] < n)
+            scored.emplace_back(-rank(term, q, matched[k], n), candidates[k]);
+    }
+    take(false);
+    return results;
+}
+
+int
+SearchIndex::rank(const Term& term, const QString& query, int matched, int total)
+{
+    // Match classes are 200 apart so field and length adjustments never reorder them.
+    int score;
+    if (matched < total)
+        score = 200 * matched / total;
+    else if (term.folded == query)
+        score = 1000;
+    else if (term.folded.startsWith(query))
+        score = 800;
+    else if (const int pos = int(term.folded.indexOf(query)); pos >= 0)
+        score = 600 - std::min(pos, 50);
+    else
+        score = 400;
+    return score + fieldBonus(term.field) - lengthPenalty(term.folded.size(), query.size());
+}
+
+void
+SearchIndex::indexRecord(const NodeRecord& record)
+{
+    addTerm(record.uid, SearchHit::Field::Name, record.name);
+    if (record.displayedName != record.name)
+        addTerm(record.uid, SearchHit::Field::DisplayedName, record.displayedName);
+
+    TagBitMask tags;
+    for (const QVector<PortRecord>* ports : {&record.inputs, &record.outputs, &record.parameters})
+    {
+        for (const PortRecord& port : *ports)
+        {
+            addTerm(record.uid, SearchHit::Field::Port, port.name, port.id);
+            if (port.displayName != port.name)
+                addTerm(record.uid, SearchHit::Field::Port, port.displayName, port.id);
+            tags |= port.tags;
+        }
+    }
+
+    for (std::size_t i = 0; i < tags.size(); ++i)
+    {
+        if (!tags.test(i))
+            continue;
+        const std::string_view name = TagRegistry::getTagNameByIndex(i);
+        addTerm(record.uid, SearchHit::Field::Tag, QString::fromLatin1(name.data(), int(name.size())));
+    }
+}
+
+void
+SearchIndex::compact()
+{
+    std::vector<Term> terms;
+    terms.reserve(std::size_t(termCount()));
+    for (Term& term : m_terms)
+        if (term.alive)
+            terms.push_back(std::move(term));
+
+    m_terms = std::move(terms);
+    m_postings.clear();
+    m_nodeTerms.clear();
+    m_dead = 0;
+    for (int id = 0; id < int(m_terms.size()); ++id)
+    {
+        m_nodeTerms[m_terms[id].node].append(id);
+        post(id);
+    }
+}
+
+void
+SearchIndex::post(int id)
+{
+    for (quint64 gram : trigramsOf(m_terms[id].folded, true))
+        m_postings[gram].append(id);
+}
@@ -0,0 +1,352 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/StreamPipeline.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "utility/NodeProfiler.hpp"
+#include "utility/SpscQueue.hpp"
+
+#include <QDebug>
+#include <QThread>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    // Spins briefly, then sleeps, while a queue is full or empty.
+    class Backoff
+    {
+    public:
+        void
+        wait()
+        {
+            constexpr int spins = 64;
+            if (++m_rounds < spins)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+
+    private:
+        int m_rounds = 0;
+    };
+}
+
+struct StreamPipeline::Edge
+{
+    Edge(const EdgeRecord& r, int capacity)
+        : record(r)
+        , queue(static_cast<std::size_t>(capacity))
+    {}
+
+    EdgeRecord record;
+    SpscQueue<Payload> queue;
+    std::atomic<bool> closed{false};    ///< Set by the producer once it has pushed its last frame.
+    std::atomic<bool> abandoned{false}; ///< Set by the consumer once it reads no more frames.
+    std::atomic<int> maxDepth{0};
+    std::atomic<quint64> frames{0};
+    std::atomic<qint64> blockedNs{0};
+};
+
+struct StreamPipeline::Stage
+{
+    qint64 uid = -1;
+    QString name;
+    StreamStage fn;
+    QVector<Edge*> inputs;
+    QVector<Edge*> outputs;
+    std::atomic<quint64> frames{0};
+    std::unique_ptr<QThread> thread;
+};
+
+StreamPipeline::StreamPipeline(std::shared_ptr<const GraphSnapshot> snapshot, int queueCapacity)
+    : m_snapshot(std::move(snapshot))
+    , m_queueCapacity(std::max(queueCapacity, 1))
+{
+    if (!m_snapshot)
+        return;
+
+    m_snapshot->forEachNode([this](const NodeRecord& record) {
+        auto stage = std::make_unique<Stage>();
+        stage->uid = record.uid;
+        stage->name = record.name;
+        m_stageByUid.insert(record.uid, stage.get());
+        m_stages.push_back(std::move(stage));
+    });
+    for (const EdgeRecord& record : m_snapshot->edges())
+    {
+        Stage* from = m_stageByUid.value(record.fromNode);
+        Stage* to = m_stageByUid.value(record.toNode);
+        if (!from || !to)
+            continue;
+        m_edges.push_back(std::make_unique<Edge>(record, m_queueCapacity));
+        from->outputs.append(m_edges.back().get());
+        to->inputs.append(m_edges.back().get());
+    }
+}
+
+StreamPipeline::~StreamPipeline()
+{
+    stop();
+}
+
+bool
+StreamPipeline::setStage(qint64 uid, StreamStage stage)
+{
+    Stage* target = m_stageByUid.value(uid);
+    if (!target || m_started)
+        return false;
+    target->fn = std::move(stage);
+    return true;
+}
+
+bool
+StreamPipeline::setStage(const QString& nodeName, StreamStage stage)
+{
+    for (const auto& candidate : m_stages)
+        if (candidate->name == nodeName)
+            return setStage(candidate->uid, std::move(stage));
+    return false;
+}
+
+void
+StreamPipeline::setProfiler(std::shared_ptr<NodeProfiler> profiler)
+{
+    m_profiler = std::move(profiler);
+}
+
+bool
+StreamPipeline::start()
+{
+    if (m_started)
+        return false;
+
+    for (const auto& stage : m_stages)
+    {
+        if (!stage->fn && (!stage->inputs.isEmpty() || !stage->outputs.isEmpty()))
+        {
+            qWarning() << "StreamPipeline: connected node" << stage->name << "has no stage";
+            return false;
+        }
+    }
+    if (hasCycle())
+    {
+        qWarning() << "StreamPipeline: the graph has a cycle";
+        return false;
+    }
+
+    m_started = true;
+    for (const auto& stage : m_stages)
+    {
+        if (!stage->fn)
+            continue;
+        Stage* s = stage.get();
+        stage->thread.reset(QThread::create([this, s] { run(*s); }));
+        stage->thread->start();
+    }
+    return true;
+}
+
+void
+StreamPipeline::stop()
+{
+    m_stopping = true;
+    waitForFinished();
+}
+
+void
+StreamPipeline::waitForFinished()
+{
+    for (const auto& stage : m_stages)
+        if (stage->thread)
+            stage->thread->wait();
+}
+
+bool
+StreamPipeline::isRunning() const
+{
+    for (const auto& stage : m_stages)
+        if (stage->thread && stage->thread->isRunning())
+            return true;
+    return false;
+}
+
+quint64
+StreamPipeline::frames(qint64 uid) const
+{
+    Stage const* stage = m_stageByUid.value(uid);
+    return stage ? stage->frames.load() : 0;
+}
+
+QVector<EdgeQueueMetrics>
+StreamPipeline::edgeMetrics() const
+{
+    QVector<EdgeQueueMetrics> metrics;
+    metrics.reserve(static_cast<int>(m_edges.size()));
+    for (const auto& edge : m_edges)
+    {
+        EdgeQueueMetrics m;
+        m.connection = edge->record.id;
+        m.fromNode = edge->record.fromNode;
+        m.fromPort = edge->record.fromPort;
+        m.toNode = edge->record.toNode;
+        m.toPort = edge->record.toPort;
+        m.capacity = m_queueCapacity;
+        m.depth = static_cast<int>(edge->queue.size());
+        m.maxDepth = edge->maxDepth.load();
+        m.frames = edge->frames.load();
+        m.blockedNs = edge->blockedNs.load();
+        metrics.append(m);
+    }
+    return metrics;
+}
+
+void
+StreamPipeline::run(Stage& stage)
+{
+    for (quint64 index = 0; !m_stopping.load(std::memory_order_relaxed); ++index)
+    {
+        StreamFrame frame;
+        frame.m_index = index;
+
+        const qint64 waitStart = NodeProfiler::wallClockNs();
+        bool ended = false;
+        for (Edge* edge : std::as_const(stage.inputs))
+        {
+            Payload payload;
+            if (!pop(*edge, payload))
+            {
+                ended = true;
+                break;
+            }
+            frame.m_inputs.insert(edge->record.toPort, std::move(payload));
+        }
+        if (ended)
+            break;
+
+        try
+        {
+            std::optional<NodeProfiler::Scope> scope;
+            if (m_profiler)
+                scope.emplace(*m_profiler, stage.uid, NodeProfiler::wallClockNs() - waitStart);
+            stage.fn(frame);
+        }
+        catch (const std::exception& e)
+        {
+            qWarning() << "StreamPipeline: stage" << stage.name << "failed:" << e.what();
+            break;
+        }
+        ++stage.frames;
+
+        // Keep going while at least one consumer still reads.
+        bool delivered = stage.outputs.isEmpty();
+        for (Edge* edge : std::as_const(stage.outputs))
+            if (push(*edge, frame.m_outputs.value(edge->record.fromPort)))
+                delivered = true;
+
+        if (frame.m_finished || !delivered)
+            break;
+    }
+
+    // Producers blocked on a full input must not wait for a stage that has stopped.
+    for (Edge* edge : std::as_const(stage.inputs))
+        edge->abandoned.store(true, std::memory_order_release);
+    for (Edge* edge : std::as_const(stage.outputs))
+        edge->closed.store(true, std::memory_order_release);
+}
+
+bool
+StreamPipeline::push(Edge& edge, Payload payload)
+{
+    if (edge.abandoned.load(std::memory_order_acquire))
+        return false;
+
+    if (!edge.queue.tryPush(std::move(payload)))
+    {
+        const qint64 start = NodeProfiler::wallClockNs();
+        Backoff backoff;
+        while (!edge.queue.tryPush(std::move(payload)))
+        {
+            if (m_stopping.load(std::memory_order_relaxed) || edge.abandoned.load(std::memory_order_acquire))
+                return false;
+            backoff.wait();
+        }
+        edge.blockedNs += NodeProfiler::wallClockNs() - start;
+    }
+
+    ++edge.frames;
+    const int depth = static_cast<int>(edge.queue.size());
+    int seen = edge.maxDepth.load(std::memory_order_relaxed);
+    while (depth > seen && !edge.maxDepth.compare_exchange_weak(seen, depth))
+    {
+    }
+    return true;
+}
+
+bool
+StreamPipeline::pop(Edge& edge, Payload& payload)
+{
+    Backoff backoff;
+    while (!edge.queue.tryPop(payload))
+    {
+        // The producer closes the edge after its last push, so drain once more.
+        if (edge.closed.load(std::memory_order_acquire))
+            return edge.queue.tryPop(payload);
+        if (m_stopping.load(std::memory_order_relaxed))
+            return false;
+        backoff.wait();
+    }
+    return true;
+}
+
+bool
+StreamPipeline::hasCycle() const
+{
+    QHash<Stage const*, int> pending;
+    QVector<Stage const*> ready;
+    for (const auto& stage : m_stages)
+    {
+        pending.insert(stage.get(), stage->inputs.size());
+        if (stage->inputs.isEmpty())
+            ready.append(stage.get());
+    }
+
+    std::size_t visited = 0;
+    while (!ready.isEmpty())
+    {
+        Stage const* stage = ready.takeLast();
+        ++visited;
+        for (Edge const* edge : stage->outputs)
+        {
+            Stage const* next = m_stageByUid.value(edge->record.toNode);
+            if (--pending[next] == 0)
+                ready.append(next);
+        }
+    }
+    return visited != m_stages.size();
+}
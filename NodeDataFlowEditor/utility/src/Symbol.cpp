@@ -0,0 +1,211 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/Symbol.hpp"
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QVector>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+
+namespace
+{
+    constexpr quint32 chunkBits = 10;
+    constexpr quint32 chunkSize = 1u << chunkBits;
+    constexpr quint32 maxChunks = 4096; ///< Room for four million live strings.
+
+    struct Entry
+    {
+        QString text;
+        std::atomic<int> refs{0}; ///< Symbols referring to this entry.
+    };
+
+    /**
+     * Entries live in fixed chunks that never move, so a Symbol can reach its
+     * counter and text without the lock; the lock only guards the text → id
+     * map, the free list and the creation of chunks.
+     */
+    struct SymbolTable
+    {
+        QReadWriteLock lock;
+        QHash<QString, quint32> ids;
+        QVector<quint32> freeIds; ///< Released indices, reused before growing.
+        quint32 nextId = 1;       ///< Index 0 is the null symbol.
+        std::array<std::atomic<Entry*>, maxChunks> chunks{};
+
+        ~SymbolTable()
+        {
+            for (auto& chunk : chunks)
+                delete[] chunk.load(std::memory_order_relaxed);
+        }
+    };
+
+    SymbolTable& table()
+    {
+        static SymbolTable instance;
+        return instance;
+    }
+
+    Entry& entry(SymbolTable& t, quint32 id)
+    {
+        return t.chunks[id >> chunkBits].load(std::memory_order_acquire)[id & (chunkSize - 1)];
+    }
+
+    quint32 intern(const QString& text)
+    {
+        if (text.isEmpty())
+            return 0;
+
+        SymbolTable& t = table();
+        {
+            // A count raised under the read lock keeps a concurrent release from freeing the entry.
+            QReadLocker read(&t.lock);
+            auto it = t.ids.constFind(text);
+            if (it != t.ids.constEnd())
+            {
+                entry(t, it.value()).refs.fetch_add(1, std::memory_order_relaxed);
+                return it.value();
+            }
+        }
+
+        QWriteLocker write(&t.lock);
+        auto it = t.ids.constFind(text);
+        if (it != t.ids.constEnd())
+        {
+            entry(t, it.value()).refs.fetch_add(1, std::memory_order_relaxed);
+            return it.value();
+        }
+
+        quint32 id = 0;
+        if (!t.freeIds.isEmpty())
+            id = t.freeIds.takeLast();
+        else
+        {
+            id = t.nextId++;
+            if (id >> chunkBits >= maxChunks)
+                qFatal("Symbol: more than %u names interned at once", maxChunks * chunkSize);
+            std::atomic<Entry*>& chunk = t.chunks[id >> chunkBits];
+            if (!chunk.load(std::memory_order_relaxed))
+                chunk.store(new Entry[chunkSize], std::memory_order_release);
+        }
+        Entry& e = entry(t, id);
+        e.text = text;
+        e.refs.store(1, std::memory_order_relaxed);
+        t.ids.insert(text, id);
+        return id;
+    }
+
+    void retain(quint32 id)
+    {
+        if (id != 0)
+            entry(table(), id).refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release(quint32 id)
+    {
+        if (id == 0)
+            return;
+        SymbolTable& t = table();
+        Entry& e = entry(t, id);
+        if (e.refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        // Another thread may have interned the text again, or already freed the entry, meanwhile.
+        QWriteLocker write(&t.lock);
+        if (e.refs.load(std::memory_order_relaxed) != 0 || e.text.isEmpty())
+            return;
+        t.ids.remove(e.text);
+        e.text = QString();
+        t.freeIds.append(id);
+    }
+} // namespace
+
+Symbol::Symbol(const QString& text)
+    : m_id(intern(text))
+{}
+
+Symbol::Symbol(const char* text)
+    : m_id(intern(QString::fromUtf8(text)))
+{}
+
+Symbol::Symbol(const Symbol& other) noexcept
+    : m_id(other.m_id)
+{
+    retain(m_id);
+}
+
+Symbol::Symbol(Symbol&& other) noexcept
+    : m_id(other.m_id)
+{
+    other.m_id = 0;
+}
+
+Symbol&
+Symbol::operator=(const Symbol& other) noexcept
+{
+    if (m_id != other.m_id)
+    {
+        retain(other.m_id);
+        release(m_id);
+        m_id = other.m_id;
+    }
+    return *this;
+}
+
+Symbol&
+Symbol::operator=(Symbol&& other) noexcept
+{
+    if (this != &other)
+    {
+        release(m_id);
+        m_id = other.m_id;
+        other.m_id = 0;
+    }
+    return *this;
+}
+
+Symbol::~Symbol()
+{
+    release(m_id);
+}
+
+QString
+Symbol::toString() const
+{
+    if (m_id == 0)
+        return {};
+
+    // This symbol holds a reference, so the entry's text cannot change under us.
+    return entry(table(), m_id).text;
+}
+
+int
+Symbol::internedCount()
+{
+    SymbolTable& t = table();
+    QReadLocker read(&t.lock);
+    return static_cast<int>(t.ids.size());
+}
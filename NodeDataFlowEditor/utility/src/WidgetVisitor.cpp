@@ -24,8 +24,9 @@
 
 #include "utility/WidgetVisitor.hpp"
 #include "utility/GraphRegistry.hpp"
+#include "utility/GroupDescriptor.hpp"
 #include "view/GroupItem.hpp"
-#include "view/NodeItem.hpp"
+#include "view/ParameterBinder.hpp"
 #include "view/PortLabel.hpp"
 
 #include <QCalendarWidget>
@@ -45,6 +46,7 @@
 #include <QToolButton>
 #include <QTreeWidget>
 #include <QVBoxLayout>
+#include <utility>
 
 WidgetVisitor::WidgetVisitor(std::shared_ptr<GraphRegistry> registry, PortLabel* p, const QString& n, GroupItem* g)
     : m_port(p)
@@ -114,6 +116,39 @@ WidgetVisitor::visit(QWidget* w)
         visitGenericContainer(w);
 }
 
+QWidget*
+WidgetVisitor::clone(QWidget* w)
+{
+    if (!isEditor(w))
+        return nullptr;
+
+    m_capture = true;
+    m_clone = nullptr;
+    visit(w);
+    m_capture = false;
+    return std::exchange(m_clone, nullptr);
+}
+
+void
+WidgetVisitor::collectForwards(QVector<ForwardRule>& forwards)
+{
+    m_forwards = &forwards;
+}
+
+bool
+WidgetVisitor::isEditor(const QWidget* w)
+{
+    return qobject_cast<const QLineEdit*>(w) || qobject_cast<const QPlainTextEdit*>(w) ||
+           qobject_cast<const QTextEdit*>(w) || qobject_cast<const QSpinBox*>(w) ||
+           qobject_cast<const QDoubleSpinBox*>(w) || qobject_cast<const QComboBox*>(w) ||
+           qobject_cast<const QCheckBox*>(w) || qobject_cast<const QRadioButton*>(w) ||
+           qobject_cast<const QSlider*>(w) || qobject_cast<const QDial*>(w) ||
+           qobject_cast<const QDateTimeEdit*>(w) || qobject_cast<const QCalendarWidget*>(w) ||
+           qobject_cast<const QListWidget*>(w) || qobject_cast<const QTableWidget*>(w) ||
+           qobject_cast<const QTreeWidget*>(w) || qobject_cast<const QProgressBar*>(w) ||
+           qobject_cast<const QPushButton*>(w) || qobject_cast<const QToolButton*>(w);
+}
+
 // ---------------------- Basic widgets ----------------------
 void
 WidgetVisitor::visitLineEdit(QLineEdit* w)
@@ -123,12 +158,7 @@ WidgetVisitor::visitLineEdit(QLineEdit* w)
     clone->setAlignment(w->alignment());
     clone->setReadOnly(w->isReadOnly());
 
-    QObject::connect(clone.get(), &QLineEdit::textChanged, [this](const QString& val) {
-        auto map = dynamic_cast<NodeItem*>(m_port->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QLineEdit*>(it.key()))
-                ww->setText(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -140,13 +170,7 @@ WidgetVisitor::visitPlainTextEdit(QPlainTextEdit* w)
     auto clone = std::make_unique<QPlainTextEdit>();
     clone->setPlainText(w->toPlainText());
 
-    QObject::connect(clone.get(), &QPlainTextEdit::textChanged, [clone_ptr = clone.get(), p = this->m_port] {
-        QString val = clone_ptr->toPlainText();
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QPlainTextEdit*>(it.key()))
-                ww->setPlainText(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -158,13 +182,7 @@ WidgetVisitor::visitTextEdit(QTextEdit* w)
     auto clone = std::make_unique<QTextEdit>();
     clone->setPlainText(w->toPlainText());
 
-    QObject::connect(clone.get(), &QTextEdit::textChanged, [clone_ptr = clone.get(), p = this->m_port] {
-        QString val = clone_ptr->toPlainText();
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QTextEdit*>(it.key()))
-                ww->setPlainText(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -178,12 +196,7 @@ WidgetVisitor::visitSpinBox(QSpinBox* w)
     clone->setSingleStep(w->singleStep());
     clone->setValue(w->value());
 
-    QObject::connect(clone.get(), qOverload<int>(&QSpinBox::valueChanged), [p = this->m_port](int val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QSpinBox*>(it.key()))
-                ww->setValue(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -198,12 +211,7 @@ WidgetVisitor::visitDoubleSpinBox(QDoubleSpinBox* w)
     clone->setSingleStep(w->singleStep());
     clone->setValue(w->value());
 
-    QObject::connect(clone.get(), qOverload<double>(&QDoubleSpinBox::valueChanged), [p = this->m_port](double val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QDoubleSpinBox*>(it.key()))
-                ww->setValue(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -217,12 +225,7 @@ WidgetVisitor::visitComboBox(QComboBox* w)
         clone->addItem(w->itemText(i), w->itemData(i));
     clone->setCurrentIndex(w->currentIndex());
 
-    QObject::connect(clone.get(), qOverload<int>(&QComboBox::currentIndexChanged), [p = this->m_port](int idx) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QComboBox*>(it.key()))
-                ww->setCurrentIndex(idx);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -235,12 +238,7 @@ WidgetVisitor::visitCheckBox(QCheckBox* w)
     clone->setText(w->text());
     clone->setChecked(w->isChecked());
 
-    QObject::connect(clone.get(), &QCheckBox::toggled, [p = this->m_port](bool val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QCheckBox*>(it.key()))
-                ww->setChecked(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -253,12 +251,7 @@ WidgetVisitor::visitRadioButton(QRadioButton* w)
     clone->setText(w->text());
     clone->setChecked(w->isChecked());
 
-    QObject::connect(clone.get(), &QRadioButton::toggled, [p = this->m_port](bool val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QRadioButton*>(it.key()))
-                ww->setChecked(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -273,12 +266,7 @@ WidgetVisitor::visitSlider(QSlider* w)
     clone->setSingleStep(w->singleStep());
     clone->setValue(w->value());
 
-    QObject::connect(clone.get(), &QSlider::valueChanged, [p = this->m_port](int val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QSlider*>(it.key()))
-                ww->setValue(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -293,12 +281,7 @@ WidgetVisitor::visitDial(QDial* w)
     clone->setNotchesVisible(w->notchesVisible());
     clone->setWrapping(w->wrapping());
 
-    QObject::connect(clone.get(), &QDial::valueChanged, [p = this->m_port](int val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QDial*>(it.key()))
-                ww->setValue(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -312,12 +295,7 @@ WidgetVisitor::visitDateEdit(QDateEdit* w)
     clone->setCalendarPopup(w->calendarPopup());
     clone->setDate(w->date());
 
-    QObject::connect(clone.get(), &QDateEdit::dateChanged, [p = this->m_port](const QDate& val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QDateEdit*>(it.key()))
-                ww->setDate(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -329,12 +307,7 @@ WidgetVisitor::visitTimeEdit(QTimeEdit* w)
     auto clone = std::make_unique<QTimeEdit>();
     clone->setTime(w->time());
 
-    QObject::connect(clone.get(), &QTimeEdit::timeChanged, [p = this->m_port](const QTime& val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QTimeEdit*>(it.key()))
-                ww->setTime(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -347,12 +320,7 @@ WidgetVisitor::visitDateTimeEdit(QDateTimeEdit* w)
     clone->setCalendarPopup(w->calendarPopup());
     clone->setDateTime(w->dateTime());
 
-    QObject::connect(clone.get(), &QDateTimeEdit::dateTimeChanged, [p = this->m_port](const QDateTime& val) {
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QDateTimeEdit*>(it.key()))
-                ww->setDateTime(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -365,13 +333,7 @@ WidgetVisitor::visitCalendarWidget(QCalendarWidget* w)
     auto clone = std::make_unique<QCalendarWidget>();
     clone->setSelectedDate(w->selectedDate());
 
-    QObject::connect(clone.get(), &QCalendarWidget::selectionChanged, [clone_ptr = clone.get(), p = this->m_port] {
-        QDate val = clone_ptr->selectedDate();
-        auto map = dynamic_cast<NodeItem*>(p->parentItem())->parameterWidgets();
-        for (auto it = map.begin(); it != map.end(); ++it)
-            if (auto ww = qobject_cast<QCalendarWidget*>(it.key()))
-                ww->setSelectedDate(val);
-    });
+    bindToStore(w, clone.get());
 
     addGroupWidget(clone.get());
     clone.release();
@@ -535,14 +497,41 @@ WidgetVisitor::visitUnknown(QWidget* w)
     visitGenericContainer(w);
 }
 
+void
+WidgetVisitor::bindToStore(QWidget* original, QWidget* clone)
+{
+    if (!m_port)
+        return;
+
+    // The node bound the original to its own leaf when it added the parameter;
+    // the clone edits that same value.
+    ParameterBinder& binder = m_registry->parameterBinder();
+    ParameterKey key = binder.keyOf(original);
+    if (key.port == invalidGraphId)
+    {
+        key = binder.nextKey(m_port->id());
+        binder.bind(key, original);
+    }
+    binder.bind(key, clone);
+}
+
 void
 WidgetVisitor::addGroupWidget(QWidget* w)
 {
+    if (m_capture)
+    {
+        m_clone = w;
+        return;
+    }
+
     if (!m_groupItem || !m_port)
         return;
 
     auto* g = m_groupItem->addParameter(w, m_name);
     g->setDisplayName(m_port->moduleName() + "_" + m_port->displayName());
     QObject::connect(g, &PortLabel::sgnDisplayedNameChanged, m_port, &PortLabel::setDisplayName);
-    m_registry->registerForwardParameter(m_groupItem, g, m_port);
+    if (m_forwards)
+        m_forwards->push_back({g, m_port});
+    else
+        m_registry->registerForwardParameter(m_groupItem, g, m_port);
 }
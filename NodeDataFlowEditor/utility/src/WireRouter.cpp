@@ -0,0 +1,294 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "utility/WireRouter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr int maxExpansions = 200000; ///< Bounds the search on pathological inputs.
+    constexpr qreal cellSize = 256.0;     ///< Edge length of a spatial index cell.
+    // Margins of the search windows around the stubs, narrowest first.
+    constexpr qreal searchPads[] = {2 * cellSize, 8 * cellSize};
+
+    /// Bounds of the two port stubs, where the search starts and ends.
+    QRectF stubSpan(const QPointF& source, const QPointF& target, qreal margin)
+    {
+        return QRectF(source + QPointF(2 * margin, 0), target - QPointF(2 * margin, 0)).normalized();
+    }
+
+    quint64 cellKey(int cx, int cy)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(cx)) << 32) | static_cast<quint32>(cy);
+    }
+
+    void sortUnique(QVector<qreal>& values)
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    }
+
+    /// Drops points lying on the straight line between their neighbours.
+    QPolygonF simplify(const QPolygonF& points)
+    {
+        QPolygonF out;
+        for (const QPointF& p : points)
+        {
+            if (!out.isEmpty() && out.last() == p)
+                continue;
+            if (out.size() >= 2)
+            {
+                const QPointF& a = out[out.size() - 2];
+                const QPointF& b = out.last();
+                if ((a.x() == b.x() && b.x() == p.x()) || (a.y() == b.y() && b.y() == p.y()))
+                    out.removeLast();
+            }
+            out.append(p);
+        }
+        return out;
+    }
+} // namespace
+
+WireRouter::WireRouter(const QVector<QRectF>& obstacles, qreal margin)
+    : m_margin(margin)
+{
+    m_obstacles.reserve(obstacles.size());
+    for (const QRectF& rect : obstacles)
+    {
+        const QRectF inflated = rect.adjusted(-margin, -margin, margin, margin);
+        const int index = m_obstacles.size();
+        m_obstacles.append(inflated);
+
+        const int x0 = static_cast<int>(std::floor(inflated.left() / cellSize));
+        const int x1 = static_cast<int>(std::floor(inflated.right() / cellSize));
+        const int y0 = static_cast<int>(std::floor(inflated.top() / cellSize));
+        const int y1 = static_cast<int>(std::floor(inflated.bottom() / cellSize));
+        for (int cx = x0; cx <= x1; ++cx)
+            for (int cy = y0; cy <= y1; ++cy)
+                m_cells[cellKey(cx, cy)].append(index);
+    }
+}
+
+QVector<int>
+WireRouter::obstaclesIn(const QRectF& area) const
+{
+    QVector<int> result;
+    const int x0 = static_cast<int>(std::floor(area.left() / cellSize));
+    const int x1 = static_cast<int>(std::floor(area.right() / cellSize));
+    const int y0 = static_cast<int>(std::floor(area.top() / cellSize));
+    const int y1 = static_cast<int>(std::floor(area.bottom() / cellSize));
+    for (int cx = x0; cx <= x1; ++cx)
+    {
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            const auto it = m_cells.constFind(cellKey(cx, cy));
+            if (it != m_cells.constEnd())
+                result += it.value();
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+bool
+WireRouter::blocked(const QPointF& a, const QPointF& b, const QVector<int>& ignored) const
+{
+    const qreal left = std::min(a.x(), b.x());
+    const qreal right = std::max(a.x(), b.x());
+    const qreal top = std::min(a.y(), b.y());
+    const qreal bottom = std::max(a.y(), b.y());
+
+    const int x0 = static_cast<int>(std::floor(left / cellSize));
+    const int x1 = static_cast<int>(std::floor(right / cellSize));
+    const int y0 = static_cast<int>(std::floor(top / cellSize));
+    const int y1 = static_cast<int>(std::floor(bottom / cellSize));
+    for (int cx = x0; cx <= x1; ++cx)
+    {
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            const auto it = m_cells.constFind(cellKey(cx, cy));
+            if (it == m_cells.constEnd())
+                continue;
+            for (int index : it.value())
+            {
+                if (ignored.contains(index))
+                    continue;
+                // Running along an inflated edge is fine; only the open interior blocks.
+                const QRectF& r = m_obstacles[index];
+                if (left < r.right() && right > r.left() && top < r.bottom() && bottom > r.top())
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+QRectF
+WireRouter::reach(const QPointF& source, const QPointF& target, qreal margin)
+{
+    // Obstacles are inflated by margin before they are compared with the widest window.
+    const qreal pad = searchPads[std::size(searchPads) - 1] + margin;
+    return stubSpan(source, target, margin).adjusted(-pad, -pad, pad, pad);
+}
+
+QPolygonF
+WireRouter::route(const QPointF& source, const QPointF& target) const
+{
+    // Short stubs so the wire leaves and enters its ports horizontally.
+    const QPointF from = source + QPointF(2 * m_margin, 0);
+    const QPointF to = target - QPointF(2 * m_margin, 0);
+    const QRectF span = stubSpan(source, target, m_margin);
+
+    for (const qreal pad : searchPads)
+    {
+        const QRectF window = span.adjusted(-pad, -pad, pad, pad);
+
+        QVector<int> ignored;
+        QVector<qreal> xs{from.x(), to.x(), window.left(), window.right()};
+        QVector<qreal> ys{from.y(), to.y(), window.top(), window.bottom()};
+        for (int index : obstaclesIn(window))
+        {
+            const QRectF& r = m_obstacles[index];
+            if (r.contains(from) || r.contains(to))
+            {
+                ignored.append(index);
+                continue;
+            }
+            if (!r.intersects(window))
+                continue;
+            // The grid stays inside the window, so only obstacles within reach() can block it.
+            const QRectF inside = r.intersected(window);
+            xs << inside.left() << inside.right();
+            ys << inside.top() << inside.bottom();
+        }
+        sortUnique(xs);
+        sortUnique(ys);
+
+        const int nx = xs.size();
+        const int ny = ys.size();
+        auto indexOf = [](const QVector<qreal>& values, qreal v) {
+            return static_cast<qint64>(std::lower_bound(values.begin(), values.end(), v) - values.begin());
+        };
+        const qint64 startNode = indexOf(ys, from.y()) * nx + indexOf(xs, from.x());
+        const qint64 goalNode = indexOf(ys, to.y()) * nx + indexOf(xs, to.x());
+
+        // Search state = grid node * 4 + direction of arrival (+x, -x, +y, -y).
+        constexpr int dx[4] = {1, -1, 0, 0};
+        constexpr int dy[4] = {0, 0, 1, -1};
+        constexpr int opposite[4] = {1, 0, 3, 2};
+        const qreal bendPenalty = 4 * m_margin;
+
+        auto point = [&](qint64 node) {
+            return QPointF(xs[static_cast<int>(node % nx)], ys[static_cast<int>(node / nx)]);
+        };
+        auto heuristic = [&](qint64 node) {
+            const QPointF p = point(node);
+            return std::abs(p.x() - to.x()) + std::abs(p.y() - to.y());
+        };
+
+        // Only the states the search reaches are stored: the grid holds nx * ny * 4 of
+        // them, most of which A* never visits, and the wide retry makes it much larger.
+        struct Visit
+        {
+            qreal cost = 0;
+            qint64 parent = -1;
+        };
+        QHash<qint64, Visit> visits;
+        using Entry = std::pair<qreal, qint64>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open;
+
+        const qint64 startState = startNode * 4; // Arrived moving +x along the source stub.
+        visits.insert(startState, {0, -1});
+        open.push({heuristic(startNode), startState});
+
+        qint64 found = -1;
+        for (int expansions = 0; !open.empty() && expansions < maxExpansions; ++expansions)
+        {
+            const auto [priority, state] = open.top();
+            open.pop();
+            const qint64 node = state / 4;
+            const int dir = static_cast<int>(state % 4);
+            const qreal stateCost = visits.value(state).cost;
+            if (priority - heuristic(node) > stateCost)
+                continue;
+            if (node == goalNode)
+            {
+                found = state;
+                break;
+            }
+
+            const int i = static_cast<int>(node % nx);
+            const int j = static_cast<int>(node / nx);
+            for (int d = 0; d < 4; ++d)
+            {
+                if (d == opposite[dir])
+                    continue;
+                const int ni = i + dx[d];
+                const int nj = j + dy[d];
+                if (ni < 0 || nj < 0 || ni >= nx || nj >= ny)
+                    continue;
+                const qint64 next = static_cast<qint64>(nj) * nx + ni;
+                if (blocked(point(node), point(next), ignored))
+                    continue;
+
+                const QPointF delta = point(next) - point(node);
+                qreal step = std::abs(delta.x()) + std::abs(delta.y()) + (d == dir ? 0 : bendPenalty);
+                if (next == goalNode && d != 0)
+                    step += bendPenalty; // The target stub is entered moving +x.
+                const qint64 nextState = next * 4 + d;
+                const qreal nextCost = stateCost + step;
+                const auto visited = visits.constFind(nextState);
+                if (visited == visits.constEnd() || nextCost < visited->cost)
+                {
+                    visits.insert(nextState, {nextCost, state});
+                    open.push({nextCost + heuristic(next), nextState});
+                }
+            }
+        }
+
+        if (found < 0)
+            continue;
+
+        QPolygonF reversed;
+        for (qint64 state = found; state >= 0; state = visits.value(state).parent)
+            reversed.append(point(state / 4));
+
+        QPolygonF path;
+        path.reserve(reversed.size() + 2);
+        path.append(source);
+        for (int k = reversed.size() - 1; k >= 0; --k)
+            path.append(reversed[k]);
+        path.append(target);
+        return simplify(path);
+    }
+    return {};
+}
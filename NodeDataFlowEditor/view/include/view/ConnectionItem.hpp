@@ -27,7 +27,9 @@
 #include "view/ConnectionPort.hpp"
 
 #include <QGraphicsPathItem>
+#include <QLineF>
 #include <QPair>
+#include <QPolygonF>
 #include <QTimer>
 
 #include <optional>
@@ -66,6 +68,14 @@ public:
      */
     void addPort(const ConnectionPort& port);
 
+    /**
+     * @brief Return the item to the state of a fresh drag connection starting at @p port.
+     *
+     * Lets the scene recycle the temporary drag connection instead of allocating
+     * a new item (with its timer and path) for every drag.
+     */
+    void reset(const ConnectionPort& port);
+
     /**
      * @brief Update the connection when a connected node moves.
      * @param isInput True if the input port moved; false for output port.
@@ -87,6 +97,28 @@ public:
     ConnectionPort inputPort() const;
     ConnectionPort outputPort() const;
 
+    /**
+     * @brief Registry-assigned id; invalidGraphId until the connection is registered.
+     */
+    ConnectionId id() const;
+
+    /**
+     * @brief Scene points the wire is attached to: p1 on the input port, p2 on the output port.
+     *
+     * Only meaningful once both ports are set.
+     */
+    QLineF anchors() const;
+
+    /**
+     * @brief Draw the wire along @p route instead of the default curve.
+     * @param route Orthogonal polyline in scene coordinates, from anchors().p1() to anchors().p2().
+     *
+     * The route is kept until an endpoint moves away from it, then the wire
+     * falls back to the curve until a new route is set. An empty route clears it.
+     */
+    void setRoute(const QPolygonF& route);
+    QPolygonF route() const;
+
     /**
      * @brief Check or set the active state of the connection.
      *
@@ -116,8 +148,29 @@ public:
      * This is used to prevent updates during teardown animations or cleanup.
      */
     bool isDestroying() const;
+
+    /**
+     * @brief Bounds of the curve grown by the widest stroke, cached with the curve.
+     */
+    QRectF boundingRect() const override;
+
+    /**
+     * @brief Stroked hit area of the curve, built on first use after each path change.
+     */
     QPainterPath shape() const override;
 
+    /**
+     * @brief Point hit test against the flattened curve, without building shape().
+     */
+    bool contains(const QPointF& point) const override;
+
+    /**
+     * @brief Rectangular areas, such as rubber bands, are tested against the flattened curve.
+     *
+     * Other paths and bounding-rect modes go through shape().
+     */
+    bool collidesWithPath(const QPainterPath& path, Qt::ItemSelectionMode mode = Qt::IntersectsItemShape) const override;
+
 private:
     /**
      * @brief Paint the connection curve and optional animated elements.
@@ -129,6 +182,11 @@ private:
      */
     void drawPath(const QPointF& startPoint, const QPointF& endPoint);
 
+    /**
+     * @brief Install @p path as the curve and refresh the caches derived from it.
+     */
+    void setCurrentPath(const QPainterPath& path);
+
     /**
      * @brief Update internal animation state for active connection visuals.
      */
@@ -153,12 +211,22 @@ private:
     bool m_isCompatible = false; ///< Whether the connection is currently compatible.
 
     QPainterPath m_currentPath; ///< Cached connection curve.
+    QPolygonF m_route;          ///< Routed polyline, empty when the default curve is drawn.
+    QPolygonF m_polyline;       ///< Flattened m_currentPath, for hit tests.
+    QRectF m_bounds;            ///< m_currentPath bounds grown by the widest stroke.
+
+    mutable QPainterPath m_shape;      ///< Stroked hit area, empty until shape() needs it.
+    mutable bool m_shapeValid = false; ///< Whether m_shape matches m_currentPath.
 
     bool m_isActive = false;           ///< Whether this connection is active/animated.
     QTimer m_animationTimer;           ///< Timer used for animating active connections.
     QVector<double> m_circlePositions; ///< Animation positions for decorative elements (e.g. flowing dots).
 
     bool m_isDestroying = false; ///< Flag set during cleanup to prevent further updates.
+
+    ConnectionId m_id = invalidGraphId; ///< Assigned by GraphRegistry::registerConnection.
+
+    friend class GraphRegistry;
 };
 
 inline std::optional<ConnectionPort>
@@ -24,9 +24,11 @@
 
 #pragma once
 
+#include "utility/GraphIds.hpp"
+#include "utility/Symbol.hpp"
+
 #include <QPointF>
 #include <QRectF>
-#include <QString>
 
 /**
  * @brief Holds data for initializing a new connection.
@@ -36,15 +38,19 @@
  */
 struct ConnectionPort
 {
-    QPointF scenePos;     ///< Position of the port in scene coordinates.
-    QRectF rect;          ///< Ports bounding rectangle.
-    QString portName;     ///< Ports name.
-    QString moduleName;   ///< Modules name.
-    bool isInput = false; ///< True if the connection begins at an input port.
+    QPointF scenePos;               ///< Position of the port in scene coordinates.
+    QRectF rect;                    ///< Ports bounding rectangle.
+    Symbol portName;                ///< Ports name.
+    Symbol moduleName;              ///< Modules name.
+    bool isInput = false;           ///< True if the connection begins at an input port.
+    PortId portId = invalidGraphId; ///< Registry id of the port, invalidGraphId if unregistered.
 
     // --- Equality operator ---
     bool operator==(const ConnectionPort& other) const
     {
+        // Ids survive renames; names are only compared for unregistered ports.
+        if (portId != invalidGraphId && other.portId != invalidGraphId)
+            return portId == other.portId && isInput == other.isInput;
         return portName == other.portName &&
                moduleName == other.moduleName &&
                isInput == other.isInput;
@@ -66,11 +72,12 @@ struct ConnectionPort
     ConnectionPort() = default;
 
     // If you want to allow constructing with values:
-    ConnectionPort(QPointF pos, QRectF r, QString p, QString m, bool input)
+    ConnectionPort(QPointF pos, QRectF r, Symbol p, Symbol m, bool input, PortId id = invalidGraphId)
         : scenePos(std::move(pos))
         , rect(std::move(r))
-        , portName(std::move(p))
-        , moduleName(std::move(m))
+        , portName(p)
+        , moduleName(m)
         , isInput(input)
+        , portId(id)
     {}
 };
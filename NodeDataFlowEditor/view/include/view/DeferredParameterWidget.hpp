@@ -0,0 +1,75 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QPointer>
+#include <QVariant>
+#include <QWidget>
+
+/**
+ * @brief Stand-in for a mirrored parameter editor that is not built yet.
+ *
+ * Groups show one of these per forwarded parameter until the user first
+ * reaches the row (hover, focus or click), then replace it with a clone of
+ * the member's editor. Until then it paints the source editor's look. It
+ * takes the size of the source editor so the group's layout does not change
+ * on the swap, and exposes the source's value as its user property so
+ * snapshots read the right value before the clone exists.
+ */
+class DeferredParameterWidget final : public QWidget
+{
+    Q_OBJECT
+    Q_PROPERTY(QVariant value READ value USER true)
+
+public:
+    /**
+     * @brief Stand in for @p source, the member editor the clone will be made from.
+     */
+    explicit DeferredParameterWidget(QWidget* source, QWidget* parent = nullptr);
+
+    /**
+     * @brief Member editor the clone is made from; null once it is destroyed.
+     */
+    QWidget* source() const;
+
+    /**
+     * @brief Current value of the source editor's user property.
+     */
+    QVariant value() const;
+
+signals:
+    /**
+     * @brief Emitted once, the first time the mouse enters, the widget gets focus or is clicked.
+     */
+    void sgnActivated();
+
+protected:
+    bool event(QEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    QPointer<QWidget> m_source; ///< Member editor to clone.
+    bool m_activated = false;   ///< sgnActivated() was emitted.
+};
@@ -0,0 +1,169 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QImage>
+#include <QPair>
+#include <QPointer>
+#include <QRectF>
+#include <QTimer>
+#include <QVector>
+#include <QWidget>
+#include <memory>
+
+class GraphRegistry;
+class GraphScene;
+class GraphSnapshot;
+class GraphView;
+struct NodeRecord;
+
+/**
+ * @brief Overview of the whole graph with a draggable viewport rectangle.
+ *
+ * The minimap never renders the real scene. It keeps a low-resolution image
+ * of node rectangles (in their title color) and, optionally, straight edges,
+ * built from registry snapshots. A timer polls the registry a few times per
+ * second; only the records that changed since the previous snapshot are
+ * redrawn, in place, unless the graph grew past the mapped area.
+ *
+ * Clicking or dragging in the minimap centers the attached GraphView on that
+ * point.
+ */
+class GraphMinimap final : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Construct a minimap of @p scene that navigates @p view.
+     */
+    GraphMinimap(GraphScene* scene, GraphView* view, QWidget* parent = nullptr);
+
+    /**
+     * @brief Draw connections as straight lines between node rectangles.
+     */
+    void setShowEdges(bool show);
+    bool showEdges() const;
+
+    /**
+     * @brief Time between two registry polls while the minimap is shown.
+     */
+    void setRefreshInterval(int ms);
+    int refreshInterval() const;
+
+    /**
+     * @brief Pull the latest registry snapshot and update the cached image now.
+     */
+    void refresh();
+
+    /**
+     * @brief Scene position under widget position @p pos.
+     */
+    QPointF mapToScene(const QPointF& pos) const;
+
+    /**
+     * @brief Widget position of scene position @p pos.
+     */
+    QPointF mapFromScene(const QPointF& pos) const;
+
+    /**
+     * @brief Cached rendering of the graph, without the viewport rectangle.
+     */
+    const QImage& image() const;
+
+    /**
+     * @brief Number of times the whole image was redrawn, for diagnostics.
+     */
+    int fullRenderCount() const;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+
+private:
+    /**
+     * @brief Cached minimap state of one visible node.
+     */
+    struct Entry
+    {
+        QRectF rect;             ///< Scene rect of the node body.
+        QColor color;            ///< Title color.
+        QVector<qint64> targets; ///< Uids of the nodes fed by this one.
+    };
+
+    /// Source and target uid of a drawn edge.
+    using EdgeKey = QPair<qint64, qint64>;
+
+    /// Replaces the entry of @p before by @p after, collecting the touched scene areas in @p dirty.
+    void applyChange(const NodeRecord* before, const NodeRecord* after, QVector<QRectF>* dirty);
+    /// Appends the scene area covered by node @p uid and its edges to @p dirty.
+    void collectDirty(qint64 uid, QVector<QRectF>& dirty) const;
+    /// Adds node @p uid, and its edges to nodes already present, to the grid.
+    void indexEntry(qint64 uid);
+    /// Reverses indexEntry(); call while the entry and its neighbours still hold their rects.
+    void unindexEntry(qint64 uid);
+    /// Adds or removes the edge @p edge in every grid cell its bounds cross.
+    void indexEdge(const EdgeKey& edge, bool add);
+    /// Fits the whole graph in the image and redraws everything.
+    void renderAll();
+    /// Redraws the part of the image covering scene area @p area.
+    void renderArea(const QRectF& area);
+    /// Draws every edge and node intersecting scene area @p area.
+    void drawContents(QPainter& painter, const QRectF& area) const;
+    /// Maps a scene rect to image coordinates.
+    QRectF toImage(const QRectF& rect) const;
+    /// Scene area currently shown by the attached view.
+    QRectF visibleSceneRect() const;
+    /// Centers the attached view on the scene point under @p pos.
+    void centerViewAt(const QPointF& pos);
+
+    QPointer<GraphView> m_view;                      ///< View navigated by the minimap.
+    std::shared_ptr<GraphRegistry> m_registry;       ///< Source of the snapshots.
+    std::shared_ptr<const GraphSnapshot> m_snapshot; ///< Snapshot the image reflects.
+
+    QHash<qint64, Entry> m_entries;            ///< Visible nodes by uid.
+    QHash<qint64, QVector<qint64>> m_incoming; ///< Node uid → uids of the nodes feeding it.
+
+    QHash<quint64, QVector<qint64>> m_nodeCells;  ///< Grid cell of a node's top-left corner → uids.
+    QHash<quint64, QVector<EdgeKey>> m_edgeCells; ///< Grid cell → edges whose bounds cross it.
+    QVector<EdgeKey> m_longEdges;                 ///< Edges spanning too many cells to index.
+    qreal m_extent = 0.0;                         ///< Largest node width or height seen.
+
+    QImage m_image;           ///< Cached low-detail rendering.
+    QRectF m_world;           ///< Scene area mapped onto the image.
+    qreal m_scale = 1.0;      ///< Image pixels per scene unit.
+    QPointF m_offset;         ///< Image position of m_world's top-left corner.
+    QRectF m_viewportRect;    ///< Last known visible scene area of the view.
+    QTimer m_refreshTimer;    ///< Throttles registry polling.
+    bool m_showEdges = false; ///< Whether edges are drawn.
+    bool m_dragging = false;  ///< Whether the viewport rectangle is being dragged.
+    int m_fullRenders = 0;    ///< Number of renderAll() calls.
+};
@@ -24,14 +24,28 @@
 
 #pragma once
 
+#include "utility/GraphIds.hpp"
+
 #include <QGraphicsScene>
+#include <QHash>
+#include <QPointer>
+#include <QRectF>
+#include <QSet>
+#include <QTimer>
+#include <QVector>
 #include <memory>
 
+struct ConnectionPort;
+
 class ConnectionItem;
 class GraphRegistry;
+class QThread;
 class NodeItem;
 class NodeFactory;
+class NodeProfiler;
 class PortLabel;
+class SelectionDispatcher;
+class VirtualGraph;
 
 /**
  * @brief Custom QGraphicsScene implementation for the node editor environment.
@@ -65,6 +79,17 @@ public:
     std::shared_ptr<NodeFactory> getNodeFactory();
 
     std::shared_ptr<GraphRegistry> getGraphRegistry();
+
+    /**
+     * @brief Execution statistics of the scene's nodes; executors record into it.
+     */
+    std::shared_ptr<NodeProfiler> getNodeProfiler();
+
+    /**
+     * @brief The scene's only selectionChanged listener; nodes watch it instead of the scene.
+     */
+    SelectionDispatcher* selectionDispatcher() const;
+
     /**
      * @brief Add a NodeItem to the scene.
      * @param node The NodeItem to add.
@@ -79,6 +104,60 @@ public:
      */
     void groupSelectedNodes(QList<NodeItem*> nodes);
 
+    /**
+     * @brief Collapse groups of at least @p nodes members as soon as they are created.
+     *
+     * Collapsed groups detach their members so dragging the group stays cheap
+     * (see GroupItem::setCollapsed()). 0, the default, never collapses.
+     */
+    void setAutoCollapseThreshold(int nodes);
+    int autoCollapseThreshold() const;
+
+    /**
+     * @brief Arrange nodes with a layered layout computed on a worker thread.
+     * @param nodes Nodes to arrange; empty arranges every visible node.
+     *
+     * The layout reads a registry snapshot, so the scene stays responsive while
+     * it runs. The result is applied in one batch on the GUI thread, after which
+     * sgnLayoutApplied() is emitted. A newer request supersedes a pending one.
+     */
+    void autoLayout(const QList<NodeItem*>& nodes = {});
+
+    /**
+     * @brief Route wires around nodes instead of drawing plain curves.
+     *
+     * Routes are computed on a worker thread and cached on each connection, so
+     * painting stays cheap. After a move only the wires of the moved nodes, and
+     * the wires whose route crosses their new bounds, are rerouted.
+     */
+    void setWireRouting(bool enabled);
+    bool wireRouting() const;
+
+    /**
+     * @brief Store for nodes that only become real items near the viewport.
+     *
+     * Created on first call. Views showing the scene report their visible area
+     * to it, and the scene background draws the wires and nodes it has not
+     * materialized.
+     */
+    VirtualGraph* enableVirtualization();
+
+    /**
+     * @brief The virtual node store, or nullptr if virtualization was never enabled.
+     */
+    VirtualGraph* virtualGraph() const;
+
+    /**
+     * @brief Tint node titles by execution cost and show their stats badges.
+     *
+     * Enabling the overlay also enables the profiler; disabling it puts the
+     * profiler back in the state it was in before. The overlay refreshes
+     * at most a few times per second and only when new samples came in;
+     * while disabled it costs nothing.
+     */
+    void setProfileOverlay(bool enabled);
+    bool profileOverlay() const;
+
     // ================================
     // Appearance
     // ================================
@@ -119,6 +198,47 @@ public:
      */
     void disconnectNode(const NodeItem* node) const;
 
+    /**
+     * @brief Delete @p nodes, every wire attached to them and @p connections in one pass.
+     *
+     * The wires are collected once and unregistered under a single registry
+     * lock, items are removed with scene indexing suspended when they are a
+     * sizeable share of the graph (small deletes keep the index), and parameter
+     * widgets are refreshed only on surviving nodes that lost an input.
+     * The profiler forgets the deleted nodes.
+     * Nodes are deleted later, connections immediately.
+     */
+    void deleteItems(const QList<NodeItem*>& nodes, const QList<ConnectionItem*>& connections = {});
+
+    /**
+     * @brief Draw a wire between @p from and @p to on behalf of the user.
+     * @return The new connection, or nullptr if the ports cannot be connected.
+     *
+     * Emits sgnConnectionCreated() once the wire is in the scene.
+     */
+    ConnectionItem* connectPorts(PortLabel* from, PortLabel* to);
+
+signals:
+    /**
+     * @brief Emitted after the user drew @p connection.
+     */
+    void sgnConnectionCreated(ConnectionItem* connection);
+
+    /**
+     * @brief Emitted by deleteItems() for every wire it is about to delete.
+     */
+    void sgnConnectionDeleted(ConnectionItem* connection);
+
+    /**
+     * @brief Emitted once the positions computed by autoLayout() have been applied.
+     */
+    void sgnLayoutApplied();
+
+    /**
+     * @brief Emitted after a batch of wire routes has been applied.
+     */
+    void sgnRoutesApplied();
+
 public slots:
     /**
      * @brief Handle user click on a port.
@@ -171,17 +291,65 @@ protected:
     void contextMenuEvent(QGraphicsSceneContextMenuEvent* event) override;
 
 private:
-    void deleteNodeConnections(const NodeItem* node);
-    void deleteConnection(ConnectionItem* connection);
+    friend class VirtualGraph;
+
+    /// Unregisters and deletes a wire between two plain nodes.
+    void releaseConnection(ConnectionItem* connection);
+
+    /// Shows the drag connection starting at @p port, reusing the spare item when there is one.
+    void beginTempConnection(const ConnectionPort& port);
+    /// Removes the drag connection from the scene and keeps it as the spare item.
+    void endTempConnection();
+
+    /// Moves every still-registered node to its computed position, in one pass.
+    void applyLayout(const QHash<qint64, QPointF>& positions);
+
+    /// Queues the wires of @p node, and those crossing its new bounds, for rerouting.
+    void queueReroute(const NodeItem* node);
+    /// Queues @p connection for routing.
+    void queueRoute(ConnectionItem const* connection);
+    /// Hands the queued wires to a worker thread; one batch runs at a time.
+    void startRouting();
+    /// Records the bounds of the route cached on connection @p id; null bounds only drop it.
+    void indexRoute(ConnectionId id, const QRectF& bounds);
+    /// Drops connection @p id from the route index.
+    void unindexRoute(ConnectionId id);
+    /// Connections whose cached route bounds intersect @p area.
+    QSet<ConnectionId> routesIn(const QRectF& area);
+
+    /// Pushes the profiler's latest aggregates to the node items.
+    void updateProfileOverlay();
 
 private:
-    ConnectionItem* m_tempConnection = nullptr; ///< Temporary connection being created.
+    ConnectionItem* m_tempConnection = nullptr;       ///< Temporary connection being created.
+    std::unique_ptr<ConnectionItem> m_spareConnection; ///< Recycled drag connection, not in the scene.
     PortLabel* m_startPort = nullptr;           ///< Port where a connection drag started.
     PortLabel* m_lastFoundPort = nullptr;       ///< Most recently hovered compatible port.
+    QPointer<QThread> m_layoutThread;           ///< Worker of the latest autoLayout() request.
+    quint64 m_layoutRequest = 0;                ///< Counter used to drop superseded layout results.
+
+    bool m_wireRouting = false;                         ///< Whether wires are routed around nodes.
+    QSet<ConnectionId> m_routeQueue;                    ///< Connections waiting for a route.
+    QVector<QRectF> m_movedBounds;                      ///< Bounds of nodes moved since the last routing batch.
+    QHash<ConnectionId, QRectF> m_routeBounds;          ///< Bounds of every cached route, as indexed.
+    QHash<quint64, QVector<ConnectionId>> m_routeCells; ///< Grid cell of a route's bounds -> its connection ids.
+    QVector<ConnectionId> m_longRoutes;                 ///< Routes spanning too many cells to index.
+    QTimer m_routeTimer;                                ///< Batches moves into one routing pass.
+    QPointer<QThread> m_routeThread;                    ///< Worker of the running routing batch.
+
+    std::unique_ptr<VirtualGraph> m_virtualGraph; ///< Created by enableVirtualization().
+    SelectionDispatcher* m_selection = nullptr;   ///< Child of the scene, deleted first on destruction.
+    int m_autoCollapseThreshold = 0;              ///< Group size collapsed on creation, 0 for never.
+
+    bool m_profileOverlay = false;     ///< Whether nodes show their execution cost.
+    QTimer m_profileTimer;             ///< Throttles overlay refreshes.
+    quint64 m_profileRevision = 0;     ///< Profiler revision the overlay shows.
+    bool m_profilerWasEnabled = false; ///< Profiler state to restore when the overlay is hidden.
 
     QColor m_backgroundColor = Qt::darkGray; ///< Scene background color.
     QColor m_lightLinesColor = Qt::gray;     ///< Color for lighter grid lines.
     QColor m_darkLinesColor = Qt::black;     ///< Color for darker grid lines.
     std::shared_ptr<GraphRegistry> m_registry;
     std::shared_ptr<NodeFactory> m_factory;
+    std::shared_ptr<NodeProfiler> m_profiler;
 };
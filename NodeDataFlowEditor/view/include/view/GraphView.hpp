@@ -26,9 +26,11 @@
 
 #include <QGraphicsView>
 
+class GraphMinimap;
 class GraphScene;
 class QWheelEvent;
 class QKeyEvent;
+class QResizeEvent;
 
 /**
  * @brief Custom graphics view for displaying and interacting with the node-based scene.
@@ -52,6 +54,30 @@ public:
      */
     explicit GraphView(GraphScene* scene, QWidget* parent = nullptr);
 
+    /**
+     * @brief Show or hide a minimap overlay in the bottom-right corner.
+     *
+     * The overlay is created on first use.
+     */
+    void setMinimapVisible(bool visible);
+
+    /**
+     * @brief The minimap overlay, or nullptr if it was never shown.
+     */
+    GraphMinimap* minimap() const;
+
+    /**
+     * @brief Center and zoom on the nodes with uids @p uids, e.g. the nodes of search hits.
+     *
+     * Node bounds come from a registry snapshot. Unknown uids are ignored.
+     */
+    void focusNodes(const QVector<qint64>& uids);
+
+    /**
+     * @brief Center on @p sceneRect and zoom so it fits, within the wheel zoom limits.
+     */
+    void focusOn(const QRectF& sceneRect);
+
 protected:
     /**
      * @brief Handle mouse wheel events for zooming in and out of the scene.
@@ -74,4 +100,21 @@ protected:
      * @param event Key release event.
      */
     void keyReleaseEvent(QKeyEvent* event) override;
+
+    /**
+     * @brief Keep the minimap overlay anchored to the bottom-right corner.
+     */
+    void resizeEvent(QResizeEvent* event) override;
+
+    /**
+     * @brief Report the new visible area to the scene's virtual node store.
+     */
+    void scrollContentsBy(int dx, int dy) override;
+
+private:
+    void placeMinimap();
+    /// Tells the scene's VirtualGraph, if any, what this view shows.
+    void updateVirtualViewport();
+
+    GraphMinimap* m_minimap = nullptr; ///< Lazily created overlay, child of the view.
 };
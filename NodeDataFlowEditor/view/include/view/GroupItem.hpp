@@ -24,8 +24,12 @@
 
 #pragma once
 
+#include "utility/GroupDescriptor.hpp"
 #include "view/NodeItem.hpp"
+#include <QHash>
 #include <QMap>
+#include <QPointF>
+#include <QPointer>
 #include <QSet>
 
 class ConnectionItem;
@@ -38,6 +42,11 @@ class GraphRegistry;
  * forwards connections through its own ports, and keeps selection/movement in sync.
  * External connections to member nodes are re-bound to the group's ports while grouped,
  * and restored back to inner ports on ungroup.
+ *
+ * Mirrored parameter editors are built lazily: each forwarded parameter starts
+ * with a DeferredParameterWidget and gets its cloned editor the first time the
+ * user hovers, focuses or clicks the row, so grouping a large selection does
+ * not clone every widget.
  */
 class GroupItem : public NodeItem
 {
@@ -77,6 +86,37 @@ public:
      */
     QSet<NodeItem*> nodes();
 
+    /**
+     * @brief Detach member nodes from the scene while grouped, or attach them back.
+     * @param collapsed True to detach the members, false to restore them.
+     *
+     * A collapsed group removes its members (with their ports and proxy widgets)
+     * from the scene index and no longer drags them along when it moves; the
+     * accumulated displacement is applied once, when the group is expanded or
+     * ungrouped. Moving a collapsed group costs the same as moving a single node.
+     */
+    void setCollapsed(bool collapsed);
+
+    /**
+     * @brief Whether member nodes are currently detached from the scene.
+     */
+    bool isCollapsed() const;
+
+    /**
+     * @brief Delete the members detached by a collapse, for when the group or their scene is going away.
+     */
+    void discardDetachedMembers();
+
+    /**
+     * @brief Build every mirrored parameter editor that has not been shown yet.
+     */
+    void materializeParameters();
+
+    /**
+     * @brief Number of mirrored parameter editors still waiting to be shown.
+     */
+    int deferredParameterCount() const;
+
     bool isAGroupNode() const override { return true; }
 
 protected:
@@ -92,6 +132,13 @@ private:
     // Member nodes currently contained in the group.
     QSet<NodeItem*> m_nodes;
 
+    bool m_collapsed = false;               ///< Members are detached from the scene.
+    QPointF m_pendingOffset;                ///< Group displacement not yet applied to detached members.
+    QPointer<QGraphicsScene> m_memberScene; ///< Scene the detached members are returned to.
+
+    /// Parameter ports still showing a placeholder → member port they forward.
+    QHash<PortLabel*, QPointer<PortLabel>> m_deferredParameters;
+
     /**
      * @brief Build a short, stable group title from member node titles.
      */
@@ -100,17 +147,24 @@ private:
     /**
      * @brief Expose a merged set of input/output ports on the group based on inner ports.
      *
-     * Buckets by port name, creates one group port per name, and wires connection forwarding.
+     * Buckets by port name, creates one group port per name, and appends the forwarding
+     * rules to @p forwards for the caller to register in one go.
      */
-    void mirrorPorts();
+    void mirrorPorts(QVector<ForwardRule>& forwards);
 
     /**
      * @brief Expose representative parameter widgets on the group and broadcast their changes.
      *
-     * Attempts to clone a representative widget per parameter name and connect it so updates
-     * are propagated to all inner widgets with the same name.
+     * Creates one parameter port per name with a placeholder editor, cloned on first use,
+     * and appends the forwarding rules to @p forwards. Containers are cloned right away;
+     * their forwarding rules are appended too.
+     */
+    void mirrorParams(QVector<ForwardRule>& forwards);
+
+    /**
+     * @brief Replace the placeholder editor of @p port with a clone of the member's editor.
      */
-    void mirrorParams();
+    void materializeParameter(PortLabel* port);
 
 protected slots:
     /**
@@ -28,13 +28,16 @@
 #include "view/PortLabel.hpp"
 
 #include <QGraphicsItem>
+#include <QHash>
 #include <QMap>
+#include <QPixmap>
 #include <QVector>
 #include <memory>
 
 class PortLabel;
 class GraphRegistry;
 class QGraphicsProxyWidget;
+class QGraphicsSceneMouseEvent;
 class QWidget;
 
 /**
@@ -285,8 +288,8 @@ public:
      * @brief Add a parameter widget to the center column and create an associated parameter port.
      *
      * The provided QWidget will be wrapped by a QGraphicsProxyWidget and positioned
-     * under the parameter port label. The NodeItem takes ownership of the proxy;
-     * the QWidget ownership remains with the caller unless otherwise transferred.
+     * under the parameter port label; in lazy mode it is kept off-scene instead
+     * and only painted from a snapshot. The NodeItem takes ownership of the widget.
      *
      * @param widget The QWidget that implements the parameter UI.
      * @param name Internal name for the created parameter port.
@@ -305,7 +308,8 @@ public:
 
     /**
      * @brief Returns a map of the parameter widgets (original QWidget -> proxy).
-     * @return Map containing user widgets and their QGraphicsProxyWidget wrappers.
+     * @return Map containing user widgets and their QGraphicsProxyWidget wrappers;
+     *         null for parameters without a live editor in lazy mode.
      */
     QMap<QWidget*, QGraphicsProxyWidget*> parameterWidgets() const;
 
@@ -318,16 +322,50 @@ public:
 
     /**
      * @brief Returns the internal map of parameter ports to their proxy widgets.
-     * @return QMap from PortLabel* to QGraphicsProxyWidget*.
+     * @return QMap from PortLabel* to QGraphicsProxyWidget*; null for
+     *         parameters without a live editor in lazy mode.
      */
     QMap<PortLabel*, QGraphicsProxyWidget*> parameterPorts() const;
 
+    /**
+     * @brief Area of the node, in item coordinates, taken by the editor of @p port.
+     */
+    QRectF parameterRect(PortLabel* port) const;
+
+    /**
+     * @brief Enable or disable the editor of @p port, e.g. while a connection drives it.
+     */
+    void setParameterEnabled(PortLabel* port, bool enabled);
+
+    /**
+     * @brief Whether the editor of @p port accepts input.
+     */
+    bool isParameterEnabled(PortLabel* port) const;
+
     /**
      * @brief Returns a QList of all parameter PortLabel pointers.
      * @return QList of parameter ports.
      */
     QList<PortLabel*> paramsInputs() const;
 
+    /**
+     * @brief Enable or disable lazy parameter widgets.
+     * @param lazy True to drop parameter proxies and paint snapshots instead.
+     *
+     * In lazy mode parameters have no proxy: the widget given to addParameter()
+     * stays off-scene, holding the value and sizing the slot, and the node
+     * paints a pixmap of it that is rebuilt when the value changes, never
+     * while painting. When the mouse hovers or clicks a slot the node borrows
+     * a proxy and editor from the registry's ParameterEditorPool, and gives
+     * them back when the mouse moves on unless the editor has focus.
+     */
+    void setLazyParameters(bool lazy);
+
+    /**
+     * @brief Whether parameter widgets are drawn from snapshots until hovered.
+     */
+    bool lazyParameters() const;
+
     /* ---------------------------
      * Title control
      * --------------------------- */
@@ -363,6 +401,30 @@ public:
      */
     void setNodeNameColor(const QColor& c);
 
+    /**
+     * @brief Get the color used to draw the node's title bar.
+     * @return Title bar color.
+     */
+    QColor nodeNameColor() const;
+
+    /* ---------------------------
+     * Profiling overlay
+     * --------------------------- */
+
+    /**
+     * @brief Tint the title bar by execution cost and show a stats badge.
+     * @param heat Cost percentile, from 0 (cheapest, green) to 1 (costliest, red).
+     * @param badge Short stats text drawn in the bottom-right corner.
+     */
+    void setProfileOverlay(qreal heat, const QString& badge);
+
+    /**
+     * @brief Remove the profiling tint and badge.
+     */
+    void clearProfileOverlay();
+
+    bool hasProfileOverlay() const;
+
     /**
      * @brief Remove every port from the node and disconnect associated connections.
      * This removes input, output and parameter ports and their proxies.
@@ -383,6 +445,25 @@ public:
      */
     void updateLayout();
 
+    /**
+     * @brief Coalesces updateLayout() calls while ports are added in bulk.
+     *
+     * While a DeferredLayout is alive, layout requests on the node are only
+     * recorded; the outermost one runs a single pass when destroyed.
+     */
+    class DeferredLayout
+    {
+    public:
+        explicit DeferredLayout(NodeItem* node);
+        ~DeferredLayout();
+
+        DeferredLayout(const DeferredLayout&) = delete;
+        DeferredLayout& operator=(const DeferredLayout&) = delete;
+
+    private:
+        NodeItem* m_node;
+    };
+
 protected:
     /**
      * @brief Qt item change handler.
@@ -411,6 +492,22 @@ protected:
      */
     void updateRect();
 
+    /**
+     * @brief Replace the widget shown for the parameter @p port with @p widget.
+     *
+     * The previous widget is unembedded and deleted later; @p widget takes its
+     * place in the same proxy, or its slot in lazy mode, and its bound values.
+     */
+    void setParameterWidget(PortLabel* port, QWidget* widget);
+
+private slots:
+    /**
+     * @brief Invoked when the user property of a parameter widget changes.
+     * Flags the node so the next registry snapshot picks up the new value,
+     * and rebuilds the widget's snapshot.
+     */
+    void onParameterValueChanged();
+
 private:
     /**
      * @brief Internal helper: add a parameter-type PortLabel (no widget).
@@ -420,6 +517,11 @@ private:
      */
     PortLabel* addParamInput(const QString& name);
 
+    /**
+     * @brief Flag the node when the user property of @p widget changes.
+     */
+    void watchParameterWidget(QWidget* widget);
+
     /* ---------------------------
      * Drawing helpers
      * --------------------------- */
@@ -443,6 +545,66 @@ private:
      */
     void drawGlowingBounding(QPainter& painter);
 
+    /**
+     * @brief Draw the snapshot of every parameter without a live editor (lazy mode).
+     * @param painter Painter to draw with.
+     */
+    void drawParameterSnapshots(QPainter& painter) const;
+
+    /**
+     * @brief Draw the profiling stats badge in the bottom margin.
+     * @param painter Painter to draw with.
+     */
+    void drawProfileBadge(QPainter& painter) const;
+
+    /**
+     * @brief Borrow an editor for the parameter under @p pos and park the previously active one.
+     * @param pos Position in item coordinates.
+     * @return The editor just borrowed, or nullptr if none was.
+     */
+    QGraphicsProxyWidget* activateParameterAt(const QPointF& pos);
+
+    /**
+     * @brief Deliver @p event to @p proxy, its positions mapped to the proxy's coordinates.
+     */
+    void forwardMouseEvent(QGraphicsProxyWidget* proxy, QGraphicsSceneMouseEvent* event);
+
+    /**
+     * @brief Return the active parameter's editor to the pool unless it still has focus.
+     */
+    void parkActiveParameter();
+
+    /**
+     * @brief Return the active parameter's editor to the pool, focused or not.
+     *
+     * Leaves the snapshot as it was; callers keeping the parameter refresh it.
+     */
+    void releaseActiveParameter();
+
+    struct Parameter;
+
+    /**
+     * @brief Wrap the parameter's widget in a proxy of its own (eager mode).
+     */
+    void embedParameter(Parameter& parameter);
+
+    /**
+     * @brief Take the parameter's widget out of its proxy and delete the proxy (lazy mode).
+     */
+    void unembedParameter(Parameter& parameter);
+
+    /**
+     * @brief Rebuild the snapshot painted for @p parameter while it has no live editor.
+     *
+     * Identical widgets on different nodes share one pixmap through QPixmapCache.
+     */
+    void refreshSnapshot(Parameter& parameter);
+
+    /**
+     * @brief Size of the editor slot of @p parameter.
+     */
+    static QSizeF parameterSize(const Parameter& parameter);
+
     /**
      * @brief Set the node's active state which affects rendering (glow).
      * @param newIsActive True to mark active; false otherwise.
@@ -488,22 +650,31 @@ private:
     // ==================================================
 
     /**
-     * @brief Map of raw parameter QWidget pointers to their QGraphicsProxyWrapper.
+     * @brief What the node keeps for one parameter port (label above, control below).
      *
-     * The NodeItem does not take ownership of the original QWidget pointer
-     * (caller may still own it), but the QGraphicsProxyWidget is parented
-     * to this NodeItem and will be deleted with it.
+     * The widget is owned by the node: through the proxy that embeds it in
+     * eager mode, directly while it is parked in lazy mode.
      */
-    QMap<QWidget*, QGraphicsProxyWidget*> m_parameterWidgets;
+    struct Parameter
+    {
+        QWidget* widget = nullptr;             ///< Widget given to addParameter(); holds the value while parked.
+        QGraphicsProxyWidget* proxy = nullptr; ///< Embeds widget (eager) or a pooled editor while active (lazy).
+        QRectF rect;                           ///< Editor slot in item coordinates.
+        QPixmap snapshot;                      ///< Painted in the slot while there is no proxy (lazy).
+        bool enabled = true;                   ///< False while a connection drives the parameter.
+    };
 
-    /**
-     * @brief Map of parameter PortLabel -> proxy widget used to display the parameter control.
-     *
-     * Each parameter port typically has a PortLabel (label above) and a proxy widget (control below).
-     */
-    QMap<PortLabel*, QGraphicsProxyWidget*> m_parameterPorts;
+    QMap<PortLabel*, Parameter> m_parameters; ///< Parameter ports and their editors.
+
+    bool m_lazyParameters = false;                   ///< Parameters are painted from snapshots.
+    PortLabel* m_activeParameter = nullptr;          ///< Parameter with a borrowed editor in lazy mode.
+    QGraphicsProxyWidget* m_pressedEditor = nullptr; ///< Editor borrowed by a press, fed the rest of that click.
+
+    int m_layoutDeferrals = 0;    ///< Live DeferredLayout guards.
+    bool m_layoutPending = false; ///< updateLayout() was requested while deferred.
 
-    QSize m_paramsRectSize; ///< Cached size of the stacked parameter controls area.
+    qreal m_profileHeat = -1; ///< Profiling tint; negative while the overlay is off.
+    QString m_profileBadge;   ///< Profiling stats text.
 
     // ==================================================
     // STATE
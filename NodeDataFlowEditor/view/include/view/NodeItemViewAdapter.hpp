@@ -129,7 +129,9 @@ private:
     /**
      * @brief Connect scene selection changes to adapter-level selection updates.
      *
-     * Keeps the INodeView selection state synchronized with the NodeItems
+     * In a GraphScene the adapter watches the scene's SelectionDispatcher and
+     * is only called when its own item changes state. Keeps the INodeView
+     * selection state synchronized with the NodeItems
      * selection in the scene.
      */
     void wireSceneSelection();
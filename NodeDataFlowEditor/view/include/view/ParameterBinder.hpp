@@ -0,0 +1,115 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "model/ParameterStore.hpp"
+
+#include <QHash>
+#include <QObject>
+#include <QVariant>
+#include <QVector>
+
+class QWidget;
+
+/**
+ * @brief Keeps parameter editor widgets in sync with a ParameterStore.
+ *
+ * A user edit in a bound widget is written to the store; when the store
+ * announces the coalesced value, it is pushed to the other widgets bound to
+ * the same key only. Bindings are dropped when the widget is destroyed or the
+ * port is removed from the store.
+ */
+class ParameterBinder : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ParameterBinder(ParameterStore& store, QObject* parent = nullptr);
+
+    /**
+     * @brief Bind @p widget to the value of @p key.
+     * @return False if the widget type holds no editable value.
+     *
+     * The first widget bound to a key seeds its value; later widgets are
+     * initialized from the store.
+     */
+    bool bind(ParameterKey key, QWidget* widget);
+
+    /**
+     * @brief Bind every editor in @p root that is not bound yet to its own leaf of @p port.
+     * @param replacing Widget @p root replaces; its editors are unbound and
+     *        their keys handed, in order, to the new editors first.
+     * @return Number of editors bound.
+     *
+     * Editors are @p root itself or, for containers, the editors found
+     * depth-first through its children, without descending into editors.
+     */
+    int bindEditors(PortId port, QWidget* root, QWidget* replacing = nullptr);
+
+    /**
+     * @brief Key @p widget is bound to, or one with an invalid port if it is unbound.
+     */
+    ParameterKey keyOf(const QWidget* widget) const;
+
+    /**
+     * @brief First leaf of @p port that no widget has been bound to.
+     */
+    ParameterKey nextKey(PortId port) const;
+
+    /**
+     * @brief Remove @p widget from whatever port it is bound to.
+     */
+    void unbind(QWidget* widget);
+
+    /**
+     * @brief Number of widgets currently bound to @p key.
+     */
+    int boundViewCount(ParameterKey key) const;
+
+    /**
+     * @brief Value kind edited by @p widget.
+     */
+    static ParameterStore::ValueType valueTypeOf(const QWidget* widget);
+
+private:
+    struct Binding
+    {
+        QWidget* widget = nullptr;
+        ParameterStore::ValueType type = ParameterStore::ValueType::Invalid;
+    };
+
+    void watch(ParameterKey key, QWidget* widget);
+    void storeEdit(ParameterKey key, const QVariant& value, QWidget* origin);
+    void onValueChanged(ParameterKey key, const QVariant& value, QObject* origin);
+    void onPortRemoved(PortId port);
+    static QVariant readWidget(const QWidget* widget);
+    static void writeWidget(QWidget* widget, ParameterStore::ValueType type, const QVariant& value);
+
+    ParameterStore& m_store;                       ///< Values the widgets edit.
+    QHash<ParameterKey, QVector<Binding>> m_views; ///< Bound widgets per key.
+    QHash<QWidget*, ParameterKey> m_widgetKeys;    ///< Reverse lookup for unbind.
+    QHash<PortId, int> m_leafCounts;               ///< One past the highest leaf bound per port.
+    bool m_applying = false;                       ///< Set while pushing values into bound widgets.
+};
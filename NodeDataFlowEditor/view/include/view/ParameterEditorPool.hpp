@@ -0,0 +1,89 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QVector>
+
+class ParameterBinder;
+class QGraphicsItem;
+class QGraphicsProxyWidget;
+class QWidget;
+struct QMetaObject;
+
+/**
+ * @brief Shared supply of live parameter editors for lazy nodes.
+ *
+ * A lazy NodeItem keeps the widget it was given off-scene, as the holder of
+ * the parameter's value, and paints a snapshot of it. When the user reaches
+ * the parameter, acquire() lends the node a proxy embedding an editor of the
+ * same class, set up like the parked widget and bound to the same value
+ * through the ParameterBinder; release() takes both back for the next node.
+ * Widgets the pool cannot stand in for (containers, custom classes, widgets
+ * without a bound value) are embedded themselves in a pooled proxy.
+ */
+class ParameterEditorPool
+{
+public:
+    /**
+     * @param binder Binder the lent editors are bound through.
+     * @param idleLimit Released editors kept per widget class, and released proxies kept.
+     */
+    explicit ParameterEditorPool(ParameterBinder& binder, int idleLimit = 4);
+    ~ParameterEditorPool();
+
+    ParameterEditorPool(const ParameterEditorPool&) = delete;
+    ParameterEditorPool& operator=(const ParameterEditorPool&) = delete;
+
+    /**
+     * @brief Lend a visible proxy, child of @p parent, whose editor stands in for @p source.
+     */
+    QGraphicsProxyWidget* acquire(QWidget* source, QGraphicsItem* parent);
+
+    /**
+     * @brief Take back a proxy lent for @p source; @p source is handed back hidden and unembedded.
+     */
+    void release(QGraphicsProxyWidget* proxy, QWidget* source);
+
+    /**
+     * @brief Released editors waiting for reuse, all classes together.
+     */
+    int idleEditorCount() const;
+
+    /**
+     * @brief Released proxies waiting for reuse.
+     */
+    int idleProxyCount() const;
+
+private:
+    QWidget* takeEditor(const QWidget& source);
+    static QWidget* makeEditor(const QMetaObject* type);
+    static void configure(QWidget& editor, const QWidget& source);
+
+    ParameterBinder& m_binder;                                  ///< Binds lent editors to their source's value.
+    int m_idleLimit;                                            ///< Cap per idle list.
+    QHash<const QMetaObject*, QVector<QWidget*>> m_idleEditors; ///< Released editors per widget class.
+    QVector<QGraphicsProxyWidget*> m_idleProxies;               ///< Released proxies, off-scene.
+};
@@ -24,6 +24,8 @@
 #pragma once
 
 #include "taggable/Taggable.hpp"
+#include "utility/GraphIds.hpp"
+#include "utility/Symbol.hpp"
 #include "view/ConnectionItem.hpp"
 
 #include <QColor>
@@ -180,6 +182,26 @@ public:
      * @return QString Module name
      */
     QString moduleName() const;
+
+    /**
+     * @brief Interned internal name, for integer comparisons.
+     */
+    Symbol nameSymbol() const;
+
+    /**
+     * @brief Interned parent module name, for integer comparisons.
+     */
+    Symbol moduleSymbol() const;
+
+    /**
+     * @brief Interned "<module>_<name>" key, the name a group gives the port it forwards to this one.
+     */
+    Symbol forwardedNameSymbol() const;
+
+    /**
+     * @brief Registry-assigned id, stable across renames; invalidGraphId until registered.
+     */
+    PortId id() const;
     ///@}
 
     /** @name Connections */
@@ -242,16 +264,27 @@ private:
      */
     void repositionLabel();
 
+    /**
+     * @brief Re-intern the name symbols after the name or module name changed.
+     */
+    void updateSymbols();
+
 private:
     PortView* m_portView = nullptr; ///< Visual component showing label + arrow
     QString m_portName;             ///< Internal port name
     QString m_portDisplayName;      ///< Displayed label
     QString m_moduleName;           ///< Parent module name
     Orientation m_orientation;      ///< Port orientation
+    Symbol m_nameSymbol;            ///< Interned m_portName
+    Symbol m_moduleSymbol;          ///< Interned m_moduleName
+    Symbol m_forwardedNameSymbol;   ///< Interned "<module>_<name>"
+    PortId m_id = invalidGraphId;   ///< Assigned by GraphRegistry
 
     bool m_hovered = false;                          ///< Hovered state
     bool m_clicked = false;                          ///< Clicked state
     QColor m_hoveredColor = QColor(0, 255, 0, 100);  ///< Highlight when hovered
     QColor m_clickedColor = QColor(80, 255, 0, 120); ///< Highlight when clicked
     QColor m_portColor = QColor(110, 110, 110);      ///< Base color
+
+    friend class GraphRegistry;
 };
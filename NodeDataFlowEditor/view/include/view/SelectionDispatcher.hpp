@@ -0,0 +1,122 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QVector>
+#include <functional>
+
+class QGraphicsItem;
+class QGraphicsScene;
+
+/**
+ * @brief Single listener of a scene's selection that notifies items whose state changed.
+ *
+ * Connecting every node to QGraphicsScene::selectionChanged costs one slot
+ * call per node on every selection change. The dispatcher is the only
+ * listener: on each change it diffs the scene's selected items against the
+ * previous selection and calls back only the watched items that were
+ * selected or deselected, so a change costs O(previous + current selection).
+ *
+ * Qt emits selectionChanged once per setSelected() call. Code selecting many
+ * items in a loop opens a Batch so the diff runs once, when the outermost
+ * batch closes, instead of once per item. GUI thread only.
+ */
+class SelectionDispatcher final : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Notify = std::function<void(bool selected)>;
+
+    /**
+     * @brief Defers dispatching until the outermost batch is destroyed.
+     */
+    class Batch
+    {
+    public:
+        /**
+         * @brief Open a batch on @p dispatcher; a null dispatcher makes the batch a no-op.
+         */
+        explicit Batch(SelectionDispatcher* dispatcher);
+        ~Batch();
+
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+
+    private:
+        SelectionDispatcher* m_dispatcher;
+    };
+
+    /**
+     * @brief Dispatch the selection changes of @p scene.
+     */
+    explicit SelectionDispatcher(QGraphicsScene* scene);
+
+    /**
+     * @brief Call @p notify whenever @p item gets selected or deselected.
+     *
+     * Replaces any previous watcher of @p item. The watcher is dropped when
+     * @p receiver is destroyed; items must be unwatched before they are deleted.
+     */
+    void watch(QGraphicsItem* item, QObject* receiver, Notify notify);
+
+    /**
+     * @brief Stop notifying @p item.
+     */
+    void unwatch(QGraphicsItem* item);
+
+    /**
+     * @brief Number of callbacks made so far.
+     */
+    qint64 notifications() const { return m_notifications; }
+
+private:
+    struct Watcher
+    {
+        QObject* receiver = nullptr;
+        Notify notify;
+    };
+
+    struct Receiver
+    {
+        QMetaObject::Connection destroyed; ///< Drops the receiver's watchers.
+        QVector<QGraphicsItem*> items;     ///< Items watched on behalf of the receiver.
+    };
+
+    void onSelectionChanged();
+    void onReceiverDestroyed(QObject* receiver);
+    void dispatch();
+
+    QGraphicsScene* m_scene;
+    QHash<QGraphicsItem*, Watcher> m_watchers; ///< Watched items and their callbacks.
+    QHash<QObject*, Receiver> m_receivers;     ///< Receivers with at least one watched item.
+    QSet<QGraphicsItem*> m_selected;           ///< Watched items selected at the last dispatch.
+    int m_batchDepth = 0;                      ///< Open batches.
+    bool m_pending = false;                    ///< Selection changed while a batch was open.
+    qint64 m_notifications = 0;                ///< Callbacks made.
+};
@@ -0,0 +1,280 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "factory/NodeFactory.hpp"
+#include "utility/GraphIds.hpp"
+
+#include <QColor>
+#include <QHash>
+#include <QObject>
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QVector>
+#include <memory>
+#include <vector>
+
+class ConnectionItem;
+class GraphScene;
+class QPainter;
+
+/**
+ * @brief Lightweight node store that only materializes real items near the viewport.
+ *
+ * Very large graphs cannot afford a NodeItem, with its labels, port children
+ * and proxies, per node. A VirtualGraph keeps every node as a small record
+ * (position, size, color, ports, edges) in a uniform-grid spatial index, and
+ * creates real nodes through the scene's NodeFactory only for the records
+ * intersecting the visible area plus a margin. Nodes leaving that area, with
+ * some hysteresis, write their position and title back to their record and
+ * are parked in a pool keyed by port layout, from which later records with the
+ * same ports are served by renaming instead of rebuilding.
+ *
+ * Wires with at least one non-materialized end are drawn in bulk by the scene
+ * background; wires between two materialized nodes are real ConnectionItems.
+ * Below the minimum scale nothing is materialized and records are drawn as
+ * plain rectangles.
+ *
+ * Only materialized nodes exist in the GraphRegistry, so snapshots, search
+ * and the minimap see the neighbourhood of the viewport, not the whole store;
+ * pooled nodes are parked in the registry and invisible to it until reused.
+ * Selected nodes stay materialized. Deleting a materialized node from the
+ * scene removes its record; wires the user draws or deletes between
+ * materialized nodes are added to or removed from the records, so they
+ * survive the nodes being released. GUI thread only.
+ */
+class VirtualGraph final : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Construct an empty store materializing nodes into @p scene.
+     */
+    explicit VirtualGraph(GraphScene* scene);
+    ~VirtualGraph() override;
+
+    /**
+     * @brief Add a node record.
+     * @return Index of the record, stable for the lifetime of the store.
+     *
+     * Records sharing their port lists share one copy of them and one item pool.
+     */
+    int addNode(const QString& name,
+                const QString& displayedName,
+                const QPointF& pos,
+                const QColor& color,
+                const QStringList& inputs,
+                const QStringList& outputs);
+
+    /**
+     * @brief Connect output @p output of record @p from to input @p input of record @p to.
+     * @return Index of the edge, or -1 if a record or a port does not exist.
+     *
+     * Edge indices are stable; edges deleted by the user leave a gap.
+     */
+    int addConnection(int from, const QString& output, int to, const QString& input);
+
+    /**
+     * @brief Report the scene area shown by a view and its zoom factor.
+     *
+     * Calls are coalesced; the materialized set is brought up to date on the
+     * next event loop iteration, or by sync().
+     */
+    void setViewport(const QRectF& visible, qreal scale);
+
+    /**
+     * @brief Materialize and release nodes for the last reported viewport now.
+     */
+    void sync();
+
+    /**
+     * @brief Draw the wires and placeholder rectangles not covered by real items.
+     * @param painter Painter of the scene background.
+     * @param exposed Scene area being painted.
+     */
+    void paint(QPainter* painter, const QRectF& exposed) const;
+
+    /**
+     * @brief Distance, in scene units, around the viewport in which nodes are materialized.
+     *
+     * Nodes are released once they are farther than twice this distance.
+     */
+    void setMargin(qreal margin);
+    qreal margin() const;
+
+    /**
+     * @brief Zoom factor below which nodes are drawn as rectangles instead of materialized.
+     */
+    void setMinimumScale(qreal scale);
+    qreal minimumScale() const;
+
+    /**
+     * @brief Upper bound on the number of materialized nodes.
+     */
+    void setMaxMaterialized(int count);
+    int maxMaterialized() const;
+
+    /**
+     * @brief Number of released items kept for reuse, per port layout.
+     */
+    void setPoolCapacity(int count);
+    int poolCapacity() const;
+
+    int nodeCount() const;
+    int connectionCount() const;
+    int materializedCount() const;
+    int pooledCount() const;
+
+    /**
+     * @brief Number of nodes built from scratch, as opposed to served from the pool.
+     */
+    int createdCount() const;
+
+    /**
+     * @brief Real item of record @p index, or nullptr when it is not materialized.
+     */
+    NodeItem* item(int index) const;
+
+    /**
+     * @brief Scene bounds of record @p index, from its item when materialized.
+     */
+    QRectF bounds(int index) const;
+
+    /**
+     * @brief Bounds of every record.
+     */
+    QRectF itemsBoundingRect() const;
+
+private:
+    /**
+     * @brief Port layout shared by records with identical port lists.
+     */
+    struct Signature
+    {
+        QStringList inputs;
+        QStringList outputs;
+        QRectF rect;                    ///< Node bounds relative to its position.
+        QVector<QPointF> inputAnchors;  ///< Wire ends relative to the node position.
+        QVector<QPointF> outputAnchors; ///< Wire starts relative to the node position.
+        bool measured = false;          ///< Whether the geometry comes from a real item.
+
+        std::vector<std::unique_ptr<NodeFactory::Node>> pool; ///< Parked, hidden nodes.
+    };
+
+    struct Record
+    {
+        QString name;
+        QString displayedName;
+        QPointF pos;
+        QColor color;
+        int signature = -1;
+        QVector<int> edges;                      ///< Incoming and outgoing edge indices.
+        std::unique_ptr<NodeFactory::Node> node; ///< Set while materialized.
+        bool removed = false;                    ///< Deleted from the scene while materialized.
+    };
+
+    struct Edge
+    {
+        int from = -1;
+        int output = -1;
+        int to = -1;
+        int input = -1;
+        ConnectionId connection = invalidGraphId; ///< Real wire while both ends are materialized.
+        bool removed = false;                     ///< Deleted by the user.
+    };
+
+    /// Index of the signature for these port lists, created on first use.
+    int signatureFor(const QStringList& inputs, const QStringList& outputs);
+    /// Rectangle of record @p index as stored, without looking at its item.
+    QRectF recordRect(int index) const;
+    /// Area indexed for @p edge: the box spanned by the positions of its ends.
+    QRectF edgeRect(const Edge& edge) const;
+    /// Wire end points of @p edge, from real ports when materialized.
+    QPointF outputAnchor(const Edge& edge) const;
+    QPointF inputAnchor(const Edge& edge) const;
+
+    void materialize(int index);
+    void release(int index);
+    /// Creates the real wires of record @p index towards materialized neighbours.
+    void connectEdges(int index);
+    /// Deletes the real wires of record @p index.
+    void disconnectEdges(int index);
+    /// Takes the geometry of a real item of @p signature as the layout of every such record.
+    void measure(int signature, const NodeItem& item);
+    /// Forgets a record whose item was deleted from the scene.
+    void onItemDestroyed(int index);
+    /// Stores @p edge, links it to its records and indexes it.
+    int appendEdge(const Edge& edge);
+    /// Index of the materialized record shown by @p item, or -1.
+    int liveRecordOf(const NodeItem* item) const;
+    /// Records a wire the user drew between two materialized records.
+    void onConnectionCreated(ConnectionItem* connection);
+    /// Drops the edge of a wire the user deleted.
+    void onConnectionDeleted(ConnectionItem* connection);
+
+    void indexNode(int index);
+    void unindexNode(int index);
+    void indexEdge(int index);
+    void unindexEdge(int index);
+    /// Calls @p fn once per record whose bounds may overlap @p area.
+    template <typename Fn>
+    void forEachNodeIn(const QRectF& area, Fn&& fn) const;
+    /// Calls @p fn once per edge whose wire may overlap @p area.
+    template <typename Fn>
+    void forEachEdgeIn(const QRectF& area, Fn&& fn) const;
+
+    GraphScene* m_scene;                    ///< Scene real nodes are materialized into.
+    std::shared_ptr<NodeFactory> m_factory; ///< Builds the real nodes and wires.
+
+    std::vector<Record> m_records;       ///< Records by index.
+    std::vector<Edge> m_edges;           ///< Edges by index.
+    int m_removedEdges = 0;              ///< Edges deleted by the user.
+    std::vector<Signature> m_signatures; ///< Port layouts by index.
+    QHash<QString, int> m_signatureIds;  ///< Joined port names → signature index.
+    QVector<int> m_live;                 ///< Materialized record indices.
+
+    QHash<quint64, QVector<int>> m_nodeCells;  ///< Grid cell of a node position → record indices.
+    QHash<quint64, QVector<int>> m_edgeCells;  ///< Grid cell → indices of the edges crossing it.
+    QVector<int> m_longEdges;                  ///< Edges spanning too many cells to index.
+    mutable std::vector<quint32> m_edgeStamps; ///< Per edge, last query that visited it.
+    mutable quint32 m_stamp = 0;               ///< Current query, for m_edgeStamps.
+
+    QRectF m_bounds;      ///< Bounds of every record.
+    qreal m_extent = 0.0; ///< Farthest a node's bounds or anchors reach from its position.
+    QRectF m_visible;     ///< Last reported visible area.
+    qreal m_scale = 1.0;  ///< Last reported zoom factor.
+
+    qreal m_margin = 400.0;       ///< See setMargin().
+    qreal m_minimumScale = 0.35;  ///< See setMinimumScale().
+    int m_maxMaterialized = 2000; ///< See setMaxMaterialized().
+    int m_poolCapacity = 32;      ///< See setPoolCapacity().
+    int m_pooled = 0;             ///< Parked nodes across all signatures.
+    int m_created = 0;            ///< See createdCount().
+    QTimer m_syncTimer;           ///< Coalesces viewport reports.
+};
@@ -30,6 +30,73 @@
 #include <QtMath>
 #include <QStyleOption>
 #include <QDebug>
+#include <algorithm>
+
+namespace
+{
+    // Width of the selection hit area around the curve.
+    constexpr qreal hitWidth = 10.0;
+    // Widest stroke painted (selection glow, flow dots), plus antialiasing.
+    constexpr qreal paintMargin = 6.0;
+
+    qreal
+    squaredDistanceToSegment(const QPointF& p, const QPointF& a, const QPointF& b)
+    {
+        const QPointF ab = b - a;
+        const qreal length2 = QPointF::dotProduct(ab, ab);
+        const qreal t = length2 > 0 ? std::clamp(QPointF::dotProduct(p - a, ab) / length2, 0.0, 1.0) : 0.0;
+        const QPointF d = p - (a + t * ab);
+        return QPointF::dotProduct(d, d);
+    }
+
+    // Liang-Barsky: whether segment a-b has a part inside @p r.
+    bool
+    segmentIntersects(const QRectF& r, const QPointF& a, const QPointF& b)
+    {
+        const qreal dx = b.x() - a.x();
+        const qreal dy = b.y() - a.y();
+        const qreal p[4] = {-dx, dx, -dy, dy};
+        const qreal q[4] = {a.x() - r.left(), r.right() - a.x(), a.y() - r.top(), r.bottom() - a.y()};
+        qreal t0 = 0.0;
+        qreal t1 = 1.0;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (p[i] == 0.0)
+            {
+                if (q[i] < 0.0)
+                    return false;
+                continue;
+            }
+            const qreal t = q[i] / p[i];
+            if (p[i] < 0.0)
+                t0 = std::max(t0, t);
+            else
+                t1 = std::min(t1, t);
+            if (t0 > t1)
+                return false;
+        }
+        return true;
+    }
+
+    // Whether @p path is an axis-aligned rectangle, as built by rubber-band selection.
+    bool
+    asRect(const QPainterPath& path, QRectF* rect)
+    {
+        if (path.elementCount() != 5 || !path.elementAt(0).isMoveTo())
+            return false;
+        for (int i = 1; i < 5; ++i)
+        {
+            const QPainterPath::Element a = path.elementAt(i - 1);
+            const QPainterPath::Element b = path.elementAt(i);
+            if (!b.isLineTo() || (a.x != b.x && a.y != b.y))
+                return false;
+        }
+        if (path.elementAt(0).x != path.elementAt(4).x || path.elementAt(0).y != path.elementAt(4).y)
+            return false;
+        *rect = path.controlPointRect();
+        return true;
+    }
+}
 
 ConnectionItem::ConnectionItem(const ConnectionPort& port, QGraphicsItem* parent)
     : QGraphicsPathItem(parent)
@@ -84,6 +151,22 @@ ConnectionItem::addPort(const ConnectionPort& port)
     updatePath();
 }
 
+void
+ConnectionItem::reset(const ConnectionPort& port)
+{
+    setIsActive(false);
+    setSelected(false);
+    m_inputPort = ConnectionPort();
+    m_outputPort = ConnectionPort();
+    m_endPoint = QPointF();
+    m_isCompatible = false;
+    setPen(QPen(Qt::red, 2));
+    m_route.clear();
+    setCurrentPath(QPainterPath());
+
+    addPort(port);
+}
+
 ConnectionItem::~ConnectionItem()
 {
     m_isDestroying = true;
@@ -124,6 +207,31 @@ ConnectionItem::outputPort() const
     return m_outputPort;
 }
 
+ConnectionId
+ConnectionItem::id() const
+{
+    return m_id;
+}
+
+QLineF
+ConnectionItem::anchors() const
+{
+    return {computeOutputPoint(m_inputPort), computeInputPoint(m_outputPort)};
+}
+
+void
+ConnectionItem::setRoute(const QPolygonF& route)
+{
+    m_route = route;
+    updatePath();
+}
+
+QPolygonF
+ConnectionItem::route() const
+{
+    return m_route;
+}
+
 void
 ConnectionItem::updateAnimationStatus()
 {
@@ -148,8 +256,6 @@ ConnectionItem::computeOutputPoint(const ConnectionPort& port) const
 void
 ConnectionItem::drawPath(const QPointF& startPoint, const QPointF& endPoint)
 {
-    prepareGeometryChange();
-
     if (startPoint == endPoint)
         return;
     if (startPoint.isNull() || endPoint.isNull())
@@ -159,18 +265,51 @@ ConnectionItem::drawPath(const QPointF& startPoint, const QPointF& endPoint)
         setPen(QPen(Qt::green, 2));
     else if (!m_isCompatible)
         setPen(QPen(Qt::red, 2));
+    // A route computed for other endpoints is stale; drop it and draw the curve.
+    if (!m_route.isEmpty() && (m_route.first() != startPoint || m_route.last() != endPoint))
+        m_route.clear();
+
     QPainterPath path(startPoint);
-    qreal dx = endPoint.x() - startPoint.x();
-    QPointF ctrl1 = startPoint + QPointF(dx * 0.25, 0);
-    QPointF ctrl2 = endPoint - QPointF(dx * 0.25, 0);
-    path.cubicTo(ctrl1, ctrl2, endPoint);
+    if (m_route.size() >= 2)
+    {
+        constexpr qreal cornerRadius = 6.0;
+        for (int i = 1; i < m_route.size() - 1; ++i)
+        {
+            const QPointF corner = m_route[i];
+            const QLineF in(corner, m_route[i - 1]);
+            const QLineF out(corner, m_route[i + 1]);
+            const qreal r = std::min({cornerRadius, in.length() / 2, out.length() / 2});
+            path.lineTo(in.pointAt(in.length() > 0 ? r / in.length() : 0));
+            path.quadTo(corner, out.pointAt(out.length() > 0 ? r / out.length() : 0));
+        }
+        path.lineTo(endPoint);
+    }
+    else
+    {
+        qreal dx = endPoint.x() - startPoint.x();
+        QPointF ctrl1 = startPoint + QPointF(dx * 0.25, 0);
+        QPointF ctrl2 = endPoint - QPointF(dx * 0.25, 0);
+        path.cubicTo(ctrl1, ctrl2, endPoint);
+    }
 
-    m_currentPath = path;
-    setPath(path);
+    setCurrentPath(path);
 
     updateAnimationStatus();
 }
 
+void
+ConnectionItem::setCurrentPath(const QPainterPath& path)
+{
+    // boundingRect() returns m_bounds; Qt must see the old rect before it changes.
+    prepareGeometryChange();
+    m_currentPath = path;
+    m_polyline = path.isEmpty() ? QPolygonF() : path.toSubpathPolygons().value(0);
+    m_bounds = path.isEmpty() ? QRectF() : path.controlPointRect().adjusted(-paintMargin, -paintMargin, paintMargin, paintMargin);
+    m_shapeValid = false;
+    m_shape = QPainterPath();
+    setPath(path);
+}
+
 void
 ConnectionItem::setIsCompatible(bool newIsCompatible)
 {
@@ -228,12 +367,64 @@ ConnectionItem::updatePath()
         drawPath(startPoint, m_endPoint);
 }
 
+QRectF
+ConnectionItem::boundingRect() const
+{
+    return m_bounds;
+}
+
 QPainterPath
 ConnectionItem::shape() const
 {
-    QPainterPathStroker stroker;
-    stroker.setWidth(10); // thickness for selection hit area
-    return stroker.createStroke(m_currentPath);
+    if (!m_shapeValid)
+    {
+        QPainterPathStroker stroker;
+        stroker.setWidth(hitWidth);
+        m_shape = stroker.createStroke(m_currentPath);
+        m_shapeValid = true;
+    }
+    return m_shape;
+}
+
+bool
+ConnectionItem::contains(const QPointF& point) const
+{
+    if (m_polyline.isEmpty() || !m_bounds.contains(point))
+        return false;
+
+    const qreal radius2 = (hitWidth / 2) * (hitWidth / 2);
+    if (m_polyline.size() == 1)
+        return squaredDistanceToSegment(point, m_polyline.first(), m_polyline.first()) <= radius2;
+    for (int i = 1; i < m_polyline.size(); ++i)
+        if (squaredDistanceToSegment(point, m_polyline[i - 1], m_polyline[i]) <= radius2)
+            return true;
+    return false;
+}
+
+bool
+ConnectionItem::collidesWithPath(const QPainterPath& path, Qt::ItemSelectionMode mode) const
+{
+    QRectF rect;
+    if ((mode != Qt::IntersectsItemShape && mode != Qt::ContainsItemShape) || !asRect(path, &rect))
+        return QGraphicsPathItem::collidesWithPath(path, mode);
+    if (m_polyline.isEmpty())
+        return false;
+
+    constexpr qreal half = hitWidth / 2;
+    const QRectF hitBounds = m_polyline.boundingRect().adjusted(-half, -half, half, half);
+    if (mode == Qt::ContainsItemShape)
+        return rect.contains(hitBounds);
+
+    if (!rect.intersects(hitBounds))
+        return false;
+    // The hit area reaches half its width from the curve; grow the rectangle instead.
+    const QRectF grown = rect.adjusted(-half, -half, half, half);
+    if (m_polyline.size() == 1)
+        return grown.contains(m_polyline.first());
+    for (int i = 1; i < m_polyline.size(); ++i)
+        if (segmentIntersects(grown, m_polyline[i - 1], m_polyline[i]))
+            return true;
+    return false;
 }
 
 void
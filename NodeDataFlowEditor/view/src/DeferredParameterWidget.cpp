@@ -0,0 +1,85 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/DeferredParameterWidget.hpp"
+
+#include <QEvent>
+#include <QMetaProperty>
+#include <QPainter>
+
+DeferredParameterWidget::DeferredParameterWidget(QWidget* source, QWidget* parent)
+    : QWidget(parent)
+    , m_source(source)
+{
+    setFocusPolicy(Qt::StrongFocus);
+    if (source)
+        resize(source->sizeHint());
+}
+
+QWidget*
+DeferredParameterWidget::source() const
+{
+    return m_source;
+}
+
+QVariant
+DeferredParameterWidget::value() const
+{
+    if (!m_source)
+        return {};
+
+    const QMetaProperty userProperty = m_source->metaObject()->userProperty();
+    return userProperty.isValid() ? userProperty.read(m_source) : QVariant();
+}
+
+bool
+DeferredParameterWidget::event(QEvent* event)
+{
+    switch (event->type())
+    {
+    case QEvent::Enter:
+    case QEvent::FocusIn:
+    case QEvent::MouseButtonPress:
+        if (!m_activated)
+        {
+            m_activated = true;
+            emit sgnActivated();
+        }
+        break;
+    default:
+        break;
+    }
+    return QWidget::event(event);
+}
+
+void
+DeferredParameterWidget::paintEvent(QPaintEvent*)
+{
+    // Painting, including snapshots taken with grab(), must not build the editor.
+    if (!m_source)
+        return;
+
+    QPainter painter(this);
+    m_source->render(&painter);
+}
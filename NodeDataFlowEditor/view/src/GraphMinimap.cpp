@@ -0,0 +1,560 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/GraphMinimap.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "utility/GraphSnapshot.hpp"
+#include "view/GraphScene.hpp"
+#include "view/GraphView.hpp"
+
+#include <QMouseEvent>
+#include <QPainter>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr int defaultRefreshMs = 250;
+    // Past this many changed areas one full redraw is cheaper than many clipped ones.
+    constexpr int maxDirtyAreas = 64;
+    constexpr qreal worldMargin = 200.0;
+    // Scene units per side of a grid cell, and the most cells an edge is indexed in.
+    constexpr qreal cellSize = 512.0;
+    constexpr int maxEdgeCells = 64;
+
+    const QColor backgroundColor(25, 25, 25);
+    const QColor edgeColor(110, 110, 110);
+    const QColor viewportPenColor(255, 255, 255, 200);
+    const QColor viewportFillColor(255, 255, 255, 30);
+
+    QLineF
+    edgeLine(const QRectF& from, const QRectF& to)
+    {
+        return {QPointF(from.right(), from.center().y()), QPointF(to.left(), to.center().y())};
+    }
+
+    QRectF
+    edgeBounds(const QRectF& from, const QRectF& to)
+    {
+        const QLineF line = edgeLine(from, to);
+        return QRectF(line.p1(), line.p2()).normalized();
+    }
+
+    quint64
+    cellKey(int cx, int cy)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(cx)) << 32) | static_cast<quint32>(cy);
+    }
+
+    int
+    cellOf(qreal v)
+    {
+        return static_cast<int>(std::floor(v / cellSize));
+    }
+
+    // Grid cells covered by @p area, as a rect of cell coordinates.
+    QRect
+    cellRange(const QRectF& area)
+    {
+        return QRect(QPoint(cellOf(area.left()), cellOf(area.top())), QPoint(cellOf(area.right()), cellOf(area.bottom())));
+    }
+}
+
+GraphMinimap::GraphMinimap(GraphScene* scene, GraphView* view, QWidget* parent)
+    : QWidget(parent)
+    , m_view(view)
+    , m_registry(scene ? scene->getGraphRegistry() : nullptr)
+{
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    setCursor(Qt::PointingHandCursor);
+    setMinimumSize(80, 60);
+
+    m_refreshTimer.setInterval(defaultRefreshMs);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &GraphMinimap::refresh);
+}
+
+void
+GraphMinimap::setShowEdges(bool show)
+{
+    if (m_showEdges == show)
+        return;
+    m_showEdges = show;
+    if (!m_image.isNull())
+        renderAll();
+    update();
+}
+
+bool
+GraphMinimap::showEdges() const
+{
+    return m_showEdges;
+}
+
+void
+GraphMinimap::setRefreshInterval(int ms)
+{
+    m_refreshTimer.setInterval(std::max(ms, 1));
+}
+
+int
+GraphMinimap::refreshInterval() const
+{
+    return m_refreshTimer.interval();
+}
+
+const QImage&
+GraphMinimap::image() const
+{
+    return m_image;
+}
+
+int
+GraphMinimap::fullRenderCount() const
+{
+    return m_fullRenders;
+}
+
+void
+GraphMinimap::refresh()
+{
+    if (!m_registry)
+        return;
+
+    bool changed = false;
+
+    // Cheap when nothing changed: the registry hands back the published snapshot.
+    auto next = m_registry->snapshot();
+    const bool resized = m_image.size() != size();
+    if (next != m_snapshot || resized)
+    {
+        QVector<QRectF> dirty;
+        const bool rebuild = !m_snapshot || !next;
+        if (rebuild)
+        {
+            m_entries.clear();
+            m_incoming.clear();
+            m_nodeCells.clear();
+            m_edgeCells.clear();
+            m_longEdges.clear();
+            if (next)
+                next->forEachNode([this](const NodeRecord& r) { applyChange(nullptr, &r, nullptr); });
+        }
+        else if (next != m_snapshot)
+        {
+            next->forEachNodeChange(*m_snapshot, [this, &dirty](const NodeRecord* before, const NodeRecord* after) {
+                applyChange(before, after, &dirty);
+            });
+        }
+        m_snapshot = std::move(next);
+
+        const bool outside = std::any_of(dirty.cbegin(), dirty.cend(), [this](const QRectF& r) {
+            return !m_world.contains(r);
+        });
+        if (rebuild || resized || outside || dirty.size() > maxDirtyAreas)
+        {
+            renderAll();
+        }
+        else
+        {
+            for (const QRectF& area : std::as_const(dirty))
+                renderArea(area);
+        }
+        changed = true;
+    }
+
+    if (const QRectF visible = visibleSceneRect(); visible != m_viewportRect)
+    {
+        m_viewportRect = visible;
+        changed = true;
+    }
+
+    if (changed)
+        update();
+}
+
+void
+GraphMinimap::applyChange(const NodeRecord* before, const NodeRecord* after, QVector<QRectF>* dirty)
+{
+    if (before)
+    {
+        const qint64 uid = before->uid;
+        auto it = m_entries.find(uid);
+        if (it != m_entries.end())
+        {
+            if (dirty)
+                collectDirty(uid, *dirty);
+            unindexEntry(uid);
+            for (qint64 target : std::as_const(it->targets))
+            {
+                auto in = m_incoming.find(target);
+                if (in == m_incoming.end())
+                    continue;
+                in->removeOne(uid);
+                if (in->isEmpty())
+                    m_incoming.erase(in);
+            }
+            m_entries.erase(it);
+        }
+    }
+
+    if (!after || !after->visible)
+        return;
+
+    Entry entry;
+    entry.rect = QRectF(after->position, after->size);
+    entry.color = after->titleColor;
+    entry.targets.reserve(after->outgoing.size());
+    for (const EdgeRecord& edge : after->outgoing)
+    {
+        entry.targets.append(edge.toNode);
+        m_incoming[edge.toNode].append(after->uid);
+    }
+    m_entries.insert(after->uid, entry);
+    indexEntry(after->uid);
+
+    if (dirty)
+        collectDirty(after->uid, *dirty);
+}
+
+void
+GraphMinimap::collectDirty(qint64 uid, QVector<QRectF>& dirty) const
+{
+    auto it = m_entries.constFind(uid);
+    if (it == m_entries.constEnd())
+        return;
+
+    dirty.append(it->rect);
+    if (!m_showEdges)
+        return;
+
+    for (qint64 target : it->targets)
+    {
+        auto other = m_entries.constFind(target);
+        if (other != m_entries.constEnd())
+            dirty.append(edgeBounds(it->rect, other->rect));
+    }
+    for (qint64 source : m_incoming.value(uid))
+    {
+        auto other = m_entries.constFind(source);
+        if (other != m_entries.constEnd())
+            dirty.append(edgeBounds(other->rect, it->rect));
+    }
+}
+
+void
+GraphMinimap::indexEntry(qint64 uid)
+{
+    const Entry& entry = *m_entries.constFind(uid);
+    m_nodeCells[cellKey(cellOf(entry.rect.left()), cellOf(entry.rect.top()))].append(uid);
+    m_extent = std::max({m_extent, entry.rect.width(), entry.rect.height()});
+
+    // Each edge is indexed once, when the later of its two nodes arrives.
+    for (qint64 target : entry.targets)
+        if (m_entries.contains(target))
+            indexEdge({uid, target}, true);
+    for (qint64 source : m_incoming.value(uid))
+        if (source != uid && m_entries.contains(source))
+            indexEdge({source, uid}, true);
+}
+
+void
+GraphMinimap::unindexEntry(qint64 uid)
+{
+    const Entry& entry = *m_entries.constFind(uid);
+    for (qint64 target : entry.targets)
+        if (m_entries.contains(target))
+            indexEdge({uid, target}, false);
+    for (qint64 source : m_incoming.value(uid))
+        if (source != uid && m_entries.contains(source))
+            indexEdge({source, uid}, false);
+
+    auto cell = m_nodeCells.find(cellKey(cellOf(entry.rect.left()), cellOf(entry.rect.top())));
+    if (cell == m_nodeCells.end())
+        return;
+    cell->removeOne(uid);
+    if (cell->isEmpty())
+        m_nodeCells.erase(cell);
+}
+
+void
+GraphMinimap::indexEdge(const EdgeKey& edge, bool add)
+{
+    const QRect cells = cellRange(edgeBounds(m_entries.constFind(edge.first)->rect, m_entries.constFind(edge.second)->rect));
+    if (cells.width() * cells.height() > maxEdgeCells)
+    {
+        if (add)
+            m_longEdges.append(edge);
+        else
+            m_longEdges.removeOne(edge);
+        return;
+    }
+    for (int cx = cells.left(); cx <= cells.right(); ++cx)
+    {
+        for (int cy = cells.top(); cy <= cells.bottom(); ++cy)
+        {
+            if (add)
+            {
+                m_edgeCells[cellKey(cx, cy)].append(edge);
+                continue;
+            }
+            auto it = m_edgeCells.find(cellKey(cx, cy));
+            if (it == m_edgeCells.end())
+                continue;
+            it->removeOne(edge);
+            if (it->isEmpty())
+                m_edgeCells.erase(it);
+        }
+    }
+}
+
+void
+GraphMinimap::renderAll()
+{
+    ++m_fullRenders;
+
+    if (m_image.size() != size())
+        m_image = QImage(size(), QImage::Format_ARGB32_Premultiplied);
+    if (m_image.isNull())
+        return;
+    m_image.fill(backgroundColor);
+
+    QRectF bounds;
+    for (const Entry& entry : std::as_const(m_entries))
+        bounds |= entry.rect;
+    if (bounds.isEmpty())
+        bounds = QRectF(-worldMargin, -worldMargin, 2 * worldMargin, 2 * worldMargin);
+
+    // Leave room around the graph so small moves near its border stay incremental.
+    const qreal margin = std::max(worldMargin, 0.05 * std::max(bounds.width(), bounds.height()));
+    m_world = bounds.adjusted(-margin, -margin, margin, margin);
+
+    m_scale = std::min(m_image.width() / m_world.width(), m_image.height() / m_world.height());
+    m_offset = QPointF((m_image.width() - m_world.width() * m_scale) / 2.0,
+                       (m_image.height() - m_world.height() * m_scale) / 2.0);
+
+    QPainter painter(&m_image);
+    drawContents(painter, m_world);
+}
+
+void
+GraphMinimap::renderArea(const QRectF& area)
+{
+    // Work on whole pixels, padded by one, so partially covered pixels are redrawn
+    // from everything that touches them.
+    const QRect target = toImage(area).toAlignedRect().adjusted(-1, -1, 1, 1);
+    const QRectF sceneArea(mapToScene(target.topLeft()), mapToScene(target.bottomRight() + QPoint(1, 1)));
+
+    QPainter painter(&m_image);
+    painter.setClipRect(target);
+    painter.fillRect(target, backgroundColor);
+    drawContents(painter, sceneArea);
+}
+
+void
+GraphMinimap::drawContents(QPainter& painter, const QRectF& area) const
+{
+    auto drawEdge = [&](const QRectF& from, const QRectF& to) {
+        if (!edgeBounds(from, to).intersects(area))
+            return;
+        const QLineF line = edgeLine(from, to);
+        painter.drawLine(QLineF(mapFromScene(line.p1()), mapFromScene(line.p2())));
+    };
+    auto drawNode = [&](const Entry& entry) {
+        if (!entry.rect.intersects(area))
+            return;
+        QRectF r = toImage(entry.rect);
+        // Keep tiny nodes visible when zoomed far out.
+        r.setSize(r.size().expandedTo(QSizeF(1.0, 1.0)));
+        painter.fillRect(r, entry.color);
+    };
+
+    // Nodes are indexed by their top-left corner, so look as far back as a node reaches.
+    const QRect nodeCells = cellRange(area.adjusted(-m_extent, -m_extent, 0, 0));
+    const QRect edgeCells = cellRange(area);
+
+    // A full redraw covers more cells than there are nodes; walking every entry is cheaper then.
+    if (static_cast<qint64>(nodeCells.width()) * nodeCells.height() > m_entries.size())
+    {
+        if (m_showEdges)
+        {
+            painter.setPen(edgeColor);
+            for (const Entry& entry : std::as_const(m_entries))
+            {
+                for (qint64 target : entry.targets)
+                {
+                    auto other = m_entries.constFind(target);
+                    if (other != m_entries.constEnd())
+                        drawEdge(entry.rect, other->rect);
+                }
+            }
+        }
+        for (const Entry& entry : std::as_const(m_entries))
+            drawNode(entry);
+        return;
+    }
+
+    if (m_showEdges)
+    {
+        painter.setPen(edgeColor);
+        for (int cx = edgeCells.left(); cx <= edgeCells.right(); ++cx)
+        {
+            for (int cy = edgeCells.top(); cy <= edgeCells.bottom(); ++cy)
+            {
+                const auto it = m_edgeCells.constFind(cellKey(cx, cy));
+                if (it == m_edgeCells.constEnd())
+                    continue;
+                for (const EdgeKey& edge : it.value())
+                {
+                    const QRectF& from = m_entries.constFind(edge.first)->rect;
+                    const QRectF& to = m_entries.constFind(edge.second)->rect;
+                    // Draw each edge once, from the first queried cell it crosses.
+                    const QRect own = cellRange(edgeBounds(from, to));
+                    if (cx == std::max(own.left(), edgeCells.left()) && cy == std::max(own.top(), edgeCells.top()))
+                        drawEdge(from, to);
+                }
+            }
+        }
+        for (const EdgeKey& edge : m_longEdges)
+            drawEdge(m_entries.constFind(edge.first)->rect, m_entries.constFind(edge.second)->rect);
+    }
+
+    for (int cx = nodeCells.left(); cx <= nodeCells.right(); ++cx)
+    {
+        for (int cy = nodeCells.top(); cy <= nodeCells.bottom(); ++cy)
+        {
+            const auto it = m_nodeCells.constFind(cellKey(cx, cy));
+            if (it == m_nodeCells.constEnd())
+                continue;
+            for (qint64 uid : it.value())
+                drawNode(*m_entries.constFind(uid));
+        }
+    }
+}
+
+QRectF
+GraphMinimap::toImage(const QRectF& rect) const
+{
+    return {mapFromScene(rect.topLeft()), rect.size() * m_scale};
+}
+
+QPointF
+GraphMinimap::mapToScene(const QPointF& pos) const
+{
+    return m_world.topLeft() + (pos - m_offset) / m_scale;
+}
+
+QPointF
+GraphMinimap::mapFromScene(const QPointF& pos) const
+{
+    return m_offset + (pos - m_world.topLeft()) * m_scale;
+}
+
+QRectF
+GraphMinimap::visibleSceneRect() const
+{
+    if (!m_view)
+        return {};
+    return m_view->mapToScene(m_view->viewport()->rect()).boundingRect();
+}
+
+void
+GraphMinimap::centerViewAt(const QPointF& pos)
+{
+    if (!m_view || m_image.isNull())
+        return;
+
+    m_view->centerOn(mapToScene(pos));
+    m_viewportRect = visibleSceneRect();
+    update();
+}
+
+void
+GraphMinimap::paintEvent(QPaintEvent*)
+{
+    QPainter painter(this);
+    painter.fillRect(rect(), backgroundColor);
+    painter.drawImage(QPointF(0, 0), m_image);
+
+    if (m_viewportRect.isEmpty() || m_image.isNull())
+        return;
+
+    painter.setPen(viewportPenColor);
+    painter.setBrush(viewportFillColor);
+    painter.drawRect(toImage(m_viewportRect).intersected(QRectF(rect()).adjusted(0, 0, -1, -1)));
+}
+
+void
+GraphMinimap::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+    refresh();
+}
+
+void
+GraphMinimap::showEvent(QShowEvent* event)
+{
+    QWidget::showEvent(event);
+    refresh();
+    m_refreshTimer.start();
+}
+
+void
+GraphMinimap::hideEvent(QHideEvent* event)
+{
+    QWidget::hideEvent(event);
+    m_refreshTimer.stop();
+}
+
+void
+GraphMinimap::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() != Qt::LeftButton)
+    {
+        QWidget::mousePressEvent(event);
+        return;
+    }
+    m_dragging = true;
+    centerViewAt(event->pos());
+    event->accept();
+}
+
+void
+GraphMinimap::mouseMoveEvent(QMouseEvent* event)
+{
+    if (!m_dragging)
+    {
+        QWidget::mouseMoveEvent(event);
+        return;
+    }
+    centerViewAt(event->pos());
+    event->accept();
+}
+
+void
+GraphMinimap::mouseReleaseEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton)
+        m_dragging = false;
+    QWidget::mouseReleaseEvent(event);
+}
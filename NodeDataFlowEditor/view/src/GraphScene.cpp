@@ -27,12 +27,17 @@
 #include "factory/NodeFactory.hpp"
 #include "utility/GraphRegistry.hpp"
 #include "utility/GroupDescriptor.hpp"
+#include "utility/LayeredLayout.hpp"
 #include "utility/NodeDescriptor.hpp"
 #include "utility/NodeHelper.hpp"
+#include "utility/NodeProfiler.hpp"
+#include "utility/WireRouter.hpp"
 #include "view/ConnectionItem.hpp"
 #include "view/GroupItem.hpp"
 #include "view/NodeItem.hpp"
 #include "view/PortLabel.hpp"
+#include "view/SelectionDispatcher.hpp"
+#include "view/VirtualGraph.hpp"
 
 #include <QApplication>
 #include <QDir>
@@ -40,17 +45,69 @@
 #include <QGraphicsView>
 #include <QKeyEvent>
 #include <QMenu>
+#include <QSet>
+#include <QThread>
 #include <QWidget>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr qreal routeCellSize = 512.0;
+    // Routes spanning more cells than this are kept in one list checked by every move.
+    constexpr int maxRouteCells = 64;
+
+    quint64
+    cellKey(int cx, int cy)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(cx)) << 32) | static_cast<quint32>(cy);
+    }
+
+    int
+    cellOf(qreal v)
+    {
+        return static_cast<int>(std::floor(v / routeCellSize));
+    }
+} // namespace
 
 GraphScene::GraphScene(QObject* parent)
     : QGraphicsScene(parent)
     , m_registry(std::make_shared<GraphRegistry>())
     , m_factory(std::make_shared<NodeFactory>(m_registry))
+    , m_profiler(std::make_shared<NodeProfiler>())
 {
+    m_selection = new SelectionDispatcher(this);
+
+    // Coalesces the position changes of a drag into one routing pass.
+    constexpr int routeDelayMs = 30;
+    m_routeTimer.setSingleShot(true);
+    m_routeTimer.setInterval(routeDelayMs);
+    connect(&m_routeTimer, &QTimer::timeout, this, &GraphScene::startRouting);
+
+    constexpr int profileRefreshMs = 250;
+    m_profileTimer.setInterval(profileRefreshMs);
+    connect(&m_profileTimer, &QTimer::timeout, this, &GraphScene::updateProfileOverlay);
 }
 
 GraphScene::~GraphScene()
 {
+    // Items removed from here on must not call back into adapters being torn down.
+    delete m_selection;
+    m_selection = nullptr;
+
+    // Records hold factory handles of items the scene is about to delete.
+    m_virtualGraph.reset();
+
+    // Members of collapsed groups are in no scene; they go with this one instead of back into it.
+    for (QGraphicsItem* item : items())
+        if (auto* group = dynamic_cast<GroupItem*>(item))
+            group->discardDetachedMembers();
+
+    if (m_layoutThread)
+        m_layoutThread->wait();
+    if (m_routeThread)
+        m_routeThread->wait();
+
     for (QGraphicsItem* item : items())
         if (auto const* node = dynamic_cast<NodeItem*>(item))
             disconnectNode(node);
@@ -70,6 +127,18 @@ GraphScene::getGraphRegistry()
     return m_registry;
 }
 
+std::shared_ptr<NodeProfiler>
+GraphScene::getNodeProfiler()
+{
+    return m_profiler;
+}
+
+SelectionDispatcher*
+GraphScene::selectionDispatcher() const
+{
+    return m_selection;
+}
+
 void
 GraphScene::addNodeItem(NodeItem* node)
 {
@@ -82,61 +151,466 @@ void
 GraphScene::groupSelectedNodes(QList<NodeItem*> nodes)
 {
     auto g = new GroupItem(m_registry, nodes, this);
+    if (m_autoCollapseThreshold > 0 && nodes.size() >= m_autoCollapseThreshold)
+        g->setCollapsed(true);
+    connect(g, &NodeItem::sgnItemMoved, this, [this, g] { queueReroute(g); });
     g->setSelected(true);
     m_registry->nodeMoved(g);
 }
 
 void
-GraphScene::deleteNodeConnections(const NodeItem* node)
+GraphScene::autoLayout(const QList<NodeItem*>& nodes)
+{
+    QSet<qint64> subset;
+    for (NodeItem* node : nodes)
+        if (NodeDescriptor const* nd = m_registry->getNode(node))
+            subset.insert(nd->uid);
+    if (!nodes.isEmpty() && subset.isEmpty())
+        return;
+
+    auto snapshot = m_registry->snapshot();
+    auto positions = std::make_shared<QHash<qint64, QPointF>>();
+    const quint64 request = ++m_layoutRequest;
+
+    QThread* worker = QThread::create([snapshot, subset, positions] {
+        *positions = LayeredLayout().run(*snapshot, subset);
+    });
+    connect(worker, &QThread::finished, this, [this, positions, request] {
+        if (request == m_layoutRequest)
+            applyLayout(*positions);
+    });
+    connect(worker, &QThread::finished, worker, &QObject::deleteLater);
+    m_layoutThread = worker;
+    worker->start();
+}
+
+void
+GraphScene::applyLayout(const QHash<qint64, QPointF>& positions)
+{
+    QHash<qint64, NodeItem*> nodes;
+    for (NodeDescriptor const* nd : m_registry->allNodes())
+        nodes.insert(nd->uid, nd->node);
+
+    // Re-indexing the BSP tree on every move dominates bulk moves; rebuild it once instead.
+    const ItemIndexMethod indexMethod = itemIndexMethod();
+    setItemIndexMethod(NoIndex);
+    for (auto it = positions.cbegin(); it != positions.cend(); ++it)
+        if (NodeItem* node = nodes.value(it.key()))
+            node->setPos(it.value());
+    setItemIndexMethod(indexMethod);
+
+    emit sgnLayoutApplied();
+}
+
+void
+GraphScene::setWireRouting(bool enabled)
+{
+    if (m_wireRouting == enabled)
+        return;
+    m_wireRouting = enabled;
+
+    const QVector<ConnectionItem*> connections = m_registry->allConnections();
+    if (enabled)
+    {
+        for (ConnectionItem const* connection : connections)
+            queueRoute(connection);
+        return;
+    }
+
+    m_routeTimer.stop();
+    m_routeQueue.clear();
+    m_movedBounds.clear();
+    m_routeBounds.clear();
+    m_routeCells.clear();
+    m_longRoutes.clear();
+    for (ConnectionItem* connection : connections)
+        connection->setRoute({});
+}
+
+bool
+GraphScene::wireRouting() const
+{
+    return m_wireRouting;
+}
+
+void
+GraphScene::setAutoCollapseThreshold(int nodes)
+{
+    m_autoCollapseThreshold = std::max(0, nodes);
+}
+
+int
+GraphScene::autoCollapseThreshold() const
+{
+    return m_autoCollapseThreshold;
+}
+
+void
+GraphScene::queueReroute(const NodeItem* node)
 {
-    for (PortLabel* port : node->inputs())
+    if (!m_wireRouting)
+        return;
+
+    auto queuePorts = [this](const auto& ports) {
+        for (PortLabel* port : ports)
+            for (ConnectionItem const* connection : m_registry->getConnections(port))
+                queueRoute(connection);
+    };
+    queuePorts(node->inputs());
+    queuePorts(node->outputs());
+    queuePorts(node->paramsInputs());
+    m_movedBounds.append(node->sceneBoundingRect());
+    m_routeTimer.start();
+}
+
+void
+GraphScene::queueRoute(ConnectionItem const* connection)
+{
+    if (!m_wireRouting || !connection || connection->id() == invalidGraphId)
+        return;
+    m_routeQueue.insert(connection->id());
+    m_routeTimer.start();
+}
+
+void
+GraphScene::startRouting()
+{
+    if (m_routeThread)
     {
-        auto connections = getGraphRegistry()->getConnections(port);
-        for (ConnectionItem* conn : std::as_const(connections))
-            deleteConnection(conn);
+        // Keep the queue; it is picked up once the running batch is applied.
+        m_routeTimer.start();
+        return;
     }
-    for (PortLabel* port : node->outputs())
+
+    // Wires whose route crosses a moved node have to go around its new position.
+    for (const QRectF& bounds : std::as_const(m_movedBounds))
+        for (ConnectionId id : routesIn(bounds))
+            m_routeQueue.insert(id);
+    m_movedBounds.clear();
+    if (m_routeQueue.isEmpty())
+        return;
+
+    // Only the nodes and groups within reach of a queued wire can bend it.
+    QVector<QPair<ConnectionId, QLineF>> wires;
+    QVector<QRectF> obstacles;
+    QSet<QGraphicsItem*> seen;
+    wires.reserve(m_routeQueue.size());
+    for (ConnectionId id : std::as_const(m_routeQueue))
     {
-        auto connections = getGraphRegistry()->getConnections(port);
-        for (ConnectionItem* conn : std::as_const(connections))
-            deleteConnection(conn);
+        ConnectionItem const* connection = m_registry->getConnectionById(id);
+        if (!connection)
+            continue;
+        const QLineF anchors = connection->anchors();
+        wires.append({id, anchors});
+        for (QGraphicsItem* item : items(WireRouter::reach(anchors.p2(), anchors.p1()), Qt::IntersectsItemBoundingRect))
+        {
+            if (item->parentItem() || !item->isVisible() || seen.contains(item))
+                continue;
+            seen.insert(item);
+            if (dynamic_cast<NodeItem*>(item))
+                obstacles.append(item->sceneBoundingRect());
+        }
     }
-    for (PortLabel* port : node->paramsInputs())
+    m_routeQueue.clear();
+
+    auto routes = std::make_shared<QHash<ConnectionId, QPolygonF>>();
+    QThread* worker = QThread::create([obstacles, wires, routes] {
+        const WireRouter router(obstacles);
+        for (const auto& [id, anchors] : wires)
+        {
+            // The router goes from the output anchor to the input anchor; wires are drawn the other way.
+            QPolygonF route = router.route(anchors.p2(), anchors.p1());
+            std::reverse(route.begin(), route.end());
+            routes->insert(id, route);
+        }
+    });
+    connect(worker, &QThread::finished, this, [this, routes] {
+        if (m_wireRouting)
+        {
+            for (auto it = routes->cbegin(); it != routes->cend(); ++it)
+            {
+                if (ConnectionItem* connection = m_registry->getConnectionById(it.key()))
+                {
+                    connection->setRoute(it.value());
+                    indexRoute(it.key(), it.value().boundingRect());
+                }
+            }
+        }
+        emit sgnRoutesApplied();
+    });
+    connect(worker, &QThread::finished, worker, &QObject::deleteLater);
+    m_routeThread = worker;
+    worker->start();
+}
+
+void
+GraphScene::indexRoute(ConnectionId id, const QRectF& bounds)
+{
+    unindexRoute(id);
+    if (bounds.isNull())
+        return;
+
+    // A straight route has no height, and an empty rect intersects nothing.
+    const QRectF r = bounds.adjusted(-1, -1, 1, 1);
+    m_routeBounds.insert(id, r);
+    const int x0 = cellOf(r.left()), x1 = cellOf(r.right());
+    const int y0 = cellOf(r.top()), y1 = cellOf(r.bottom());
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > maxRouteCells)
     {
-        auto connections = getGraphRegistry()->getConnections(port);
-        for (ConnectionItem* conn : std::as_const(connections))
-            deleteConnection(conn);
+        m_longRoutes.append(id);
+        return;
     }
+    for (int cx = x0; cx <= x1; ++cx)
+        for (int cy = y0; cy <= y1; ++cy)
+            m_routeCells[cellKey(cx, cy)].append(id);
 }
 
 void
-GraphScene::deleteConnection(ConnectionItem* connection)
+GraphScene::unindexRoute(ConnectionId id)
+{
+    const auto indexed = m_routeBounds.constFind(id);
+    if (indexed == m_routeBounds.constEnd())
+        return;
+
+    const QRectF r = indexed.value();
+    m_routeBounds.erase(indexed);
+    const int x0 = cellOf(r.left()), x1 = cellOf(r.right());
+    const int y0 = cellOf(r.top()), y1 = cellOf(r.bottom());
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > maxRouteCells)
+    {
+        m_longRoutes.removeOne(id);
+        return;
+    }
+    for (int cx = x0; cx <= x1; ++cx)
+    {
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            auto it = m_routeCells.find(cellKey(cx, cy));
+            if (it == m_routeCells.end())
+                continue;
+            it->removeOne(id);
+            if (it->isEmpty())
+                m_routeCells.erase(it);
+        }
+    }
+}
+
+QSet<ConnectionId>
+GraphScene::routesIn(const QRectF& area)
 {
-    for (auto p : items())
+    QSet<ConnectionId> hits;
+    QVector<ConnectionId> gone;
+    auto test = [this, &area, &hits, &gone](ConnectionId id) {
+        if (hits.contains(id) || !m_routeBounds.value(id).intersects(area))
+            return;
+        // Wires deleted outside deleteItems() are dropped from the index once found.
+        if (m_registry->getConnectionById(id))
+            hits.insert(id);
+        else
+            gone.append(id);
+    };
+    for (int cx = cellOf(area.left()); cx <= cellOf(area.right()); ++cx)
     {
-        if (auto port = dynamic_cast<PortLabel*>(p))
+        for (int cy = cellOf(area.top()); cy <= cellOf(area.bottom()); ++cy)
         {
-            auto registry = getGraphRegistry();
-            registry->GraphRegistry::unregisterConnection(connection);
+            const auto it = m_routeCells.constFind(cellKey(cx, cy));
+            if (it == m_routeCells.constEnd())
+                continue;
+            for (ConnectionId id : it.value())
+                test(id);
+        }
+    }
+    for (ConnectionId id : std::as_const(m_longRoutes))
+        test(id);
+    for (ConnectionId id : std::as_const(gone))
+        unindexRoute(id);
+    return hits;
+}
 
-            if (port->isParameterPort())
-            {
-                if (auto group = m_registry->findGroup(port->moduleName()))
-                {
-                    if (group)
-                    {
-                        m_factory->disableWidgetOfConnectedParametersInput(group->group);
-                    }
-                }
-                else
+ConnectionItem*
+GraphScene::connectPorts(PortLabel* from, PortLabel* to)
+{
+    ConnectionItem* connection = m_factory->createConnectionBetweenPorts(from, to);
+    if (!connection)
+        return nullptr;
+
+    addItem(connection);
+    queueRoute(connection);
+    emit sgnConnectionCreated(connection);
+    return connection;
+}
+
+void
+GraphScene::deleteItems(const QList<NodeItem*>& nodes, const QList<ConnectionItem*>& connections)
+{
+    // Each wire once, however many deleted nodes it touches.
+    QSet<ConnectionItem*> wires;
+    QVector<ConnectionItem*> edges;
+    auto add = [&wires, &edges](ConnectionItem* c) {
+        if (c && !wires.contains(c))
+        {
+            wires.insert(c);
+            edges.push_back(c);
+        }
+    };
+    for (ConnectionItem* c : connections)
+        add(c);
+    auto collect = [this, &add](PortLabel* port) {
+        for (ConnectionItem* c : m_registry->getConnections(port))
+            add(c);
+    };
+    auto collectNode = [&collect](NodeItem const* node) {
+        for (PortLabel* port : node->inputs())
+            collect(port);
+        for (PortLabel* port : node->outputs())
+            collect(port);
+        for (PortLabel* port : node->paramsInputs())
+            collect(port);
+    };
+    // Deleted nodes never run again; drop their stats before their uids are unregistered.
+    auto forget = [this](NodeItem* node) {
+        if (NodeDescriptor const* nd = m_registry->getNode(node))
+            m_profiler->remove(nd->uid);
+    };
+    for (NodeItem* node : nodes)
+    {
+        collectNode(node);
+        forget(node);
+        // Members of a collapsed group are not in the scene, so nobody selected them; they
+        // are deleted with the group (see ~GroupItem), and so are their wires.
+        if (auto* group = dynamic_cast<GroupItem*>(node); group && group->isCollapsed())
+            for (NodeItem* member : group->nodes())
+                if (member && !member->scene())
                 {
-                    auto node = m_registry->findNode(port->moduleName());
-                    m_factory->disableWidgetOfConnectedParametersInput(node->node);
+                    collectNode(member);
+                    forget(member);
                 }
-            }
-        }
     }
 
+    // Counted before the wires are unregistered, so they are compared with what is removed.
+    const qsizetype graphItems = m_registry->nodeCount() + m_registry->connectionCount();
+    for (ConnectionItem* c : edges)
+        emit sgnConnectionDeleted(c);
+    const QSet<NodeItem*> fed = m_registry->unregisterConnections(edges);
+
+    // Removing items one by one re-indexes the BSP tree each time, but rebuilding it
+    // walks every item in the scene; only worth it when a sizeable share goes away.
+    constexpr qsizetype bulkRemovalShare = 8; // Suspend from 1/8 of the nodes and wires.
+    const qsizetype removed = nodes.size() + edges.size();
+    const bool suspendIndex = removed * bulkRemovalShare >= graphItems;
+    // Every removed selected item also emits selectionChanged; dispatch the result once.
+    SelectionDispatcher::Batch batch(m_selection);
+    const ItemIndexMethod indexMethod = itemIndexMethod();
+    if (suspendIndex)
+        setItemIndexMethod(NoIndex);
+    for (ConnectionItem* c : edges)
+    {
+        unindexRoute(c->id());
+        if (c->scene() == this)
+            removeItem(c);
+        delete c;
+    }
+    for (NodeItem* node : nodes)
+    {
+        m_selection->unwatch(node);
+        removeItem(node);
+        node->deleteLater();
+    }
+    if (suspendIndex)
+        setItemIndexMethod(indexMethod);
+
+    // Only surviving nodes that lost an input can have a parameter widget to re-enable.
+    QSet<NodeItem*> deleted;
+    for (NodeItem* node : nodes)
+        deleted.insert(node);
+    for (NodeItem* node : fed)
+    {
+        if (deleted.contains(node))
+            continue;
+        m_factory->disableWidgetOfConnectedParametersInput(node);
+        if (dynamic_cast<GroupItem*>(node))
+            continue;
+        for (GroupDescriptor const* gd : m_registry->groupsOf(node))
+            if (!deleted.contains(gd->group))
+                m_factory->disableWidgetOfConnectedParametersInput(gd->group);
+    }
+}
+
+VirtualGraph*
+GraphScene::enableVirtualization()
+{
+    if (!m_virtualGraph)
+        m_virtualGraph = std::make_unique<VirtualGraph>(this);
+    return m_virtualGraph.get();
+}
+
+VirtualGraph*
+GraphScene::virtualGraph() const
+{
+    return m_virtualGraph.get();
+}
+
+void
+GraphScene::setProfileOverlay(bool enabled)
+{
+    if (m_profileOverlay == enabled)
+        return;
+    m_profileOverlay = enabled;
+
+    if (enabled)
+    {
+        m_profilerWasEnabled = m_profiler->isEnabled();
+        m_profiler->setEnabled(true);
+        m_profileRevision = m_profiler->revision() - 1;
+        updateProfileOverlay();
+        m_profileTimer.start();
+        return;
+    }
+
+    m_profileTimer.stop();
+    m_profiler->setEnabled(m_profilerWasEnabled);
+    for (NodeDescriptor const* nd : m_registry->allNodes())
+        if (nd->node)
+            nd->node->clearProfileOverlay();
+}
+
+bool
+GraphScene::profileOverlay() const
+{
+    return m_profileOverlay;
+}
+
+void
+GraphScene::updateProfileOverlay()
+{
+    const quint64 revision = m_profiler->revision();
+    if (revision == m_profileRevision)
+        return;
+    m_profileRevision = revision;
+
+    QHash<qint64, NodeItem*> unprofiled;
+    for (NodeDescriptor const* nd : m_registry->allNodes())
+        if (nd->node)
+            unprofiled.insert(nd->uid, nd->node);
+
+    for (const NodeProfileStats& stats : m_profiler->stats())
+    {
+        NodeItem* node = unprofiled.take(stats.uid);
+        if (!node)
+            continue;
+        const QString badge =
+            QString("%1 ms x%2").arg(stats.meanWallMs(), 0, 'f', stats.meanWallMs() < 10 ? 2 : 0).arg(stats.invocations);
+        node->setProfileOverlay(stats.percentile, badge);
+    }
+    for (NodeItem* node : std::as_const(unprofiled))
+        node->clearProfileOverlay();
+}
+
+void
+GraphScene::releaseConnection(ConnectionItem* connection)
+{
+    unindexRoute(connection->id());
+    m_registry->unregisterConnection(connection);
     removeItem(connection);
     delete connection;
 }
@@ -150,6 +624,9 @@ GraphScene::contextMenuEvent(QGraphicsSceneContextMenuEvent* event)
     QMenu menu;
     QAction const* groupAction = nullptr;
     QAction const* ungroupAction = nullptr;
+    QAction const* layoutAction = nullptr;
+    QAction const* routingAction = nullptr;
+    QAction const* profileAction = nullptr;
 
     if (nodes.size() >= 2 && groups.isEmpty())
         groupAction = menu.addAction("Group");
@@ -157,6 +634,10 @@ GraphScene::contextMenuEvent(QGraphicsSceneContextMenuEvent* event)
     if (!groups.isEmpty())
         ungroupAction = menu.addAction("Ungroup");
 
+    layoutAction = menu.addAction(nodes.size() >= 2 ? "Auto Layout Selection" : "Auto Layout");
+    routingAction = menu.addAction(m_wireRouting ? "Curved Wires" : "Route Wires");
+    profileAction = menu.addAction(m_profileOverlay ? "Hide Profile" : "Show Profile");
+
     QAction const* selected = menu.exec(event->screenPos());
 
     if (!selected)
@@ -165,6 +646,15 @@ GraphScene::contextMenuEvent(QGraphicsSceneContextMenuEvent* event)
     if (selected == groupAction)
         groupSelectedNodes(nodes);
 
+    else if (selected == layoutAction)
+        autoLayout(nodes.size() >= 2 ? nodes : QList<NodeItem*>());
+
+    else if (selected == routingAction)
+        setWireRouting(!m_wireRouting);
+
+    else if (selected == profileAction)
+        setProfileOverlay(!m_profileOverlay);
+
     else if (selected == ungroupAction)
         for (GroupItem* g : std::as_const(groups))
         {
@@ -216,6 +706,8 @@ GraphScene::connectNode(const NodeItem* node)
     connect(node, &NodeItem::sgnPortMouseReleased, this, [this](NodeItem*, PortLabel* port) {
         this->onPortMouseReleased(port);
     });
+
+    connect(node, &NodeItem::sgnItemMoved, this, [this, node] { queueReroute(node); });
 }
 
 void
@@ -265,14 +757,11 @@ GraphScene::keyPressEvent(QKeyEvent* event)
     {
         case Qt::Key_Delete:
         {
-            for_each_selected_connection(this, [this](ConnectionItem* conn) {
-                deleteConnection(conn);
-            });
-            for_each_selected_node(this, [this](NodeItem* node) {
-                deleteNodeConnections(node);
-                removeItem(node);
-                node->deleteLater();
-            });
+            QList<NodeItem*> nodes;
+            QList<ConnectionItem*> connections;
+            for_each_selected_connection(this, [&connections](ConnectionItem* conn) { connections.append(conn); });
+            for_each_selected_node(this, [&nodes](NodeItem* node) { nodes.append(node); });
+            deleteItems(nodes, connections);
             for_each_selected_group(this, [this](GroupItem* group) { group->ungroup(this); });
             break;
         }
@@ -281,7 +770,8 @@ GraphScene::keyPressEvent(QKeyEvent* event)
         {
             if (ctrlPressed)
             {
-                // Select all selectable items
+                // Select all selectable items, dispatching the change once
+                SelectionDispatcher::Batch batch(m_selection);
                 for (QGraphicsItem* itm : items(Qt::AscendingOrder))
                     if (itm->flags() & QGraphicsItem::ItemIsSelectable)
                         itm->setSelected(true);
@@ -309,11 +799,36 @@ GraphScene::onPortClicked(PortLabel* port)
         return;
     }
 
-    ConnectionPort startPoint{port->scenePos(), port->boundingRect(), port->name(), port->moduleName(), (port->getOrientation() == PortLabel::Orientation::Parameter || port->getOrientation() == PortLabel::Orientation::Input)};
-    m_tempConnection = new ConnectionItem(startPoint);
+    ConnectionPort startPoint{port->scenePos(), port->boundingRect(), port->nameSymbol(), port->moduleSymbol(), (port->getOrientation() == PortLabel::Orientation::Parameter || port->getOrientation() == PortLabel::Orientation::Input), port->id()};
+    beginTempConnection(startPoint);
+}
+
+void
+GraphScene::beginTempConnection(const ConnectionPort& port)
+{
+    if (m_spareConnection)
+    {
+        m_spareConnection->reset(port);
+        m_tempConnection = m_spareConnection.release();
+    }
+    else
+    {
+        m_tempConnection = new ConnectionItem(port);
+    }
     addItem(m_tempConnection);
 }
 
+void
+GraphScene::endTempConnection()
+{
+    if (!m_tempConnection)
+        return;
+
+    removeItem(m_tempConnection);
+    m_spareConnection.reset(m_tempConnection);
+    m_tempConnection = nullptr;
+}
+
 void
 GraphScene::onPortMouseReleased(PortLabel* port)
 {
@@ -323,19 +838,16 @@ GraphScene::onPortMouseReleased(PortLabel* port)
     if (port && getNodeFactory()->PortsAreCompatible(*this->getGraphRegistry(), m_startPort, port) && port != m_startPort)
     {
         m_tempConnection->setIsCompatible(true);
-        ConnectionPort endPoint{port->scenePos(), port->boundingRect(), port->name(), port->moduleName(), (port->getOrientation() == PortLabel::Orientation::Parameter || port->getOrientation() == PortLabel::Orientation::Input)};
+        ConnectionPort endPoint{port->scenePos(), port->boundingRect(), port->nameSymbol(), port->moduleSymbol(), (port->getOrientation() == PortLabel::Orientation::Parameter || port->getOrientation() == PortLabel::Orientation::Input), port->id()};
         m_tempConnection->addPort(endPoint);
-        if (auto conn = m_factory->createConnectionBetweenPorts(m_startPort, port))
+        connectPorts(m_startPort, port);
         {
-            addItem(conn);
-        }
-        {
-            remove_temp_connection(this, m_tempConnection);
+            endTempConnection();
         }
     }
     else
     {
-        remove_temp_connection(this, m_tempConnection);
+        endTempConnection();
     }
 
     m_startPort = nullptr;
@@ -383,14 +895,9 @@ GraphScene::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
         releasedPort && getNodeFactory()->PortsAreCompatible(*this->getGraphRegistry(), m_startPort, releasedPort) && releasedPort != m_startPort)
     {
         m_tempConnection->setIsCompatible(true);
-
-        auto conn = m_factory->createConnectionBetweenPorts(m_startPort, releasedPort);
-        if (conn)
-            addItem(conn);
+        connectPorts(m_startPort, releasedPort);
     }
-    removeItem(m_tempConnection);
-    delete m_tempConnection;
-    m_tempConnection = nullptr;
+    endTempConnection();
     m_startPort = nullptr;
 
     QGraphicsScene::mouseReleaseEvent(event);
@@ -436,4 +943,7 @@ GraphScene::drawBackground(QPainter* painter, const QRectF& rect)
 
     painter->setPen(darkPen);
     painter->drawLines(darkLines);
+
+    if (m_virtualGraph)
+        m_virtualGraph->paint(painter, rect);
 }
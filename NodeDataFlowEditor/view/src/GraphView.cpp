@@ -23,12 +23,25 @@
 */
 
 #include "view/GraphView.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/GraphMinimap.hpp"
 #include "view/GraphScene.hpp"
+#include "view/VirtualGraph.hpp"
 
 #include <QKeyEvent>
+#include <QResizeEvent>
 #include <QWheelEvent>
 #include <QtGlobal>
 
+namespace
+{
+    constexpr qreal minZoom = 0.1;
+    constexpr qreal maxZoom = 5.0;
+    // Focusing a single node should not fill the whole view with it.
+    constexpr qreal maxFocusZoom = 1.5;
+    constexpr qreal focusMargin = 60.0;
+}
+
 GraphView::GraphView(GraphScene* scene, QWidget* parent)
     : QGraphicsView(parent)
 {
@@ -46,6 +59,91 @@ GraphView::GraphView(GraphScene* scene, QWidget* parent)
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 }
 
+void
+GraphView::setMinimapVisible(bool visible)
+{
+    if (!m_minimap)
+    {
+        if (!visible)
+            return;
+        m_minimap = new GraphMinimap(qobject_cast<GraphScene*>(scene()), this, this);
+        placeMinimap();
+    }
+    m_minimap->setVisible(visible);
+}
+
+GraphMinimap*
+GraphView::minimap() const
+{
+    return m_minimap;
+}
+
+void
+GraphView::focusNodes(const QVector<qint64>& uids)
+{
+    auto* graphScene = qobject_cast<GraphScene*>(scene());
+    if (!graphScene || uids.isEmpty())
+        return;
+
+    const auto snapshot = graphScene->getGraphRegistry()->snapshot();
+    QRectF bounds;
+    for (qint64 uid : uids)
+        if (const auto record = snapshot->node(uid))
+            bounds |= QRectF(record->position, record->size);
+
+    if (!bounds.isNull())
+        focusOn(bounds);
+}
+
+void
+GraphView::focusOn(const QRectF& sceneRect)
+{
+    const QRectF target = sceneRect.adjusted(-focusMargin, -focusMargin, focusMargin, focusMargin);
+    fitInView(target, Qt::KeepAspectRatio);
+
+    const qreal zoom = transform().m11();
+    const qreal clamped = qBound(minZoom, zoom, maxFocusZoom);
+    if (!qFuzzyCompare(zoom, clamped))
+        scale(clamped / zoom, clamped / zoom);
+    centerOn(target.center());
+    updateVirtualViewport();
+}
+
+void
+GraphView::resizeEvent(QResizeEvent* event)
+{
+    QGraphicsView::resizeEvent(event);
+    placeMinimap();
+    updateVirtualViewport();
+}
+
+void
+GraphView::scrollContentsBy(int dx, int dy)
+{
+    QGraphicsView::scrollContentsBy(dx, dy);
+    updateVirtualViewport();
+}
+
+void
+GraphView::updateVirtualViewport()
+{
+    auto* graphScene = qobject_cast<GraphScene*>(scene());
+    if (!graphScene || !graphScene->virtualGraph())
+        return;
+    graphScene->virtualGraph()->setViewport(mapToScene(viewport()->rect()).boundingRect(), transform().m11());
+}
+
+void
+GraphView::placeMinimap()
+{
+    if (!m_minimap)
+        return;
+
+    constexpr int margin = 12;
+    const QSize size(qBound(120, width() / 5, 320), qBound(90, height() / 5, 240));
+    m_minimap->setGeometry(width() - size.width() - margin, height() - size.height() - margin, size.width(), size.height());
+}
+
 void
 GraphView::wheelEvent(QWheelEvent* event)
 {
@@ -63,9 +161,10 @@ GraphView::wheelEvent(QWheelEvent* event)
 
     // Clamp zoom level
     if (qreal currentScale = transform().m11();
-        (factor > 1.0 && currentScale < 5.0) ||
-        (factor < 1.0 && currentScale > 0.1))
+        (factor > 1.0 && currentScale < maxZoom) ||
+        (factor < 1.0 && currentScale > minZoom))
         scale(factor, factor);
+    updateVirtualViewport();
 
     event->accept();
 }
@@ -25,8 +25,10 @@
 #include "view/GroupItem.hpp"
 #include "utility/GraphRegistry.hpp"
 #include "utility/WidgetVisitor.hpp"
+#include "view/DeferredParameterWidget.hpp"
 #include "view/GraphScene.hpp"
 #include "view/PortLabel.hpp"
+#include "view/SelectionDispatcher.hpp"
 
 #include <QCheckBox>
 #include <QComboBox>
@@ -105,9 +107,16 @@ GroupItem::GroupItem(std::shared_ptr<GraphRegistry> registry,
     // Align group center
     setPos(centerPos - QPointF(boundingRect().width(), boundingRect().height()));
 
-    mirrorPorts();
-    mirrorParams();
-    updateLayout();
+    // Lay the mirrored ports out once and register their forwarding in one transaction.
+    QVector<ForwardRule> forwards;
+    {
+        DeferredLayout layout(this);
+        mirrorPorts(forwards);
+        mirrorParams(forwards);
+        updateLayout();
+    }
+    m_registry->registerForwardPorts(this, forwards);
+    emit sgnItemMoved();
 
     // Make group m_port behave like normal node m_port
     connect(this, &NodeItem::sgnPortMouseClicked, this, &GroupItem::onGroupPortMouseClicked);
@@ -116,7 +125,10 @@ GroupItem::GroupItem(std::shared_ptr<GraphRegistry> registry,
 
 GroupItem::~GroupItem()
 {
+    // ungroup() expands first, so a group destroyed while collapsed is being deleted or torn
+    // down with its scene. Its detached members are in no scene and owned by nobody else.
     m_registry->unregisterGroup(this);
+    discardDetachedMembers();
     m_nodes.clear();
 }
 
@@ -130,7 +142,7 @@ GroupItem::buildTitle()
 }
 
 void
-GroupItem::mirrorPorts()
+GroupItem::mirrorPorts(QVector<ForwardRule>& forwards)
 {
     for (auto n : std::as_const(m_nodes))
     {
@@ -138,34 +150,31 @@ GroupItem::mirrorPorts()
         {
             if (p)
             {
-                PortLabel* g = addInput(p->moduleName() + "_" + p->name());
+                PortLabel* g = addInput(p->forwardedNameSymbol().toString());
                 g->setDisplayName(p->moduleName() + "_" + p->displayName());
                 connect(g, &PortLabel::sgnDisplayedNameChanged, this, [p](const QString& displayName) {
                     p->setDisplayName(displayName);
                 });
-                m_registry->registerForwardInput(this, g, p);
+                forwards.push_back({g, p});
             }
         }
         for (auto* p : n->outputs())
         {
             if (p)
             {
-                PortLabel* g = addOutput(p->moduleName() + "_" + p->name());
+                PortLabel* g = addOutput(p->forwardedNameSymbol().toString());
                 g->setDisplayName(p->moduleName() + "_" + p->displayName());
                 connect(g, &PortLabel::sgnDisplayedNameChanged, this, [p](const QString& displayName) {
                     p->setDisplayName(displayName);
                 });
-                m_registry->registerForwardOutput(this, g, p);
+                forwards.push_back({g, p});
             }
         }
     }
-
-    updateLayout();
-    emit sgnItemMoved();
 }
 
 void
-GroupItem::mirrorParams()
+GroupItem::mirrorParams(QVector<ForwardRule>& forwards)
 {
     QMap<QString, PortLabel*> paramBuckets;
     QMap<QString, QWidget*> paramWidgetsBuckets;
@@ -175,8 +184,9 @@ GroupItem::mirrorParams()
         {
             if (!p)
                 continue;
-            paramBuckets[p->moduleName() + "_" + p->name()] = p;
-            paramWidgetsBuckets[p->moduleName() + "_" + p->name()] = n->getParameterWidget(p);
+            const QString key = p->forwardedNameSymbol().toString();
+            paramBuckets[key] = p;
+            paramWidgetsBuckets[key] = n->getParameterWidget(p);
         }
     }
 
@@ -188,12 +198,56 @@ GroupItem::mirrorParams()
             continue;
 
         QWidget* firstWidget = paramWidgetsBuckets.value(name);
+        if (!WidgetVisitor::isEditor(firstWidget))
+        {
+            // Containers are mirrored through their children; clone them now.
+            WidgetVisitor visitor(m_registry, port, name, this);
+            visitor.collectForwards(forwards);
+            visitor.visit(firstWidget);
+            continue;
+        }
 
-        WidgetVisitor visitor(m_registry, port, name, this);
-        visitor.visit(firstWidget);
+        auto* placeholder = new DeferredParameterWidget(firstWidget);
+        PortLabel* g = addParameter(placeholder, name);
+        g->setDisplayName(port->moduleName() + "_" + port->displayName());
+        connect(g, &PortLabel::sgnDisplayedNameChanged, port, &PortLabel::setDisplayName);
+        // Queued: the swap must not happen inside the placeholder's own event handler.
+        connect(
+            placeholder, &DeferredParameterWidget::sgnActivated, this, [this, g]() { materializeParameter(g); },
+            Qt::QueuedConnection);
+        m_deferredParameters.insert(g, port);
+        forwards.push_back({g, port});
     }
 }
 
+void
+GroupItem::materializeParameter(PortLabel* port)
+{
+    PortLabel* actual = m_deferredParameters.take(port);
+    auto const* placeholder = qobject_cast<DeferredParameterWidget*>(getParameterWidget(port));
+    if (!actual || !placeholder || !placeholder->source())
+        return;
+
+    const QString name = port->name();
+    WidgetVisitor visitor(m_registry, actual, name, this);
+    if (QWidget* clone = visitor.clone(placeholder->source()))
+        setParameterWidget(port, clone);
+}
+
+void
+GroupItem::materializeParameters()
+{
+    DeferredLayout layout(this);
+    for (PortLabel* port : m_deferredParameters.keys())
+        materializeParameter(port);
+}
+
+int
+GroupItem::deferredParameterCount() const
+{
+    return static_cast<int>(m_deferredParameters.size());
+}
+
 void
 GroupItem::onGroupPortMouseClicked(NodeItem*, PortLabel* port)
 {
@@ -218,7 +272,11 @@ GroupItem::itemChange(GraphicsItemChange change, const QVariant& value)
         // Move member nodes along with the group.
         const QPointF newPos = value.toPointF();
         const QPointF delta = newPos - pos();
-        if (!delta.isNull())
+        if (m_collapsed)
+        {
+            m_pendingOffset += delta;
+        }
+        else if (!delta.isNull())
         {
             for (NodeItem* n : std::as_const(m_nodes))
             {
@@ -227,10 +285,12 @@ GroupItem::itemChange(GraphicsItemChange change, const QVariant& value)
             }
         }
     }
-    else if (change == ItemSelectedHasChanged)
+    else if (change == ItemSelectedHasChanged && !m_collapsed)
     {
         // Keep selection in sync between the group and its members.
         const bool sel = value.toBool();
+        auto const* graphScene = qobject_cast<GraphScene*>(scene());
+        SelectionDispatcher::Batch batch(graphScene ? graphScene->selectionDispatcher() : nullptr);
         for (NodeItem* n : std::as_const(m_nodes))
             n->setSelected(sel);
     }
@@ -240,7 +300,14 @@ GroupItem::itemChange(GraphicsItemChange change, const QVariant& value)
 void
 GroupItem::ungroup(QGraphicsScene* sc)
 {
+    setCollapsed(false);
+    m_deferredParameters.clear();
+
+    // Unforward the group ports while they exist; disconnectAllPorts() forgets and deletes them.
+    for (auto* p : getAllPorts())
+        m_registry->unregisterForwardPort(this, p);
     disconnectAllPorts();
+
     // Make members visible and movable again, and tidy their connection sets.
     auto offset = pos();
     for (NodeItem* n : std::as_const(m_nodes))
@@ -252,21 +319,6 @@ GroupItem::ungroup(QGraphicsScene* sc)
         emit n->sgnItemMoved();
         n->setPos(offset);
         offset += n->boundingRect().topRight() + QPointF(20, 20);
-
-        // remove forwarding m_port
-        for (auto* p : n->inputs())
-        {
-            m_registry->unregisterForwardPort(this, p);
-        }
-        for (auto* p : n->outputs())
-        {
-            m_registry->unregisterForwardPort(this, p);
-        }
-
-        for (auto* p : n->paramsInputs())
-        {
-            m_registry->unregisterForwardPort(this, p);
-        }
         n->updateLayout();
     }
     m_nodes.clear();
@@ -282,3 +334,65 @@ GroupItem::nodes()
 {
     return m_nodes;
 }
+
+void
+GroupItem::setCollapsed(bool collapsed)
+{
+    if (collapsed == m_collapsed)
+        return;
+
+    if (collapsed)
+    {
+        m_memberScene = scene();
+        if (!m_memberScene)
+            return;
+
+        for (NodeItem* n : std::as_const(m_nodes))
+            if (n && n->scene() == m_memberScene)
+                m_memberScene->removeItem(n);
+
+        m_pendingOffset = QPointF();
+        m_collapsed = true;
+        return;
+    }
+
+    m_collapsed = false;
+    for (NodeItem* n : std::as_const(m_nodes))
+    {
+        if (!n)
+            continue;
+        // Reposition while detached so the scene index is updated only once.
+        n->setPos(n->pos() + m_pendingOffset);
+        if (m_memberScene && !n->scene())
+            m_memberScene->addItem(n);
+    }
+    m_pendingOffset = QPointF();
+    m_memberScene = nullptr;
+}
+
+bool
+GroupItem::isCollapsed() const
+{
+    return m_collapsed;
+}
+
+void
+GroupItem::discardDetachedMembers()
+{
+    if (!m_collapsed)
+        return;
+
+    QList<NodeItem*> detached;
+    for (NodeItem* n : std::as_const(m_nodes))
+        if (n && !n->scene())
+            detached.append(n);
+    for (NodeItem* n : std::as_const(detached))
+    {
+        m_nodes.remove(n);
+        delete n;
+    }
+
+    m_collapsed = false;
+    m_pendingOffset = QPointF();
+    m_memberScene = nullptr;
+}
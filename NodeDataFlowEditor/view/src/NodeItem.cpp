@@ -27,14 +27,24 @@
 #include "utility/NodeHelper.hpp"
 #include "view/ConnectionItem.hpp"
 #include "view/EditableLabelItem.hpp"
+#include "view/GraphScene.hpp"
+#include "view/ParameterBinder.hpp"
+#include "view/ParameterEditorPool.hpp"
 #include "view/PortLabel.hpp"
+#include "view/SelectionDispatcher.hpp"
 
 #include <QDebug>
+#include <QFontMetricsF>
 #include <QGraphicsProxyWidget>
+#include <QGraphicsSceneHoverEvent>
+#include <QGraphicsSceneMouseEvent>
 #include <QLinearGradient>
+#include <QMetaProperty>
 #include <QPainter>
+#include <QPixmapCache>
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 namespace
 {
@@ -58,6 +68,50 @@ namespace
 
         return {totalWidth, totalHeight};
     }
+
+    // Properties that change how a widget draws the same value: a slider at 5
+    // looks different over 0-10 than over 0-100, or laid out vertically.
+    const char* const snapshotProperties[] = {"text",
+                                              "minimum",
+                                              "maximum",
+                                              "orientation",
+                                              "invertedAppearance",
+                                              "notchesVisible",
+                                              "wrapping",
+                                              "decimals",
+                                              "prefix",
+                                              "suffix",
+                                              "specialValueText"};
+
+    // Snapshots are keyed by what the widget shows, so identical parameters on
+    // different nodes share one pixmap. Widgets without a user property get a
+    // per-widget key.
+    QString snapshotKey(const QWidget* w, bool enabled)
+    {
+        const QMetaProperty userProperty = w->metaObject()->userProperty();
+        QString state;
+        if (userProperty.isValid())
+        {
+            state = userProperty.read(w).toString();
+            for (const char* name : snapshotProperties)
+            {
+                const QVariant value = w->property(name);
+                if (value.isValid())
+                    state += QLatin1Char('|') + (value.canConvert<QString>() ? value.toString()
+                                                                            : QString::number(value.toInt()));
+            }
+        }
+        else
+        {
+            state = QString::number(reinterpret_cast<quintptr>(w));
+        }
+        return QStringLiteral("NodeItem/param/%1/%2x%3/%4/%5")
+            .arg(QString::fromLatin1(w->metaObject()->className()))
+            .arg(w->width())
+            .arg(w->height())
+            .arg(enabled ? 1 : 0)
+            .arg(state);
+    }
 } // namespace
 
 NodeItem::NodeItem(std::shared_ptr<GraphRegistry> registry,
@@ -98,6 +152,11 @@ NodeItem::NodeItem(std::shared_ptr<GraphRegistry> registry,
 
 NodeItem::~NodeItem()
 {
+    // Removing a selected item changes the selection; nobody must be told about this one.
+    if (auto const* graphScene = qobject_cast<GraphScene*>(scene()))
+        if (SelectionDispatcher* dispatcher = graphScene->selectionDispatcher())
+            dispatcher->unwatch(this);
+
     try
     {
         disconnectAllPorts();
@@ -167,17 +226,78 @@ NodeItem::addParameter(QWidget* widget, const QString& name)
     if (!widget)
         return nullptr;
 
-    auto* proxy = new QGraphicsProxyWidget(this);
-    proxy->setWidget(widget);
-    m_parameterWidgets.insert(widget, proxy);
-
     auto* port = addParamInput(name);
-    m_parameterPorts.insert(port, proxy);
+    Parameter& parameter = m_parameters[port];
+    parameter.widget = widget;
+    if (m_lazyParameters)
+    {
+        // Parked widgets are never embedded; give them the size a proxy would.
+        if (!widget->testAttribute(Qt::WA_Resized))
+            widget->adjustSize();
+    }
+    else
+    {
+        embedParameter(parameter);
+    }
+
+    m_registry->parameterBinder().bindEditors(port->id(), widget);
+    watchParameterWidget(widget);
+    refreshSnapshot(parameter);
 
     updateLayout();
     return port;
 }
 
+void
+NodeItem::setParameterWidget(PortLabel* port, QWidget* widget)
+{
+    auto it = m_parameters.find(port);
+    if (it == m_parameters.end() || !widget)
+        return;
+
+    if (port == m_activeParameter)
+        releaseActiveParameter();
+
+    Parameter& parameter = it.value();
+    m_registry->parameterBinder().bindEditors(port->id(), widget, parameter.widget);
+    if (QWidget* previous = parameter.widget)
+    {
+        disconnect(previous, nullptr, this, nullptr);
+        if (parameter.proxy)
+            parameter.proxy->setWidget(nullptr);
+        previous->deleteLater();
+    }
+
+    parameter.widget = widget;
+    widget->setEnabled(parameter.enabled);
+    if (parameter.proxy)
+    {
+        // Embedding copies the widget's visibility to the proxy; keep the proxy's own.
+        const bool visible = parameter.proxy->isVisible();
+        parameter.proxy->setWidget(widget);
+        parameter.proxy->setVisible(visible);
+    }
+    else if (!widget->testAttribute(Qt::WA_Resized))
+    {
+        widget->adjustSize();
+    }
+    watchParameterWidget(widget);
+    refreshSnapshot(parameter);
+
+    updateLayout();
+}
+
+void
+NodeItem::watchParameterWidget(QWidget* widget)
+{
+    const QMetaProperty userProperty = widget->metaObject()->userProperty();
+    if (userProperty.isValid() && userProperty.hasNotifySignal())
+    {
+        const QMetaMethod slot = metaObject()->method(metaObject()->indexOfSlot("onParameterValueChanged()"));
+        connect(widget, userProperty.notifySignal(), this, slot);
+    }
+}
+
 PortLabel*
 NodeItem::addParameter(QWidget* widget, const QString& name, const QString& displayName)
 {
@@ -217,18 +337,23 @@ NodeItem::removeOutput(PortLabel* output)
 void
 NodeItem::removeParamInput(PortLabel* input)
 {
-    if (!m_parameterPorts.contains(input))
+    if (!m_parameters.contains(input))
         return;
 
-    auto* proxy = m_parameterPorts.value(input);
-    auto* widget = m_parameterWidgets.key(proxy);
+    if (input == m_activeParameter)
+        releaseActiveParameter();
+    const Parameter parameter = m_parameters.take(input);
 
     disconnectPorts(input);
-    m_parameterPorts.remove(input);
-    m_parameterWidgets.remove(widget);
+    if (parameter.widget)
+        disconnect(parameter.widget, nullptr, this, nullptr);
 
     input->deleteLater();
-    proxy->deleteLater();
+    // The proxy deletes the widget it embeds.
+    if (parameter.proxy)
+        parameter.proxy->deleteLater();
+    else if (parameter.widget)
+        parameter.widget->deleteLater();
     m_registry->unregisterParameter(this, input);
 
     updateLayout();
@@ -253,31 +378,53 @@ NodeItem::disconnectAllPorts()
         }
     m_outputs.clear();
 
-    for (auto* port : m_parameterPorts.keys())
+    releaseActiveParameter();
+    for (auto it = m_parameters.cbegin(); it != m_parameters.cend(); ++it)
     {
-        auto* proxy = m_parameterPorts.value(port);
-        disconnectPorts(port);
-        port->deleteLater();
-        proxy->deleteLater();
+        disconnectPorts(it.key());
+        it.key()->deleteLater();
+        if (it->proxy)
+            it->proxy->deleteLater();
+        else if (it->widget)
+            it->widget->deleteLater();
     }
-    m_parameterPorts.clear();
-    m_parameterWidgets.clear();
+    m_parameters.clear();
 }
 
 QVector<PortLabel*>
 NodeItem::getAllPorts() const
 {
     QVector<PortLabel*> allPorts;
-    allPorts.reserve(m_inputs.size() + m_outputs.size() + m_parameterPorts.size());
+    allPorts.reserve(m_inputs.size() + m_outputs.size() + m_parameters.size());
     allPorts += m_inputs;
     allPorts += m_outputs;
-    allPorts += m_parameterPorts.keys().toVector();
+    allPorts += m_parameters.keys().toVector();
     return allPorts;
 }
 
+NodeItem::DeferredLayout::DeferredLayout(NodeItem* node)
+    : m_node(node)
+{
+    ++m_node->m_layoutDeferrals;
+}
+
+NodeItem::DeferredLayout::~DeferredLayout()
+{
+    if (--m_node->m_layoutDeferrals > 0 || !m_node->m_layoutPending)
+        return;
+    m_node->m_layoutPending = false;
+    m_node->updateLayout();
+}
+
 void
 NodeItem::updateLayout()
 {
+    if (m_layoutDeferrals > 0)
+    {
+        m_layoutPending = true;
+        return;
+    }
+
     updateRect();
 
     if (m_nodeNameLabel)
@@ -302,12 +449,12 @@ NodeItem::updateLayout()
     m_maxParamWidth = 0;
 
     // labels
-    for (auto* port : m_parameterPorts.keys())
+    for (auto* port : m_parameters.keys())
         m_maxParamWidth = std::max(m_maxParamWidth, port->boundingRect().width());
 
     // widgets
-    for (auto* proxy : m_parameterPorts)
-        m_maxParamWidth = std::max(m_maxParamWidth, proxy->boundingRect().width());
+    for (const Parameter& parameter : std::as_const(m_parameters))
+        m_maxParamWidth = std::max(m_maxParamWidth, parameterSize(parameter).width());
 
     qreal width =
         m_margin +
@@ -340,16 +487,18 @@ NodeItem::updateLayout()
 
     qreal yParam = m_titleHeight + m_margin;
 
-    for (auto it = m_parameterPorts.constBegin(); it != m_parameterPorts.constEnd(); ++it)
+    for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it)
     {
         PortLabel* label = it.key();
-        QGraphicsProxyWidget* widget = it.value();
+        Parameter& parameter = it.value();
 
         label->setPos(paramX, yParam);
 
-        widget->setPos(paramX, yParam + label->boundingRect().height());
+        parameter.rect = QRectF(QPointF(paramX, yParam + label->boundingRect().height()), parameterSize(parameter));
+        if (parameter.proxy)
+            parameter.proxy->setPos(parameter.rect.topLeft());
 
-        yParam += label->boundingRect().height() + widget->boundingRect().height() + m_spacing;
+        yParam += label->boundingRect().height() + parameter.rect.height() + m_spacing;
     }
 
     qreal height = std::max({yInput, yOutput, yParam}) + m_margin;
@@ -365,6 +514,7 @@ NodeItem::updateLayout()
 
     prepareGeometryChange();
     update();
+    m_registry->markDirty(this);
 }
 
 void
@@ -391,12 +541,12 @@ NodeItem::updateRect()
         }
 
     qreal maxParamWidth = 0;
-    for (auto* proxy : m_parameterWidgets.values())
-        if (proxy)
-        {
-            maxParamWidth = std::fmax(maxParamWidth, proxy->boundingRect().width());
-            maxParamHeight += proxy->boundingRect().height() + m_spacing;
-        }
+    for (const Parameter& parameter : std::as_const(m_parameters))
+    {
+        const QSizeF size = parameterSize(parameter);
+        maxParamWidth = std::fmax(maxParamWidth, size.width());
+        maxParamHeight += size.height() + m_spacing;
+    }
 
     qreal width = maxInputWidth + maxOutputWidth + 40 + maxParamWidth + 2 * m_margin + 2 * m_margin;
 
@@ -419,9 +569,20 @@ NodeItem::drawBackground(QPainter& painter) const
 void
 NodeItem::drawTitle(QPainter& painter) const
 {
+    QColor color = m_nodeNameColor;
+    if (m_profileHeat >= 0)
+    {
+        // Green for the cheapest node through yellow to red for the costliest.
+        const QColor heat = QColor::fromHsvF((1.0 - m_profileHeat) / 3.0, 0.85, 0.9);
+        constexpr qreal tint = 0.75;
+        color = QColor::fromRgbF(color.redF() * (1 - tint) + heat.redF() * tint,
+                                 color.greenF() * (1 - tint) + heat.greenF() * tint,
+                                 color.blueF() * (1 - tint) + heat.blueF() * tint);
+    }
+
     QLinearGradient gradient(0, 0, m_rect.width(), 10);
-    gradient.setColorAt(0, m_nodeNameColor.lighter(150));
-    gradient.setColorAt(1, m_nodeNameColor.darker(120));
+    gradient.setColorAt(0, color.lighter(150));
+    gradient.setColorAt(1, color.darker(120));
     painter.setPen(Qt::NoPen);
     painter.setBrush(gradient);
     painter.drawRoundedRect(QRectF(0, 0, m_rect.width(), m_titleHeight), 10, 10);
@@ -456,6 +617,185 @@ NodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*, QWidget*)
     drawBackground(*painter);
     drawTitle(*painter);
     drawGlowingBounding(*painter);
+    if (m_lazyParameters)
+        drawParameterSnapshots(*painter);
+    if (m_profileHeat >= 0)
+        drawProfileBadge(*painter);
+}
+
+void
+NodeItem::drawProfileBadge(QPainter& painter) const
+{
+    if (m_profileBadge.isEmpty())
+        return;
+
+    QFont font = painter.font();
+    font.setPointSizeF(7);
+    painter.setFont(font);
+    const QFontMetricsF metrics(font);
+    const qreal height = std::min<qreal>(metrics.height() + 2, m_margin - 4);
+    const qreal width = std::min(metrics.horizontalAdvance(m_profileBadge) + 8, m_rect.width() - 8);
+    const QRectF badge(m_rect.right() - width - 6, m_rect.bottom() - height - 2, width, height);
+
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 140));
+    painter.drawRoundedRect(badge, 3, 3);
+    painter.setPen(QColor(230, 230, 230));
+    painter.drawText(badge, Qt::AlignCenter, metrics.elidedText(m_profileBadge, Qt::ElideRight, width - 4));
+}
+
+void
+NodeItem::drawParameterSnapshots(QPainter& painter) const
+{
+    for (const Parameter& parameter : m_parameters)
+        if (!parameter.proxy && !parameter.snapshot.isNull())
+            painter.drawPixmap(parameter.rect.topLeft(), parameter.snapshot);
+}
+
+void
+NodeItem::refreshSnapshot(Parameter& parameter)
+{
+    if (!m_lazyParameters || parameter.proxy || !parameter.widget)
+    {
+        parameter.snapshot = QPixmap();
+        return;
+    }
+
+    const QString key = snapshotKey(parameter.widget, parameter.enabled && isEnabled());
+    if (!QPixmapCache::find(key, &parameter.snapshot))
+    {
+        parameter.snapshot = parameter.widget->grab();
+        QPixmapCache::insert(key, parameter.snapshot);
+    }
+}
+
+QSizeF
+NodeItem::parameterSize(const Parameter& parameter)
+{
+    if (parameter.proxy)
+        return parameter.proxy->size();
+    return parameter.widget ? QSizeF(parameter.widget->size()) : QSizeF();
+}
+
+void
+NodeItem::embedParameter(Parameter& parameter)
+{
+    auto* proxy = new QGraphicsProxyWidget(this);
+    proxy->setWidget(parameter.widget);
+    // Embedding copies the widget's visibility, and a parked widget is hidden.
+    proxy->show();
+    proxy->setPos(parameter.rect.topLeft());
+    parameter.proxy = proxy;
+}
+
+void
+NodeItem::unembedParameter(Parameter& parameter)
+{
+    QGraphicsProxyWidget* proxy = std::exchange(parameter.proxy, nullptr);
+    if (!proxy)
+        return;
+    proxy->setWidget(nullptr);
+    parameter.widget->hide();
+    delete proxy;
+}
+
+QGraphicsProxyWidget*
+NodeItem::activateParameterAt(const QPointF& pos)
+{
+    PortLabel* hit = nullptr;
+    for (auto it = m_parameters.cbegin(); it != m_parameters.cend(); ++it)
+    {
+        if (it->rect.contains(pos))
+        {
+            hit = it.key();
+            break;
+        }
+    }
+
+    if (hit == m_activeParameter)
+        return nullptr;
+
+    parkActiveParameter();
+    // A focused editor stays until the user leaves it.
+    if (!hit || m_activeParameter || !isVisible())
+        return nullptr;
+
+    Parameter& parameter = m_parameters[hit];
+    parameter.proxy = m_registry->parameterEditorPool().acquire(parameter.widget, this);
+    parameter.proxy->setPos(parameter.rect.topLeft());
+    m_activeParameter = hit;
+    update();
+    return parameter.proxy;
+}
+
+void
+NodeItem::forwardMouseEvent(QGraphicsProxyWidget* proxy, QGraphicsSceneMouseEvent* event)
+{
+    const QPointF pos = event->pos();
+    const QPointF lastPos = event->lastPos();
+    const QPointF buttonDownPos = event->buttonDownPos(event->button());
+    event->setPos(proxy->mapFromItem(this, pos));
+    event->setLastPos(proxy->mapFromItem(this, lastPos));
+    event->setButtonDownPos(event->button(), proxy->mapFromItem(this, buttonDownPos));
+    scene()->sendEvent(proxy, event);
+    event->setPos(pos);
+    event->setLastPos(lastPos);
+    event->setButtonDownPos(event->button(), buttonDownPos);
+}
+
+void
+NodeItem::parkActiveParameter()
+{
+    if (!m_activeParameter)
+        return;
+
+    // Keep the editor alive while the user is typing or a popup is open.
+    const QGraphicsProxyWidget* proxy = m_parameters.value(m_activeParameter).proxy;
+    if (QWidget* w = proxy ? proxy->widget() : nullptr; w && w->hasFocus())
+        return;
+
+    PortLabel* port = m_activeParameter;
+    releaseActiveParameter();
+    refreshSnapshot(m_parameters[port]);
+    update();
+}
+
+void
+NodeItem::releaseActiveParameter()
+{
+    PortLabel* port = std::exchange(m_activeParameter, nullptr);
+    m_pressedEditor = nullptr;
+    auto it = m_parameters.find(port);
+    if (it == m_parameters.end() || !it->proxy)
+        return;
+
+    m_registry->parameterEditorPool().release(std::exchange(it->proxy, nullptr), it->widget);
+}
+
+void
+NodeItem::setLazyParameters(bool lazy)
+{
+    if (m_lazyParameters == lazy)
+        return;
+
+    releaseActiveParameter();
+    m_lazyParameters = lazy;
+    for (Parameter& parameter : m_parameters)
+    {
+        if (lazy)
+            unembedParameter(parameter);
+        else
+            embedParameter(parameter);
+        refreshSnapshot(parameter);
+    }
+    updateLayout();
+}
+
+bool
+NodeItem::lazyParameters() const
+{
+    return m_lazyParameters;
 }
 
 bool
@@ -467,12 +807,46 @@ NodeItem::sceneEvent(QEvent* event)
             m_hovered = true;
             update();
             break;
+        case QEvent::GraphicsSceneHoverMove:
+            if (m_lazyParameters)
+                activateParameterAt(static_cast<QGraphicsSceneHoverEvent*>(event)->pos());
+            break;
         case QEvent::GraphicsSceneHoverLeave:
             m_hovered = false;
+            if (m_lazyParameters)
+                parkActiveParameter();
             update();
             break;
         case QEvent::GraphicsSceneMousePress:
+        {
+            auto* mouseEvent = static_cast<QGraphicsSceneMouseEvent*>(event);
+            // The editor did not exist when the scene picked the item under the press (no
+            // hover came first), so it gets the press, and the rest of the click, from here.
+            if (m_lazyParameters && scene())
+                m_pressedEditor = activateParameterAt(mouseEvent->pos());
+            if (m_pressedEditor)
+            {
+                forwardMouseEvent(m_pressedEditor, mouseEvent);
+                event->accept();
+                return true;
+            }
+            update();
+            event->accept();
+            break;
+        }
+        case QEvent::GraphicsSceneMouseMove:
+            if (m_pressedEditor)
+            {
+                forwardMouseEvent(m_pressedEditor, static_cast<QGraphicsSceneMouseEvent*>(event));
+                return true;
+            }
+            break;
         case QEvent::GraphicsSceneMouseRelease:
+            if (QGraphicsProxyWidget* editor = std::exchange(m_pressedEditor, nullptr))
+            {
+                forwardMouseEvent(editor, static_cast<QGraphicsSceneMouseEvent*>(event));
+                return true;
+            }
             update();
             event->accept();
             break;
@@ -495,6 +869,12 @@ NodeItem::itemChange(GraphicsItemChange change, const QVariant& value)
         m_selected = value.toBool();
         update();
     }
+    else if (change == ItemEnabledHasChanged)
+    {
+        for (Parameter& parameter : m_parameters)
+            refreshSnapshot(parameter);
+        update();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -522,23 +902,56 @@ NodeItem::setActive(bool newIsActive)
 QMap<QWidget*, QGraphicsProxyWidget*>
 NodeItem::parameterWidgets() const
 {
-    return m_parameterWidgets;
+    QMap<QWidget*, QGraphicsProxyWidget*> widgets;
+    for (const Parameter& parameter : m_parameters)
+        widgets.insert(parameter.widget, parameter.proxy);
+    return widgets;
 }
 QWidget*
 NodeItem::getParameterWidget(PortLabel* port) const
 {
-    return parameterWidgets().key(parameterPorts().value(port), nullptr);
+    return m_parameters.value(port).widget;
 }
 
 QMap<PortLabel*, QGraphicsProxyWidget*>
 NodeItem::parameterPorts() const
 {
-    return m_parameterPorts;
+    QMap<PortLabel*, QGraphicsProxyWidget*> ports;
+    for (auto it = m_parameters.cbegin(); it != m_parameters.cend(); ++it)
+        ports.insert(it.key(), it->proxy);
+    return ports;
 }
 QList<PortLabel*>
 NodeItem::paramsInputs() const
 {
-    return m_parameterPorts.keys();
+    return m_parameters.keys();
+}
+
+QRectF
+NodeItem::parameterRect(PortLabel* port) const
+{
+    return m_parameters.value(port).rect;
+}
+
+void
+NodeItem::setParameterEnabled(PortLabel* port, bool enabled)
+{
+    auto it = m_parameters.find(port);
+    if (it == m_parameters.end() || it->enabled == enabled)
+        return;
+
+    it->enabled = enabled;
+    it->widget->setEnabled(enabled);
+    if (it->proxy && it->proxy->widget())
+        it->proxy->widget()->setEnabled(enabled);
+    refreshSnapshot(it.value());
+    update();
+}
+
+bool
+NodeItem::isParameterEnabled(PortLabel* port) const
+{
+    return m_parameters.value(port).enabled;
 }
 
 void
@@ -559,6 +972,7 @@ void
 NodeItem::setNodeName(const QString& t)
 {
     m_nodeName = t;
+    m_registry->markDirty(this);
 }
 
 QString
@@ -576,14 +990,67 @@ NodeItem::setNodeNameColor(const QColor& c)
 {
     m_nodeNameColor = c;
     update();
+    m_registry->markDirty(this);
+}
+
+QColor
+NodeItem::nodeNameColor() const
+{
+    return m_nodeNameColor;
+}
+
+void
+NodeItem::setProfileOverlay(qreal heat, const QString& badge)
+{
+    heat = std::clamp<qreal>(heat, 0, 1);
+    if (heat == m_profileHeat && badge == m_profileBadge)
+        return;
+    m_profileHeat = heat;
+    m_profileBadge = badge;
+    update();
+}
+
+void
+NodeItem::clearProfileOverlay()
+{
+    if (m_profileHeat < 0)
+        return;
+    m_profileHeat = -1;
+    m_profileBadge.clear();
+    update();
+}
+
+bool
+NodeItem::hasProfileOverlay() const
+{
+    return m_profileHeat >= 0;
+}
+
+void
+NodeItem::onParameterValueChanged()
+{
+    m_registry->markDirty(this);
+    if (!m_lazyParameters)
+        return;
+
+    const QWidget* widget = qobject_cast<QWidget*>(sender());
+    for (Parameter& parameter : m_parameters)
+    {
+        if (parameter.widget == widget)
+        {
+            refreshSnapshot(parameter);
+            update(parameter.rect);
+            break;
+        }
+    }
 }
 
 PortLabel*
 NodeItem::getPort(const QGraphicsProxyWidget& proxy) const
 {
-    for (auto it = m_parameterPorts.constBegin(); it != m_parameterPorts.constEnd(); ++it)
+    for (auto it = m_parameters.cbegin(); it != m_parameters.cend(); ++it)
     {
-        if (it.value() == &proxy)
+        if (it->proxy == &proxy)
             return it.key();
     }
     return nullptr;
@@ -591,7 +1058,10 @@ NodeItem::getPort(const QGraphicsProxyWidget& proxy) const
 void
 NodeItem::changeVisibility(bool val)
 {
+    if (!val)
+        parkActiveParameter();
     setVisible(val);
+    m_registry->markDirty(this);
 
     for (auto* input : m_inputs)
     {
@@ -615,20 +1085,15 @@ NodeItem::changeVisibility(bool val)
                 conn->setVisible(val);
     }
 
-    for (auto* proxy : m_parameterWidgets)
+    for (auto it = m_parameters.cbegin(); it != m_parameters.cend(); ++it)
     {
-        proxy->setVisible(val);
+        if (it->proxy)
+            it->proxy->setVisible(val);
 
-        for (auto* port : m_parameterPorts.keys())
-        {
-            if (m_parameterPorts.value(port) == proxy)
-            {
-                auto connections = m_registry->getConnections(port);
-                for (auto* conn : connections)
-                    if (conn)
-                        conn->setVisible(val);
-            }
-        }
+        auto connections = m_registry->getConnections(it.key());
+        for (auto* conn : connections)
+            if (conn)
+                conn->setVisible(val);
     }
 }
 
@@ -667,6 +1132,7 @@ void
 NodeItem::changeNodeVisibility(bool val)
 {
     setVisible(val);
+    m_registry->markDirty(this);
 
     for (auto* input : m_inputs)
     {
@@ -714,7 +1180,7 @@ NodeItem::removeOutput(const QString& name)
 void
 NodeItem::removeParamInput(const QString& name)
 {
-    for (PortLabel* param : m_parameterPorts.keys())
+    for (PortLabel* param : m_parameters.keys())
     {
         if (param && param->name() == name)
         {
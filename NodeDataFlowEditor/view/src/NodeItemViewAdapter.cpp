@@ -24,8 +24,10 @@
 
 #include "view/NodeItemViewAdapter.hpp"
 #include "utility/GraphRegistry.hpp"
+#include "view/GraphScene.hpp"
 #include "view/NodeItem.hpp"
 #include "view/PortLabel.hpp"
+#include "view/SelectionDispatcher.hpp"
 
 #include <QGraphicsScene>
 
@@ -56,7 +58,13 @@ NodeItemViewAdapter::wireSignals()
 void
 NodeItemViewAdapter::wireSceneSelection()
 {
-    if (auto const* sc = m_item->scene())
+    // A graph scene notifies only the nodes whose state changed.
+    auto const* graphScene = qobject_cast<GraphScene*>(m_item->scene());
+    if (SelectionDispatcher* dispatcher = graphScene ? graphScene->selectionDispatcher() : nullptr)
+    {
+        dispatcher->watch(m_item, this, [this](bool selected) { emit sgnSelectedChanged(selected); });
+    }
+    else if (auto const* sc = m_item->scene())
     {
         connect(sc, &QGraphicsScene::selectionChanged, this, [this] {
             emit sgnSelectedChanged(m_item->isSelected());
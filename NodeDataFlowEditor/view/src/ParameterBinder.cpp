@@ -0,0 +1,349 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/ParameterBinder.hpp"
+
+#include <QCalendarWidget>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDateEdit>
+#include <QDateTimeEdit>
+#include <QDial>
+#include <QDoubleSpinBox>
+#include <QLineEdit>
+#include <QPlainTextEdit>
+#include <QRadioButton>
+#include <QSlider>
+#include <QSpinBox>
+#include <QTextEdit>
+#include <QTimeEdit>
+#include <algorithm>
+#include <utility>
+
+using ValueType = ParameterStore::ValueType;
+
+namespace
+{
+    // Editors under w in depth-first order; an editor's own children (a spin
+    // box's line edit, a calendar's navigation) belong to it and are skipped.
+    void collectEditors(QWidget* w, QVector<QWidget*>& editors)
+    {
+        if (ParameterBinder::valueTypeOf(w) != ValueType::Invalid)
+        {
+            editors.append(w);
+            return;
+        }
+        for (auto* child : w->findChildren<QWidget*>(QString(), Qt::FindDirectChildrenOnly))
+            collectEditors(child, editors);
+    }
+} // namespace
+
+ParameterBinder::ParameterBinder(ParameterStore& store, QObject* parent)
+    : QObject(parent)
+    , m_store(store)
+{
+    connect(&m_store, &ParameterStore::sgnValueChanged, this, &ParameterBinder::onValueChanged);
+    connect(&m_store, &ParameterStore::sgnPortRemoved, this, &ParameterBinder::onPortRemoved);
+}
+
+bool
+ParameterBinder::bind(ParameterKey key, QWidget* widget)
+{
+    const ValueType type = valueTypeOf(widget);
+    if (key.port == invalidGraphId || key.leaf < 0 || type == ValueType::Invalid)
+        return false;
+
+    unbind(widget);
+
+    if (!m_store.addPort(key, type, readWidget(widget)) && m_store.type(key) == type)
+    {
+        m_applying = true;
+        writeWidget(widget, type, m_store.value(key));
+        m_applying = false;
+    }
+
+    m_views[key].append({widget, type});
+    m_widgetKeys.insert(widget, key);
+    int& leafCount = m_leafCounts[key.port];
+    leafCount = std::max(leafCount, key.leaf + 1);
+    watch(key, widget);
+    return true;
+}
+
+int
+ParameterBinder::bindEditors(PortId port, QWidget* root, QWidget* replacing)
+{
+    if (port == invalidGraphId || !root)
+        return 0;
+
+    // Keep the values, and whatever else is bound to them, of the editors being replaced.
+    QVector<ParameterKey> reused;
+    if (replacing)
+    {
+        QVector<QWidget*> previous;
+        collectEditors(replacing, previous);
+        for (QWidget* editor : std::as_const(previous))
+        {
+            const ParameterKey key = keyOf(editor);
+            if (key.port == port)
+                reused.append(key);
+            unbind(editor);
+        }
+    }
+
+    QVector<QWidget*> editors;
+    collectEditors(root, editors);
+
+    int bound = 0;
+    for (QWidget* editor : std::as_const(editors))
+    {
+        // Mirrored clones arrive already bound to the value they mirror.
+        if (m_widgetKeys.contains(editor))
+            continue;
+        const ParameterKey key = bound < reused.size() ? reused.at(bound) : nextKey(port);
+        if (bind(key, editor))
+            ++bound;
+    }
+    return bound;
+}
+
+ParameterKey
+ParameterBinder::keyOf(const QWidget* widget) const
+{
+    return m_widgetKeys.value(const_cast<QWidget*>(widget), ParameterKey{invalidGraphId});
+}
+
+ParameterKey
+ParameterBinder::nextKey(PortId port) const
+{
+    return {port, m_leafCounts.value(port)};
+}
+
+void
+ParameterBinder::unbind(QWidget* widget)
+{
+    auto found = m_widgetKeys.find(widget);
+    if (found == m_widgetKeys.end())
+        return;
+
+    const ParameterKey key = found.value();
+    m_widgetKeys.erase(found);
+    disconnect(widget, nullptr, this, nullptr);
+
+    auto it = m_views.find(key);
+    if (it == m_views.end())
+        return;
+    for (int i = 0; i < it->size(); ++i)
+    {
+        if (it->at(i).widget == widget)
+        {
+            it->remove(i);
+            break;
+        }
+    }
+    if (it->isEmpty())
+        m_views.erase(it);
+}
+
+int
+ParameterBinder::boundViewCount(ParameterKey key) const
+{
+    return m_views.value(key).size();
+}
+
+void
+ParameterBinder::storeEdit(ParameterKey key, const QVariant& value, QWidget* origin)
+{
+    // Widgets still emit their own change signals while being refreshed (node dirty
+    // tracking relies on them); the guard keeps those echoes out of the store.
+    if (!m_applying)
+        m_store.setValue(key, value, origin);
+}
+
+void
+ParameterBinder::onValueChanged(ParameterKey key, const QVariant& value, QObject* origin)
+{
+    const ValueType type = m_store.type(key);
+    const QVector<Binding> views = m_views.value(key);
+
+    m_applying = true;
+    for (const Binding& b : views)
+    {
+        if (b.widget != origin && b.type == type)
+            writeWidget(b.widget, b.type, value);
+    }
+    m_applying = false;
+}
+
+void
+ParameterBinder::onPortRemoved(PortId port)
+{
+    const int leafCount = m_leafCounts.take(port);
+    for (int leaf = 0; leaf < leafCount; ++leaf)
+    {
+        for (const Binding& b : m_views.take({port, leaf}))
+        {
+            m_widgetKeys.remove(b.widget);
+            disconnect(b.widget, nullptr, this, nullptr);
+        }
+    }
+}
+
+ValueType
+ParameterBinder::valueTypeOf(const QWidget* widget)
+{
+    if (!widget)
+        return ValueType::Invalid;
+    if (qobject_cast<const QLineEdit*>(widget) || qobject_cast<const QTextEdit*>(widget) ||
+        qobject_cast<const QPlainTextEdit*>(widget))
+        return ValueType::String;
+    if (qobject_cast<const QSpinBox*>(widget) || qobject_cast<const QAbstractSlider*>(widget))
+        return ValueType::Int;
+    if (qobject_cast<const QDoubleSpinBox*>(widget))
+        return ValueType::Double;
+    if (qobject_cast<const QComboBox*>(widget))
+        return ValueType::Enum;
+    if (qobject_cast<const QCheckBox*>(widget) || qobject_cast<const QRadioButton*>(widget))
+        return ValueType::Bool;
+    if (qobject_cast<const QDateEdit*>(widget) || qobject_cast<const QCalendarWidget*>(widget))
+        return ValueType::Date;
+    if (qobject_cast<const QTimeEdit*>(widget))
+        return ValueType::Time;
+    if (qobject_cast<const QDateTimeEdit*>(widget))
+        return ValueType::DateTime;
+    return ValueType::Invalid;
+}
+
+void
+ParameterBinder::watch(ParameterKey key, QWidget* widget)
+{
+    auto write = [this, key, widget](const QVariant& v) { storeEdit(key, v, widget); };
+
+    if (auto* w = qobject_cast<QLineEdit*>(widget))
+        connect(w, &QLineEdit::textChanged, this, write);
+    else if (auto* w = qobject_cast<QTextEdit*>(widget))
+        connect(w, &QTextEdit::textChanged, this, [write, w] { write(w->toPlainText()); });
+    else if (auto* w = qobject_cast<QPlainTextEdit*>(widget))
+        connect(w, &QPlainTextEdit::textChanged, this, [write, w] { write(w->toPlainText()); });
+    else if (auto* w = qobject_cast<QSpinBox*>(widget))
+        connect(w, qOverload<int>(&QSpinBox::valueChanged), this, write);
+    else if (auto* w = qobject_cast<QAbstractSlider*>(widget))
+        connect(w, &QAbstractSlider::valueChanged, this, write);
+    else if (auto* w = qobject_cast<QDoubleSpinBox*>(widget))
+        connect(w, qOverload<double>(&QDoubleSpinBox::valueChanged), this, write);
+    else if (auto* w = qobject_cast<QComboBox*>(widget))
+        connect(w, qOverload<int>(&QComboBox::currentIndexChanged), this, write);
+    else if (auto* w = qobject_cast<QAbstractButton*>(widget))
+        connect(w, &QAbstractButton::toggled, this, write);
+    else if (auto* w = qobject_cast<QCalendarWidget*>(widget))
+        connect(w, &QCalendarWidget::selectionChanged, this, [write, w] { write(w->selectedDate()); });
+    else if (auto* w = qobject_cast<QDateEdit*>(widget))
+        connect(w, &QDateEdit::dateChanged, this, write);
+    else if (auto* w = qobject_cast<QTimeEdit*>(widget))
+        connect(w, &QTimeEdit::timeChanged, this, write);
+    else if (auto* w = qobject_cast<QDateTimeEdit*>(widget))
+        connect(w, &QDateTimeEdit::dateTimeChanged, this, write);
+
+    connect(widget, &QObject::destroyed, this, [this, widget] { unbind(widget); });
+}
+
+QVariant
+ParameterBinder::readWidget(const QWidget* widget)
+{
+    if (auto* w = qobject_cast<const QLineEdit*>(widget))
+        return w->text();
+    if (auto* w = qobject_cast<const QTextEdit*>(widget))
+        return w->toPlainText();
+    if (auto* w = qobject_cast<const QPlainTextEdit*>(widget))
+        return w->toPlainText();
+    if (auto* w = qobject_cast<const QSpinBox*>(widget))
+        return w->value();
+    if (auto* w = qobject_cast<const QAbstractSlider*>(widget))
+        return w->value();
+    if (auto* w = qobject_cast<const QDoubleSpinBox*>(widget))
+        return w->value();
+    if (auto* w = qobject_cast<const QComboBox*>(widget))
+        return w->currentIndex();
+    if (auto* w = qobject_cast<const QAbstractButton*>(widget))
+        return w->isChecked();
+    if (auto* w = qobject_cast<const QCalendarWidget*>(widget))
+        return w->selectedDate();
+    if (auto* w = qobject_cast<const QDateEdit*>(widget))
+        return w->date();
+    if (auto* w = qobject_cast<const QTimeEdit*>(widget))
+        return w->time();
+    if (auto* w = qobject_cast<const QDateTimeEdit*>(widget))
+        return w->dateTime();
+    return {};
+}
+
+void
+ParameterBinder::writeWidget(QWidget* widget, ValueType type, const QVariant& value)
+{
+    switch (type)
+    {
+    case ValueType::String:
+        if (auto* w = qobject_cast<QLineEdit*>(widget))
+            w->setText(value.toString());
+        else if (auto* w = qobject_cast<QTextEdit*>(widget))
+            w->setPlainText(value.toString());
+        else if (auto* w = qobject_cast<QPlainTextEdit*>(widget))
+            w->setPlainText(value.toString());
+        break;
+    case ValueType::Int:
+        if (auto* w = qobject_cast<QSpinBox*>(widget))
+            w->setValue(value.toInt());
+        else if (auto* w = qobject_cast<QAbstractSlider*>(widget))
+            w->setValue(value.toInt());
+        break;
+    case ValueType::Double:
+        if (auto* w = qobject_cast<QDoubleSpinBox*>(widget))
+            w->setValue(value.toDouble());
+        break;
+    case ValueType::Enum:
+        if (auto* w = qobject_cast<QComboBox*>(widget))
+            w->setCurrentIndex(value.toInt());
+        break;
+    case ValueType::Bool:
+        if (auto* w = qobject_cast<QAbstractButton*>(widget))
+            w->setChecked(value.toBool());
+        break;
+    case ValueType::Date:
+        if (auto* w = qobject_cast<QCalendarWidget*>(widget))
+            w->setSelectedDate(value.toDate());
+        else if (auto* w = qobject_cast<QDateEdit*>(widget))
+            w->setDate(value.toDate());
+        break;
+    case ValueType::Time:
+        if (auto* w = qobject_cast<QTimeEdit*>(widget))
+            w->setTime(value.toTime());
+        break;
+    case ValueType::DateTime:
+        if (auto* w = qobject_cast<QDateTimeEdit*>(widget))
+            w->setDateTime(value.toDateTime());
+        break;
+    case ValueType::Invalid:
+        break;
+    }
+}
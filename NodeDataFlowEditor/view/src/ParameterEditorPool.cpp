@@ -0,0 +1,206 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/ParameterEditorPool.hpp"
+#include "view/ParameterBinder.hpp"
+
+#include <QCalendarWidget>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDateEdit>
+#include <QDateTimeEdit>
+#include <QDial>
+#include <QDoubleSpinBox>
+#include <QGraphicsProxyWidget>
+#include <QGraphicsScene>
+#include <QLineEdit>
+#include <QMetaProperty>
+#include <QPlainTextEdit>
+#include <QRadioButton>
+#include <QSlider>
+#include <QSpinBox>
+#include <QTextEdit>
+#include <QTimeEdit>
+
+namespace
+{
+    template <typename Widget>
+    QWidget* make()
+    {
+        return new Widget;
+    }
+
+    // Editor classes the pool can stand in for; the exact class must match, so
+    // subclasses with their own behavior are embedded as they are.
+    struct EditorType
+    {
+        const QMetaObject* type;
+        QWidget* (*make)();
+    };
+
+    const EditorType editorTypes[] = {{&QLineEdit::staticMetaObject, &make<QLineEdit>},
+                                      {&QTextEdit::staticMetaObject, &make<QTextEdit>},
+                                      {&QPlainTextEdit::staticMetaObject, &make<QPlainTextEdit>},
+                                      {&QSpinBox::staticMetaObject, &make<QSpinBox>},
+                                      {&QDoubleSpinBox::staticMetaObject, &make<QDoubleSpinBox>},
+                                      {&QSlider::staticMetaObject, &make<QSlider>},
+                                      {&QDial::staticMetaObject, &make<QDial>},
+                                      {&QComboBox::staticMetaObject, &make<QComboBox>},
+                                      {&QCheckBox::staticMetaObject, &make<QCheckBox>},
+                                      {&QRadioButton::staticMetaObject, &make<QRadioButton>},
+                                      {&QDateEdit::staticMetaObject, &make<QDateEdit>},
+                                      {&QTimeEdit::staticMetaObject, &make<QTimeEdit>},
+                                      {&QDateTimeEdit::staticMetaObject, &make<QDateTimeEdit>},
+                                      {&QCalendarWidget::staticMetaObject, &make<QCalendarWidget>}};
+} // namespace
+
+ParameterEditorPool::ParameterEditorPool(ParameterBinder& binder, int idleLimit)
+    : m_binder(binder)
+    , m_idleLimit(idleLimit)
+{
+}
+
+ParameterEditorPool::~ParameterEditorPool()
+{
+    for (const QVector<QWidget*>& editors : std::as_const(m_idleEditors))
+        qDeleteAll(editors);
+    qDeleteAll(m_idleProxies);
+}
+
+QGraphicsProxyWidget*
+ParameterEditorPool::acquire(QWidget* source, QGraphicsItem* parent)
+{
+    QWidget* editor = takeEditor(*source);
+    if (!editor)
+        editor = source;
+
+    QGraphicsProxyWidget* proxy = m_idleProxies.isEmpty() ? new QGraphicsProxyWidget : m_idleProxies.takeLast();
+    proxy->setParentItem(parent);
+    proxy->setWidget(editor);
+    proxy->show();
+    return proxy;
+}
+
+void
+ParameterEditorPool::release(QGraphicsProxyWidget* proxy, QWidget* source)
+{
+    QWidget* editor = proxy->widget();
+    proxy->setWidget(nullptr);
+    proxy->hide();
+    proxy->setParentItem(nullptr);
+    if (QGraphicsScene* scene = proxy->scene())
+        scene->removeItem(proxy);
+
+    if (m_idleProxies.size() < m_idleLimit)
+        m_idleProxies.append(proxy);
+    else
+        delete proxy;
+
+    if (!editor)
+        return;
+    editor->hide();
+    if (editor == source)
+        return;
+
+    m_binder.unbind(editor);
+    QVector<QWidget*>& idle = m_idleEditors[editor->metaObject()];
+    if (idle.size() < m_idleLimit)
+        idle.append(editor);
+    else
+        editor->deleteLater();
+}
+
+int
+ParameterEditorPool::idleEditorCount() const
+{
+    int count = 0;
+    for (const QVector<QWidget*>& editors : m_idleEditors)
+        count += editors.size();
+    return count;
+}
+
+int
+ParameterEditorPool::idleProxyCount() const
+{
+    return m_idleProxies.size();
+}
+
+QWidget*
+ParameterEditorPool::takeEditor(const QWidget& source)
+{
+    // Without a bound value the editor could not reach the source.
+    const ParameterKey key = m_binder.keyOf(&source);
+    if (key.port == invalidGraphId)
+        return nullptr;
+
+    const QMetaObject* type = source.metaObject();
+    QWidget* editor = nullptr;
+    auto idle = m_idleEditors.find(type);
+    if (idle != m_idleEditors.end() && !idle->isEmpty())
+        editor = idle->takeLast();
+    else
+        editor = makeEditor(type);
+    if (!editor)
+        return nullptr;
+
+    configure(*editor, source);
+    m_binder.bind(key, editor);
+    return editor;
+}
+
+QWidget*
+ParameterEditorPool::makeEditor(const QMetaObject* type)
+{
+    for (const EditorType& editorType : editorTypes)
+        if (editorType.type == type)
+            return editorType.make();
+    return nullptr;
+}
+
+void
+ParameterEditorPool::configure(QWidget& editor, const QWidget& source)
+{
+    if (auto* combo = qobject_cast<QComboBox*>(&editor))
+    {
+        auto const* sourceCombo = qobject_cast<const QComboBox*>(&source);
+        combo->clear();
+        for (int i = 0; i < sourceCombo->count(); ++i)
+            combo->addItem(sourceCombo->itemIcon(i), sourceCombo->itemText(i), sourceCombo->itemData(i));
+    }
+
+    // Everything the editor classes declare beyond QWidget: ranges, orientation,
+    // affixes, formats... The value itself comes from the store on binding.
+    const QMetaObject* type = source.metaObject();
+    for (int i = QWidget::staticMetaObject.propertyCount(); i < type->propertyCount(); ++i)
+    {
+        const QMetaProperty property = type->property(i);
+        if (property.isWritable() && property.isStored() && !property.isUser())
+            property.write(&editor, property.read(&source));
+    }
+
+    editor.setEnabled(source.isEnabled());
+    editor.setToolTip(source.toolTip());
+    editor.setStyleSheet(source.styleSheet());
+    editor.resize(source.size());
+}
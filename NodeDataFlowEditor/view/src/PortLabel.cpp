@@ -43,6 +43,7 @@ PortLabel::PortLabel(QString name,
 {
     setAcceptedMouseButtons(Qt::LeftButton);
     setAcceptHoverEvents(true);
+    updateSymbols();
 
     m_portView = new PortView(m_portDisplayName, this);
     m_portView->setArrowBeforeLabel(isAnyInputPort());
@@ -177,6 +178,7 @@ void
 PortLabel::setName(const QString& text)
 {
     m_portName = text;
+    updateSymbols();
 }
 
 QString
@@ -189,6 +191,37 @@ void
 PortLabel::setModuleName(const QString& moduleName)
 {
     m_moduleName = moduleName;
+    updateSymbols();
+}
+
+Symbol
+PortLabel::nameSymbol() const
+{
+    return m_nameSymbol;
+}
+
+Symbol
+PortLabel::moduleSymbol() const
+{
+    return m_moduleSymbol;
+}
+
+Symbol
+PortLabel::forwardedNameSymbol() const
+{
+    return m_forwardedNameSymbol;
+}
+
+void
+PortLabel::updateSymbols()
+{
+    m_nameSymbol = m_portName;
+    m_moduleSymbol = m_moduleName;
+    m_forwardedNameSymbol = m_moduleName + QLatin1Char('_') + m_portName;
+
+    // Share the table's copies so each distinct name is stored once.
+    m_portName = m_nameSymbol.toString();
+    m_moduleName = m_moduleSymbol.toString();
 }
 
 QString
@@ -197,14 +230,21 @@ PortLabel::moduleName() const
     return m_moduleName;
 }
 
+PortId
+PortLabel::id() const
+{
+    return m_id;
+}
+
 ConnectionPort
 PortLabel::getConnectionPortData() const
 {
     return {scenePos(),
             boundingRect(),
-            m_portName,
-            m_moduleName,
-            isAnyInputPort()};
+            m_nameSymbol,
+            m_moduleSymbol,
+            isAnyInputPort(),
+            m_id};
 }
 
 void
@@ -0,0 +1,157 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/SelectionDispatcher.hpp"
+
+#include <QGraphicsItem>
+#include <QGraphicsScene>
+#include <QVector>
+
+// ================================
+// Batch
+// ================================
+
+SelectionDispatcher::Batch::Batch(SelectionDispatcher* dispatcher)
+    : m_dispatcher(dispatcher)
+{
+    if (m_dispatcher)
+        ++m_dispatcher->m_batchDepth;
+}
+
+SelectionDispatcher::Batch::~Batch()
+{
+    if (!m_dispatcher || --m_dispatcher->m_batchDepth > 0 || !m_dispatcher->m_pending)
+        return;
+    m_dispatcher->m_pending = false;
+    m_dispatcher->dispatch();
+}
+
+// ================================
+// SelectionDispatcher
+// ================================
+
+SelectionDispatcher::SelectionDispatcher(QGraphicsScene* scene)
+    : QObject(scene)
+    , m_scene(scene)
+{
+    connect(m_scene, &QGraphicsScene::selectionChanged, this, &SelectionDispatcher::onSelectionChanged);
+}
+
+void
+SelectionDispatcher::watch(QGraphicsItem* item, QObject* receiver, Notify notify)
+{
+    if (!item || !receiver)
+        return;
+
+    unwatch(item);
+    m_watchers.insert(item, {receiver, std::move(notify)});
+    if (item->isSelected())
+        m_selected.insert(item);
+
+    // One destroyed connection per receiver, however many items it watches.
+    auto it = m_receivers.find(receiver);
+    if (it == m_receivers.end())
+    {
+        it = m_receivers.insert(receiver, {});
+        it->destroyed = connect(receiver, &QObject::destroyed, this, [this, receiver] {
+            onReceiverDestroyed(receiver);
+        });
+    }
+    it->items.append(item);
+}
+
+void
+SelectionDispatcher::unwatch(QGraphicsItem* item)
+{
+    const auto watcher = m_watchers.constFind(item);
+    if (watcher == m_watchers.constEnd())
+        return;
+
+    const auto it = m_receivers.find(watcher->receiver);
+    if (it != m_receivers.end())
+    {
+        it->items.removeOne(item);
+        if (it->items.isEmpty())
+        {
+            disconnect(it->destroyed);
+            m_receivers.erase(it);
+        }
+    }
+    m_watchers.erase(watcher);
+    m_selected.remove(item);
+}
+
+void
+SelectionDispatcher::onReceiverDestroyed(QObject* receiver)
+{
+    const Receiver gone = m_receivers.take(receiver);
+    for (QGraphicsItem* item : gone.items)
+    {
+        m_watchers.remove(item);
+        m_selected.remove(item);
+    }
+}
+
+void
+SelectionDispatcher::onSelectionChanged()
+{
+    if (m_batchDepth > 0)
+    {
+        m_pending = true;
+        return;
+    }
+    dispatch();
+}
+
+void
+SelectionDispatcher::dispatch()
+{
+    QSet<QGraphicsItem*> selected;
+    const QList<QGraphicsItem*> items = m_scene->selectedItems();
+    selected.reserve(items.size());
+    for (QGraphicsItem* item : items)
+        if (m_watchers.contains(item))
+            selected.insert(item);
+
+    // Collect first: a callback may watch, unwatch or change the selection again.
+    QVector<QGraphicsItem*> changed;
+    for (QGraphicsItem* item : std::as_const(selected))
+        if (!m_selected.contains(item))
+            changed.push_back(item);
+    const int firstDeselected = changed.size();
+    for (QGraphicsItem* item : std::as_const(m_selected))
+        if (!selected.contains(item))
+            changed.push_back(item);
+    m_selected = std::move(selected);
+
+    for (int i = 0; i < changed.size(); ++i)
+    {
+        const auto it = m_watchers.constFind(changed[i]);
+        if (it == m_watchers.constEnd() || !it->notify)
+            continue;
+        const Notify notify = it->notify;
+        ++m_notifications;
+        notify(i < firstDeselected);
+    }
+}
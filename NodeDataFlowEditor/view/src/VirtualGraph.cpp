@@ -0,0 +1,802 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Joseph Al Hajjar
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "view/VirtualGraph.hpp"
+#include "model/NodeModel.hpp"
+#include "utility/GraphRegistry.hpp"
+#include "view/ConnectionItem.hpp"
+#include "view/GraphScene.hpp"
+#include "view/NodeItem.hpp"
+#include "view/PortLabel.hpp"
+
+#include <QDebug>
+#include <QPainter>
+#include <QPainterPath>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr qreal cellSize = 512.0;
+    // Edges crossing more cells than this are kept in one list checked by every query.
+    constexpr int maxEdgeCells = 64;
+
+    // Geometry assumed for a port layout until a real node has been measured.
+    constexpr qreal estimatedWidth = 160.0;
+    constexpr qreal estimatedTitleHeight = 28.0;
+    constexpr qreal estimatedRowHeight = 22.0;
+
+    const QColor placeholderColor(30, 30, 30);
+    const QColor placeholderBorderColor(70, 70, 70);
+
+    quint64
+    cellKey(int cx, int cy)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(cx)) << 32) | static_cast<quint32>(cy);
+    }
+
+    int
+    cellOf(qreal v)
+    {
+        return static_cast<int>(std::floor(v / cellSize));
+    }
+
+    QPointF
+    portOffset(const PortLabel& port, const QPointF& nodePos, bool output)
+    {
+        // Same end points as ConnectionItem.
+        const QRectF r = port.boundingRect();
+        return port.scenePos() + QPointF(output ? r.width() : 0.0, r.height() / 2 - 3) - nodePos;
+    }
+}
+
+VirtualGraph::VirtualGraph(GraphScene* scene)
+    : m_scene(scene)
+    , m_factory(scene->getNodeFactory())
+{
+    m_syncTimer.setSingleShot(true);
+    m_syncTimer.setInterval(0);
+    connect(&m_syncTimer, &QTimer::timeout, this, &VirtualGraph::sync);
+    connect(scene, &GraphScene::sgnConnectionCreated, this, &VirtualGraph::onConnectionCreated);
+    connect(scene, &GraphScene::sgnConnectionDeleted, this, &VirtualGraph::onConnectionDeleted);
+}
+
+VirtualGraph::~VirtualGraph() = default;
+
+int
+VirtualGraph::signatureFor(const QStringList& inputs, const QStringList& outputs)
+{
+    const QString key = inputs.join(QLatin1Char('\n')) + QLatin1Char('\t') + outputs.join(QLatin1Char('\n'));
+    if (auto it = m_signatureIds.constFind(key); it != m_signatureIds.constEnd())
+        return it.value();
+
+    Signature sig;
+    sig.inputs = inputs;
+    sig.outputs = outputs;
+    const int rows = std::max(inputs.size(), outputs.size());
+    sig.rect = QRectF(0, 0, estimatedWidth, estimatedTitleHeight + rows * estimatedRowHeight + 8.0);
+    for (int i = 0; i < inputs.size(); ++i)
+        sig.inputAnchors.append(QPointF(0, estimatedTitleHeight + (i + 0.5) * estimatedRowHeight));
+    for (int i = 0; i < outputs.size(); ++i)
+        sig.outputAnchors.append(QPointF(estimatedWidth, estimatedTitleHeight + (i + 0.5) * estimatedRowHeight));
+
+    m_extent = std::max({m_extent, sig.rect.right(), sig.rect.bottom()});
+    m_signatures.push_back(std::move(sig));
+    const int id = static_cast<int>(m_signatures.size()) - 1;
+    m_signatureIds.insert(key, id);
+    return id;
+}
+
+int
+VirtualGraph::addNode(const QString& name,
+                      const QString& displayedName,
+                      const QPointF& pos,
+                      const QColor& color,
+                      const QStringList& inputs,
+                      const QStringList& outputs)
+{
+    Record record;
+    record.name = name;
+    record.displayedName = displayedName.isEmpty() ? name : displayedName;
+    record.pos = pos;
+    record.color = color;
+    record.signature = signatureFor(inputs, outputs);
+    m_records.push_back(std::move(record));
+
+    const int index = static_cast<int>(m_records.size()) - 1;
+    indexNode(index);
+    m_bounds |= recordRect(index);
+    if (!m_visible.isEmpty())
+        m_syncTimer.start();
+    return index;
+}
+
+int
+VirtualGraph::addConnection(int from, const QString& output, int to, const QString& input)
+{
+    const int count = static_cast<int>(m_records.size());
+    if (from < 0 || from >= count || to < 0 || to >= count || m_records[from].removed || m_records[to].removed)
+    {
+        qWarning() << "VirtualGraph::addConnection: no such node" << from << to;
+        return -1;
+    }
+
+    Edge edge;
+    edge.from = from;
+    edge.to = to;
+    edge.output = m_signatures[m_records[from].signature].outputs.indexOf(output);
+    edge.input = m_signatures[m_records[to].signature].inputs.indexOf(input);
+    if (edge.output < 0 || edge.input < 0)
+    {
+        qWarning() << "VirtualGraph::addConnection: no such port" << output << input;
+        return -1;
+    }
+
+    const int index = appendEdge(edge);
+    if (m_records[from].node && m_records[to].node)
+        connectEdges(from);
+    return index;
+}
+
+int
+VirtualGraph::appendEdge(const Edge& edge)
+{
+    m_edges.push_back(edge);
+    m_edgeStamps.push_back(0);
+    const int index = static_cast<int>(m_edges.size()) - 1;
+    m_records[edge.from].edges.append(index);
+    if (edge.to != edge.from)
+        m_records[edge.to].edges.append(index);
+    indexEdge(index);
+    return index;
+}
+
+int
+VirtualGraph::liveRecordOf(const NodeItem* item) const
+{
+    if (!item)
+        return -1;
+    for (int index : m_live)
+        if (m_records[index].node->item == item)
+            return index;
+    return -1;
+}
+
+void
+VirtualGraph::onConnectionCreated(ConnectionItem* connection)
+{
+    auto registry = m_scene->getGraphRegistry();
+    PortLabel* output = registry->getPortById(connection->outputPort().portId);
+    PortLabel* input = registry->getPortById(connection->inputPort().portId);
+    if (!output || !input)
+        return;
+
+    // Wires to nodes outside the store are left to the scene.
+    Edge edge;
+    edge.from = liveRecordOf(dynamic_cast<const NodeItem*>(output->parentItem()));
+    edge.to = liveRecordOf(dynamic_cast<const NodeItem*>(input->parentItem()));
+    if (edge.from < 0 || edge.to < 0)
+        return;
+    edge.output = m_records[edge.from].node->item->outputs().indexOf(output);
+    edge.input = m_records[edge.to].node->item->inputs().indexOf(input);
+    if (edge.output < 0 || edge.input < 0)
+        return;
+
+    edge.connection = connection->id();
+    appendEdge(edge);
+}
+
+void
+VirtualGraph::onConnectionDeleted(ConnectionItem* connection)
+{
+    const ConnectionId id = connection->id();
+    if (id == invalidGraphId)
+        return;
+
+    int found = -1;
+    for (int index : std::as_const(m_live))
+    {
+        for (int e : std::as_const(m_records[index].edges))
+        {
+            if (m_edges[e].connection == id)
+            {
+                found = e;
+                break;
+            }
+        }
+        if (found >= 0)
+            break;
+    }
+    if (found < 0)
+        return;
+
+    Edge& edge = m_edges[found];
+    unindexEdge(found);
+    m_records[edge.from].edges.removeOne(found);
+    m_records[edge.to].edges.removeOne(found);
+    edge.connection = invalidGraphId;
+    edge.removed = true;
+    ++m_removedEdges;
+}
+
+void
+VirtualGraph::setViewport(const QRectF& visible, qreal scale)
+{
+    m_visible = visible;
+    m_scale = scale;
+    m_syncTimer.start();
+}
+
+void
+VirtualGraph::sync()
+{
+    m_syncTimer.stop();
+    if (m_visible.isEmpty())
+        return;
+
+    const bool detailed = m_scale >= m_minimumScale;
+    const QRectF keep = m_visible.adjusted(-2 * m_margin, -2 * m_margin, 2 * m_margin, 2 * m_margin);
+
+    for (int index : QVector<int>(m_live))
+    {
+        const NodeItem* node = m_records[index].node->item;
+        // Never pull a node from under the user.
+        if (node->isSelected())
+            continue;
+        if (!detailed || !node->sceneBoundingRect().intersects(keep))
+            release(index);
+    }
+
+    if (detailed)
+    {
+        const QRectF wanted = m_visible.adjusted(-m_margin, -m_margin, m_margin, m_margin);
+        QVector<int> fresh;
+        forEachNodeIn(wanted, [this, &wanted, &fresh](int index) {
+            const Record& r = m_records[index];
+            if (!r.node && !r.removed && recordRect(index).intersects(wanted))
+                fresh.append(index);
+        });
+
+        // Spend the budget on what is closest to the middle of the view.
+        const int budget = std::max(0, m_maxMaterialized - static_cast<int>(m_live.size()));
+        if (fresh.size() > budget)
+        {
+            const QPointF center = m_visible.center();
+            auto distance = [this, &center](int index) {
+                const QPointF d = recordRect(index).center() - center;
+                return d.x() * d.x() + d.y() * d.y();
+            };
+            std::nth_element(fresh.begin(), fresh.begin() + budget, fresh.end(), [&distance](int a, int b) {
+                return distance(a) < distance(b);
+            });
+            fresh.resize(budget);
+        }
+
+        for (int index : std::as_const(fresh))
+            materialize(index);
+    }
+
+    // Records are not items; keep them reachable by scrolling.
+    const QRectF sceneRect = m_scene->sceneRect();
+    if (!sceneRect.contains(m_bounds))
+        m_scene->setSceneRect(sceneRect | m_bounds);
+
+    m_scene->update(m_visible);
+}
+
+void
+VirtualGraph::materialize(int index)
+{
+    Record& r = m_records[index];
+    Signature& sig = m_signatures[r.signature];
+
+    std::unique_ptr<NodeFactory::Node> node;
+    if (!sig.pool.empty())
+    {
+        node = std::move(sig.pool.back());
+        sig.pool.pop_back();
+        --m_pooled;
+
+        m_scene->getGraphRegistry()->unparkNode(node->item);
+        node->item->setNodeName(r.name);
+        node->model->setNodeName(r.name);
+        for (PortLabel* port : node->item->getAllPorts())
+            port->setModuleName(r.name);
+        node->model->setDisplayedNodeName(r.displayedName);
+        node->model->setTitleColor(r.color);
+        node->model->setPosition(r.pos);
+        node->model->setVisible(true);
+    }
+    else
+    {
+        node = m_factory->createNode(m_scene, r.name, r.displayedName, r.color, r.pos);
+        if (!node->item)
+            return;
+        for (const QString& input : std::as_const(sig.inputs))
+            m_factory->addInput(*node, input);
+        for (const QString& output : std::as_const(sig.outputs))
+            m_factory->addOutput(*node, output);
+        ++m_created;
+    }
+
+    connect(node->item, &QObject::destroyed, this, [this, index] { onItemDestroyed(index); });
+    if (!sig.measured)
+        measure(r.signature, *node->item);
+
+    r.node = std::move(node);
+    m_live.append(index);
+    connectEdges(index);
+}
+
+void
+VirtualGraph::release(int index)
+{
+    Record& r = m_records[index];
+    disconnectEdges(index);
+    m_live.removeOne(index);
+
+    std::unique_ptr<NodeFactory::Node> node = std::move(r.node);
+    NodeItem* item = node->item;
+    disconnect(item, &QObject::destroyed, this, nullptr);
+
+    r.displayedName = item->displayedNodeName();
+    if (const QPointF pos = item->pos(); pos != r.pos)
+    {
+        unindexNode(index);
+        for (int edge : std::as_const(r.edges))
+            unindexEdge(edge);
+        r.pos = pos;
+        indexNode(index);
+        for (int edge : std::as_const(r.edges))
+            indexEdge(edge);
+        m_bounds |= recordRect(index);
+    }
+
+    Signature& sig = m_signatures[r.signature];
+    if (static_cast<int>(sig.pool.size()) < m_poolCapacity)
+    {
+        // Parked nodes stay in the scene, hidden and nameless, so reuse is only a rename.
+        item->setSelected(false);
+        node->model->setVisible(false);
+        item->setNodeName(QString());
+        node->model->setNodeName(QString());
+        for (PortLabel* port : item->getAllPorts())
+            port->setModuleName(QString());
+        m_scene->getGraphRegistry()->parkNode(item);
+        sig.pool.push_back(std::move(node));
+        ++m_pooled;
+        return;
+    }
+
+    m_scene->removeItem(item);
+    delete item;
+    node->item = nullptr;
+}
+
+void
+VirtualGraph::connectEdges(int index)
+{
+    for (int e : std::as_const(m_records[index].edges))
+    {
+        Edge& edge = m_edges[e];
+        const Record& from = m_records[edge.from];
+        const Record& to = m_records[edge.to];
+        if (edge.connection != invalidGraphId || !from.node || !to.node)
+            continue;
+
+        PortLabel* output = from.node->item->outputs().value(edge.output);
+        PortLabel* input = to.node->item->inputs().value(edge.input);
+        if (!output || !input)
+            continue;
+        if (ConnectionItem* connection = m_factory->createConnectionBetweenPorts(output, input))
+        {
+            m_scene->addItem(connection);
+            edge.connection = connection->id();
+        }
+    }
+}
+
+void
+VirtualGraph::disconnectEdges(int index)
+{
+    auto registry = m_scene->getGraphRegistry();
+    for (int e : std::as_const(m_records[index].edges))
+    {
+        Edge& edge = m_edges[e];
+        if (edge.connection == invalidGraphId)
+            continue;
+        if (ConnectionItem* connection = registry->getConnectionById(edge.connection))
+            m_scene->releaseConnection(connection);
+        edge.connection = invalidGraphId;
+    }
+}
+
+void
+VirtualGraph::measure(int signature, const NodeItem& item)
+{
+    Signature& sig = m_signatures[signature];
+    const QPointF pos = item.pos();
+
+    sig.rect = item.boundingRect();
+    sig.inputAnchors.clear();
+    for (const PortLabel* port : item.inputs())
+        sig.inputAnchors.append(portOffset(*port, pos, false));
+    sig.outputAnchors.clear();
+    for (const PortLabel* port : item.outputs())
+        sig.outputAnchors.append(portOffset(*port, pos, true));
+    sig.measured = true;
+
+    // Positions are indexed, not bounds, so queries only need to know how far bounds reach.
+    m_extent = std::max({m_extent,
+                         std::abs(sig.rect.left()),
+                         std::abs(sig.rect.right()),
+                         std::abs(sig.rect.top()),
+                         std::abs(sig.rect.bottom())});
+}
+
+void
+VirtualGraph::onItemDestroyed(int index)
+{
+    Record& r = m_records[index];
+    if (!r.node)
+        return;
+
+    // The scene already deleted the item and its wires.
+    r.node->item = nullptr;
+    r.node.reset();
+    r.removed = true;
+    m_live.removeOne(index);
+    unindexNode(index);
+    for (int e : std::as_const(r.edges))
+    {
+        unindexEdge(e);
+        m_edges[e].connection = invalidGraphId;
+    }
+}
+
+QRectF
+VirtualGraph::recordRect(int index) const
+{
+    const Record& r = m_records[index];
+    return m_signatures[r.signature].rect.translated(r.pos);
+}
+
+QRectF
+VirtualGraph::edgeRect(const Edge& edge) const
+{
+    return QRectF(m_records[edge.from].pos, m_records[edge.to].pos).normalized();
+}
+
+QPointF
+VirtualGraph::outputAnchor(const Edge& edge) const
+{
+    const Record& r = m_records[edge.from];
+    if (r.node)
+    {
+        if (const PortLabel* port = r.node->item->outputs().value(edge.output))
+            return portOffset(*port, QPointF(), true);
+    }
+    return r.pos + m_signatures[r.signature].outputAnchors.value(edge.output);
+}
+
+QPointF
+VirtualGraph::inputAnchor(const Edge& edge) const
+{
+    const Record& r = m_records[edge.to];
+    if (r.node)
+    {
+        if (const PortLabel* port = r.node->item->inputs().value(edge.input))
+            return portOffset(*port, QPointF(), false);
+    }
+    return r.pos + m_signatures[r.signature].inputAnchors.value(edge.input);
+}
+
+void
+VirtualGraph::indexNode(int index)
+{
+    const QPointF pos = m_records[index].pos;
+    m_nodeCells[cellKey(cellOf(pos.x()), cellOf(pos.y()))].append(index);
+}
+
+void
+VirtualGraph::unindexNode(int index)
+{
+    const QPointF pos = m_records[index].pos;
+    auto it = m_nodeCells.find(cellKey(cellOf(pos.x()), cellOf(pos.y())));
+    if (it == m_nodeCells.end())
+        return;
+    it->removeOne(index);
+    if (it->isEmpty())
+        m_nodeCells.erase(it);
+}
+
+void
+VirtualGraph::indexEdge(int index)
+{
+    const QRectF r = edgeRect(m_edges[index]);
+    const int x0 = cellOf(r.left()), x1 = cellOf(r.right());
+    const int y0 = cellOf(r.top()), y1 = cellOf(r.bottom());
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > maxEdgeCells)
+    {
+        m_longEdges.append(index);
+        return;
+    }
+    for (int cx = x0; cx <= x1; ++cx)
+        for (int cy = y0; cy <= y1; ++cy)
+            m_edgeCells[cellKey(cx, cy)].append(index);
+}
+
+void
+VirtualGraph::unindexEdge(int index)
+{
+    const QRectF r = edgeRect(m_edges[index]);
+    const int x0 = cellOf(r.left()), x1 = cellOf(r.right());
+    const int y0 = cellOf(r.top()), y1 = cellOf(r.bottom());
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > maxEdgeCells)
+    {
+        m_longEdges.removeOne(index);
+        return;
+    }
+    for (int cx = x0; cx <= x1; ++cx)
+    {
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            auto it = m_edgeCells.find(cellKey(cx, cy));
+            if (it == m_edgeCells.end())
+                continue;
+            it->removeOne(index);
+            if (it->isEmpty())
+                m_edgeCells.erase(it);
+        }
+    }
+}
+
+template <typename Fn>
+void
+VirtualGraph::forEachNodeIn(const QRectF& area, Fn&& fn) const
+{
+    const QRectF r = area.adjusted(-m_extent, -m_extent, m_extent, m_extent);
+    for (int cx = cellOf(r.left()); cx <= cellOf(r.right()); ++cx)
+    {
+        for (int cy = cellOf(r.top()); cy <= cellOf(r.bottom()); ++cy)
+        {
+            const auto it = m_nodeCells.constFind(cellKey(cx, cy));
+            if (it == m_nodeCells.constEnd())
+                continue;
+            for (int index : it.value())
+                fn(index);
+        }
+    }
+}
+
+template <typename Fn>
+void
+VirtualGraph::forEachEdgeIn(const QRectF& area, Fn&& fn) const
+{
+    if (++m_stamp == 0)
+    {
+        std::fill(m_edgeStamps.begin(), m_edgeStamps.end(), 0);
+        m_stamp = 1;
+    }
+
+    const QRectF r = area.adjusted(-m_extent, -m_extent, m_extent, m_extent);
+    for (int cx = cellOf(r.left()); cx <= cellOf(r.right()); ++cx)
+    {
+        for (int cy = cellOf(r.top()); cy <= cellOf(r.bottom()); ++cy)
+        {
+            const auto it = m_edgeCells.constFind(cellKey(cx, cy));
+            if (it == m_edgeCells.constEnd())
+                continue;
+            for (int index : it.value())
+            {
+                if (m_edgeStamps[index] == m_stamp)
+                    continue;
+                m_edgeStamps[index] = m_stamp;
+                fn(index);
+            }
+        }
+    }
+    for (int index : m_longEdges)
+        fn(index);
+}
+
+void
+VirtualGraph::paint(QPainter* painter, const QRectF& exposed) const
+{
+    if (m_records.empty())
+        return;
+
+    const bool detailed = m_scale >= m_minimumScale;
+    QPainterPath wires;
+    QVector<QLineF> lines;
+    auto addWire = [&](const Edge& edge) {
+        const QPointF start = outputAnchor(edge);
+        const QPointF end = inputAnchor(edge);
+        if (!QRectF(start, end).normalized().adjusted(-1, -1, 1, 1).intersects(exposed))
+            return;
+        if (!detailed)
+        {
+            lines.append(QLineF(start, end));
+            return;
+        }
+        // Same curve as ConnectionItem.
+        const qreal dx = end.x() - start.x();
+        wires.moveTo(start);
+        wires.cubicTo(start + QPointF(dx * 0.25, 0), end - QPointF(dx * 0.25, 0), end);
+    };
+
+    // Indexed positions of materialized nodes may be stale; their wires are drawn below.
+    forEachEdgeIn(exposed, [&](int index) {
+        const Edge& edge = m_edges[index];
+        const Record& from = m_records[edge.from];
+        const Record& to = m_records[edge.to];
+        if (!from.node && !to.node && !from.removed && !to.removed)
+            addWire(edge);
+    });
+    for (int index : m_live)
+    {
+        for (int e : m_records[index].edges)
+        {
+            const Edge& edge = m_edges[e];
+            const int other = edge.from == index ? edge.to : edge.from;
+            // Draw wires between two materialized nodes once, and only when they have no real item.
+            if (edge.connection != invalidGraphId || m_records[other].removed ||
+                (m_records[other].node && edge.from != index))
+                continue;
+            addWire(edge);
+        }
+    }
+
+    painter->setPen(QPen(Qt::green, detailed ? 2 : 0));
+    painter->setBrush(Qt::NoBrush);
+    if (detailed)
+        painter->drawPath(wires);
+    else
+        painter->drawLines(lines);
+
+    QVector<QRectF> bodies;
+    QHash<QRgb, QVector<QRectF>> titles;
+    forEachNodeIn(exposed, [&](int index) {
+        const Record& r = m_records[index];
+        if (r.node || r.removed)
+            return;
+        const QRectF rect = recordRect(index);
+        if (!rect.intersects(exposed))
+            return;
+        bodies.append(rect);
+        titles[r.color.rgba()].append(QRectF(rect.topLeft(), QSizeF(rect.width(), std::min(estimatedTitleHeight, rect.height()))));
+    });
+
+    painter->setPen(detailed ? QPen(placeholderBorderColor) : Qt::NoPen);
+    painter->setBrush(placeholderColor);
+    painter->drawRects(bodies);
+    painter->setPen(Qt::NoPen);
+    for (auto it = titles.cbegin(); it != titles.cend(); ++it)
+    {
+        painter->setBrush(QColor::fromRgba(it.key()));
+        painter->drawRects(it.value());
+    }
+}
+
+void
+VirtualGraph::setMargin(qreal margin)
+{
+    m_margin = std::max<qreal>(margin, 0.0);
+}
+
+qreal
+VirtualGraph::margin() const
+{
+    return m_margin;
+}
+
+void
+VirtualGraph::setMinimumScale(qreal scale)
+{
+    m_minimumScale = scale;
+}
+
+qreal
+VirtualGraph::minimumScale() const
+{
+    return m_minimumScale;
+}
+
+void
+VirtualGraph::setMaxMaterialized(int count)
+{
+    m_maxMaterialized = std::max(count, 0);
+}
+
+int
+VirtualGraph::maxMaterialized() const
+{
+    return m_maxMaterialized;
+}
+
+void
+VirtualGraph::setPoolCapacity(int count)
+{
+    m_poolCapacity = std::max(count, 0);
+}
+
+int
+VirtualGraph::poolCapacity() const
+{
+    return m_poolCapacity;
+}
+
+int
+VirtualGraph::nodeCount() const
+{
+    return static_cast<int>(m_records.size());
+}
+
+int
+VirtualGraph::connectionCount() const
+{
+    return static_cast<int>(m_edges.size()) - m_removedEdges;
+}
+
+int
+VirtualGraph::materializedCount() const
+{
+    return m_live.size();
+}
+
+int
+VirtualGraph::pooledCount() const
+{
+    return m_pooled;
+}
+
+int
+VirtualGraph::createdCount() const
+{
+    return m_created;
+}
+
+NodeItem*
+VirtualGraph::item(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(m_records.size()) || !m_records[index].node)
+        return nullptr;
+    return m_records[index].node->item;
+}
+
+QRectF
+VirtualGraph::bounds(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(m_records.size()))
+        return {};
+    if (const NodeItem* node = item(index))
+        return node->sceneBoundingRect();
+    return recordRect(index);
+}
+
+QRectF
+VirtualGraph::itemsBoundingRect() const
+{
+    return m_bounds;
+}
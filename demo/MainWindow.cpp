@@ -1,5 +1,6 @@
 #include "MainWindow.hpp"
 #include "PortTags.hpp"
+#include "factory/NodeDefinition.hpp"
 #include "factory/NodeFactory.hpp"
 #include "taggable/TagApplicator.hpp"
 #include "view/GraphScene.hpp"
@@ -9,6 +10,50 @@
 #include <QDoubleSpinBox>
 #include <QLineEdit>
 
+namespace
+{
+    // Node types declared once; every instance gets its ports and tags in a single pass.
+    struct ResizeNode
+    {
+        static constexpr const char* name = "Resize";
+        static constexpr QRgb color = qRgb(70, 160, 230);
+        static constexpr auto ports = std::make_tuple(
+            nodedef::Input<data::ImageType>{"image", "input image"},
+            nodedef::Output<data::ImageType>{"image", "output image"},
+            nodedef::Parameter<QSpinBox, data::ValueWrapper<int>>{"width", "kernel width", [](QSpinBox* w) {
+                                                                      w->setRange(16, 8192);
+                                                                      w->setValue(640);
+                                                                  }},
+            nodedef::Parameter<QSpinBox, data::ValueWrapper<int>>{"height", "kernel height", [](QSpinBox* h) {
+                                                                      h->setRange(16, 8192);
+                                                                      h->setValue(480);
+                                                                  }},
+            nodedef::Parameter<QCheckBox, data::ValueWrapper<bool>>{"keep_aspect", "keep scale", [](QCheckBox* keep) {
+                                                                        keep->setText("keep_aspect");
+                                                                        keep->setChecked(true);
+                                                                    }});
+    };
+
+    struct NormalizeNode
+    {
+        static constexpr const char* name = "Normalize";
+        static constexpr QRgb color = qRgb(80, 180, 210);
+        static constexpr auto ports = std::make_tuple(
+            nodedef::Input<data::ImageType>{"image"},
+            nodedef::Output<data::ImageType>{"image"},
+            nodedef::Parameter<QDoubleSpinBox, data::ValueWrapper<float>>{"mean", nullptr, [](QDoubleSpinBox* mean) {
+                                                                              mean->setRange(-10.0, 10.0);
+                                                                              mean->setDecimals(3);
+                                                                              mean->setValue(0.485);
+                                                                          }},
+            nodedef::Parameter<QDoubleSpinBox, data::ValueWrapper<float>>{"std", nullptr, [](QDoubleSpinBox* std) {
+                                                                              std->setRange(0.0, 10.0);
+                                                                              std->setDecimals(3);
+                                                                              std->setValue(0.229);
+                                                                          }});
+    };
+}
+
 MainWindow::MainWindow(QWidget* parent)
     : QMainWindow(parent)
 {
@@ -70,63 +115,9 @@ MainWindow::MainWindow(QWidget* parent)
         });
     }
 
-    // Create a "Resize" node
-    auto nResize = m_scene->getNodeFactory()->createNode(
-        m_scene, "Resize", QColor(70, 160, 230), QPointF(320, 60));
-
-    // Connect input/output ports and tags
-    m_scene->getNodeFactory()->addInput(*nResize, "image", "input image");
-    m_scene->getNodeFactory()->addInputTag<data::ImageType>(*nResize, "image");
-    m_scene->getNodeFactory()->addOutput(*nResize, "image", "output image");
-    m_scene->getNodeFactory()->addOutputTag<data::ImageType>(*nResize, "image");
-
-    {
-        // Parameters: width, height, keep aspect ratio
-        auto* w = new QSpinBox();
-        w->setRange(16, 8192);
-        w->setValue(640);
-        auto* h = new QSpinBox();
-        h->setRange(16, 8192);
-        h->setValue(480);
-        auto* keep = new QCheckBox("keep_aspect");
-        keep->setChecked(true);
-
-        m_scene->getNodeFactory()->addParameter(*nResize, w, "width", "kernel width");
-        m_scene->getNodeFactory()->addParamTag<data::ValueWrapper<int>>(*nResize, "width");
-
-        m_scene->getNodeFactory()->addParameter(*nResize, h, "height", "kernel height");
-        m_scene->getNodeFactory()->addParamTag<data::ValueWrapper<int>>(*nResize, "height");
-
-        m_scene->getNodeFactory()->addParameter(*nResize, keep, "keep_aspect", "keep scale");
-        m_scene->getNodeFactory()->addParamTag<data::ValueWrapper<bool>>(*nResize, "keep_aspect");
-    }
-
-    // Create a "Normalize" node
-    auto nNorm = m_scene->getNodeFactory()->createNode(
-        m_scene, "Normalize", QColor(80, 180, 210), QPointF(560, 60));
-
-    m_scene->getNodeFactory()->addInput(*nNorm, "image");
-    m_scene->getNodeFactory()->addInputTag<data::ImageType>(*nNorm, "image");
-    m_scene->getNodeFactory()->addOutput(*nNorm, "image");
-    m_scene->getNodeFactory()->addOutputTag<data::ImageType>(*nNorm, "image");
-
-    {
-        // Parameters: mean and std deviation
-        auto* mean = new QDoubleSpinBox();
-        mean->setRange(-10.0, 10.0);
-        mean->setDecimals(3);
-        mean->setValue(0.485);
-        auto* std = new QDoubleSpinBox();
-        std->setRange(0.0, 10.0);
-        std->setDecimals(3);
-        std->setValue(0.229);
-
-        m_scene->getNodeFactory()->addParameter(*nNorm, mean, "mean");
-        m_scene->getNodeFactory()->addParamTag<data::ValueWrapper<float>>(*nNorm, "mean");
-
-        m_scene->getNodeFactory()->addParameter(*nNorm, std, "std");
-        m_scene->getNodeFactory()->addParamTag<data::ValueWrapper<float>>(*nNorm, "std");
-    }
+    // Create the "Resize" and "Normalize" nodes from their declarations
+    m_scene->getNodeFactory()->create<ResizeNode>(m_scene, QPointF(320, 60));
+    m_scene->getNodeFactory()->create<NormalizeNode>(m_scene, QPointF(560, 60));
 
     // Create other nodes similarly: Canny, Extract Features, Join Metadata, KNN, Overlay, Save Image
     // Each node has inputs, outputs, and parameters with appropriate data tags